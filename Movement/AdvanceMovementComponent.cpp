@@ -2,14 +2,251 @@
 #include "Character/Component/Movement/AdvanceMovementComponent.h"
 #include "Configuration/Game/Data/SystemCore.h"
 #include "PlayerController/PlayerInputCache.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "Character/Component/Movement/AdvanceMovementSubsystem.h"
+#include "Character/Component/Movement/MovementBenchmark.h"
+#include "Character/Component/Movement/TraversalAnnotation.h"
 #include "Components/CapsuleComponent.h"
+#include "GameFramework/PhysicsVolume.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/Package.h"
+#include "Algo/StableSort.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameSession.h"
+#include "TimerManager.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/MemoryWriter.h"
+
+#pragma region Stats
+
+DECLARE_CYCLE_STAT(TEXT("Component Tick"),      STAT_AdvanceMovement_Tick,               STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Activate Dispatch"),   STAT_AdvanceMovement_ActivateDispatch,   STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Update Dispatch"),     STAT_AdvanceMovement_UpdateDispatch,     STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Deactivate Dispatch"), STAT_AdvanceMovement_DeactivateDispatch, STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Refresh Signals"),     STAT_AdvanceMovement_RefreshSignals,     STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Record Switch"),       STAT_AdvanceMovement_RecordSwitch,       STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transition Checks"), STAT_AdvanceMovement_TransitionChecks, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transition Skips"),  STAT_AdvanceMovement_TransitionSkips,  STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("LOD Full"),           STAT_AdvanceMovement_LODFull,           STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LOD Reduced"),        STAT_AdvanceMovement_LODReduced,        STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LOD Minimal"),        STAT_AdvanceMovement_LODMinimal,        STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Updates Run"),        STAT_AdvanceMovement_UpdatesRun,        STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Updates Deferred"),   STAT_AdvanceMovement_UpdatesDeferred,   STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Vault Height Traces"), STAT_AdvanceMovement_VaultHeightTraces, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Vault Width Traces"),  STAT_AdvanceMovement_VaultWidthTraces,  STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ledge Detections"),    STAT_AdvanceMovement_LedgeDetections,   STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Annotation Hits"),     STAT_AdvanceMovement_AnnotationHits,    STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Annotation Misses"),   STAT_AdvanceMovement_AnnotationMisses,  STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Corrections"),  STAT_AdvanceMovement_ClientCorrections,  STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Network Switches"),    STAT_AdvanceMovement_NetworkSwitches,    STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rejected Switches"),   STAT_AdvanceMovement_RejectedSwitches,   STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Forced Corrections"),  STAT_AdvanceMovement_ForcedCorrections,  STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Validate Move"),               STAT_AdvanceMovement_ValidateMove,       STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground From Floor"),   STAT_AdvanceMovement_GroundFromFloor,   STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Predicted"),    STAT_AdvanceMovement_GroundPredicted,   STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Traces"),       STAT_AdvanceMovement_GroundTraces,      STATGROUP_AdvanceMovement);
+
+#pragma endregion
+
+#pragma region Configuration
+
+static int32 GAdvanceMovementLODEnabled = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementLODEnabled
+(
+    TEXT("AdvanceMovement.LOD.Enable"),
+    GAdvanceMovementLODEnabled,
+    TEXT("Reduces the movement logic update rate of characters far from every player. 0: always full rate, 1: enabled (default)"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementLODReducedDistance = 3000.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementLODReducedDistance
+(
+    TEXT("AdvanceMovement.LOD.ReducedDistance"),
+    GAdvanceMovementLODReducedDistance,
+    TEXT("Distance from the nearest player view beyond which movement logic drops to the Reduced LOD."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementLODMinimalDistance = 8000.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementLODMinimalDistance
+(
+    TEXT("AdvanceMovement.LOD.MinimalDistance"),
+    GAdvanceMovementLODMinimalDistance,
+    TEXT("Distance from the nearest player view beyond which movement logic drops to the Minimal LOD."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementLODRefreshInterval = 0.5f;
+static FAutoConsoleVariableRef CVarAdvanceMovementLODRefreshInterval
+(
+    TEXT("AdvanceMovement.LOD.RefreshInterval"),
+    GAdvanceMovementLODRefreshInterval,
+    TEXT("Seconds between re-evaluations of a character's movement LOD."),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementVaultLegacyScan = 0;
+static FAutoConsoleVariableRef CVarAdvanceMovementVaultLegacyScan
+(
+    TEXT("AdvanceMovement.Vault.LegacyScan"),
+    GAdvanceMovementVaultLegacyScan,
+    TEXT("Measures vault height and width with one trace per unit instead of the bounded searches.\n")
+    TEXT("0: coarse-to-fine (default), 1: legacy scan"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementVaultCoarseStep = 16.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementVaultCoarseStep
+(
+    TEXT("AdvanceMovement.Vault.CoarseStep"),
+    GAdvanceMovementVaultCoarseStep,
+    TEXT("Height step of the coarse vault ledge scan. Gaps thinner than this between two blocking surfaces are not seen."),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementVaultValidate = 0;
+static FAutoConsoleVariableRef CVarAdvanceMovementVaultValidate
+(
+    TEXT("AdvanceMovement.Vault.Validate"),
+    GAdvanceMovementVaultValidate,
+    TEXT("Non-shipping only. Runs the legacy scan next to the coarse-to-fine search and logs a warning when their results differ.\n")
+    TEXT("0: off (default), 1: on"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementGroundHorizontalTolerance = 50.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementGroundHorizontalTolerance
+(
+    TEXT("AdvanceMovement.Ground.HorizontalTolerance"),
+    GAdvanceMovementGroundHorizontalTolerance,
+    TEXT("Horizontal distance an airborne character may move from its last ground trace before the ground is traced again."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementGroundMaxAge = 0.5f;
+static FAutoConsoleVariableRef CVarAdvanceMovementGroundMaxAge
+(
+    TEXT("AdvanceMovement.Ground.MaxAge"),
+    GAdvanceMovementGroundMaxAge,
+    TEXT("Seconds an airborne ground trace stays valid, so moving geometry below is eventually seen."),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementLedgeShared = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementLedgeShared
+(
+    TEXT("AdvanceMovement.Ledge.Shared"),
+    GAdvanceMovementLedgeShared,
+    TEXT("Vault checks use the shared per-frame ledge detection instead of their own searches. Hang and mantle always use it.\n")
+    TEXT("0: own searches, 1: shared ledge (default)"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementLedgeReach = 150.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementLedgeReach
+(
+    TEXT("AdvanceMovement.Ledge.Reach"),
+    GAdvanceMovementLedgeReach,
+    TEXT("Distance from the capsule center the ledge wall sweep covers. Must cover the longest detector reach."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementLedgeMaxAbove = 60.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementLedgeMaxAbove
+(
+    TEXT("AdvanceMovement.Ledge.MaxAboveCapsule"),
+    GAdvanceMovementLedgeMaxAbove,
+    TEXT("Height above the capsule top up to which a ledge edge is searched. The search always reaches the mantle's maximum height."),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementTraversalUseAnnotations = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementTraversalUseAnnotations
+(
+    TEXT("AdvanceMovement.Traversal.UseAnnotations"),
+    GAdvanceMovementTraversalUseAnnotations,
+    TEXT("Answers ledge detection from the level's precomputed traversal annotations before tracing.\n")
+    TEXT("0: always trace, 1: annotations first (default)"),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementTraversalTrustStaticIndex = 0;
+static FAutoConsoleVariableRef CVarAdvanceMovementTraversalTrustStaticIndex
+(
+    TEXT("AdvanceMovement.Traversal.TrustStaticIndex"),
+    GAdvanceMovementTraversalTrustStaticIndex,
+    TEXT("Inside the annotated area, treats a missing annotation as no ledge unless a dynamic object is in front, and skips the static traces.\n")
+    TEXT("0: trace on a miss (default), 1: trust the index"),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementDetectionAgingFrames = 3;
+static FAutoConsoleVariableRef CVarAdvanceMovementDetectionAgingFrames
+(
+    TEXT("AdvanceMovement.DetectionBudget.AgingFrames"),
+    GAdvanceMovementDetectionAgingFrames,
+    TEXT("Deferred requests in a row after which a character's detection priority rises by one step, up to High."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementGrappleRange = 2500.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementGrappleRange
+(
+    TEXT("AdvanceMovement.Anchor.GrappleRange"),
+    GAdvanceMovementGrappleRange,
+    TEXT("Longest distance from the view point to a grapple anchor. Queries beyond the anchor hash cell size (2500) visit more cells."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementGrappleConeAngle = 30.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementGrappleConeAngle
+(
+    TEXT("AdvanceMovement.Anchor.GrappleConeAngle"),
+    GAdvanceMovementGrappleConeAngle,
+    TEXT("Half angle, in degrees, of the view cone a grapple anchor must be in."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementZiplineRange = 300.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementZiplineRange
+(
+    TEXT("AdvanceMovement.Anchor.ZiplineRange"),
+    GAdvanceMovementZiplineRange,
+    TEXT("Longest distance from the capsule center to a zipline anchor."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementZiplineConeAngle = 90.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementZiplineConeAngle
+(
+    TEXT("AdvanceMovement.Anchor.ZiplineConeAngle"),
+    GAdvanceMovementZiplineConeAngle,
+    TEXT("Half angle, in degrees, around the character's facing a zipline anchor must be in."),
+    ECVF_Default
+);
+
+#pragma endregion
 
 #pragma region Constructor 
 
  Constructor for UAdvanceMovementComponent
 UAdvanceMovementComponent::UAdvanceMovementComponent()
 {
-
+    SetNetworkMoveDataContainer(NetworkMoveDataContainer);
+    SetMoveResponseDataContainer(MoveResponseDataContainer);
+    SetIsReplicatedByDefault(true);
 }
 
 #pragma endregion
@@ -21,13 +258,122 @@ void UAdvanceMovementComponent::BeginPlay()
 {
     Super::BeginPlay();
     InitializeAdvanceMovementComponent();
+
+    // Water overlaps are tracked on the owner's capsule; fall back to the character's own if none was assigned yet.
+    if (!OwnerCapsuleComponent && CharacterOwner)
+    {
+        SetOwnerCapsuleComponent(CharacterOwner->GetCapsuleComponent());
+    }
+    else
+    {
+        BindWaterEvents();
+    }
+
+    ReplicatedStateStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+    // Spread LOD refreshes over the interval so characters spawned together do not all re-evaluate on the same frame.
+    TickLODRefreshCountdown = GAdvanceMovementLODRefreshInterval * static_cast<float>(GetUniqueID() % TickLODRefreshSlots) / TickLODRefreshSlots;
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UAdvanceMovementSubsystem* Subsystem = World->GetSubsystem<UAdvanceMovementSubsystem>())
+        {
+            Subsystem->RegisterComponent(this);
+        }
+    }
+}
+
+void UAdvanceMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnbindWaterEvents();
+    StopReplay();
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UAdvanceMovementSubsystem* Subsystem = World->GetSubsystem<UAdvanceMovementSubsystem>())
+        {
+            Subsystem->UnregisterComponent(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UAdvanceMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    if (!Replay.IsValid() && !FMovementBenchmark::IsCollecting())
+    {
+        Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+        // Batched components get their movement logic from UAdvanceMovementSubsystem; only the engine movement runs here.
+        if (bMovementBatched)
+        {
+            BatchedDeltaTime += DeltaTime;
+            return;
+        }
+
+        UpdateMovementLogic(DeltaTime);
+        return;
+    }
+
+    // Timed path: replay recording or playback, or a running movement benchmark.
+    if (Replay.IsValid())
+    {
+        BeginReplayFrame(DeltaTime);
+    }
+
+    const EMovementType FrameType = GetActiveMovementType();
+    const uint64 StartCycles      = FPlatformTime::Cycles64();
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+    if (bMovementBatched)
+    {
+        BatchedDeltaTime += DeltaTime;
+    }
+    else
+    {
+        UpdateMovementLogic(DeltaTime);
+    }
+
+    const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+    FMovementBenchmark::AddSample(this, FrameType, Cycles);
+
+    if (Replay.IsValid())
+    {
+        EndReplayFrame(FrameType, Cycles);
+    }
+}
+
+void UAdvanceMovementComponent::UpdateMovementLogic(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_Tick);
+
+    UpdateTickLOD(DeltaTime);
+
+    if (!ConsumeMovementUpdate(DeltaTime))
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_UpdatesDeferred);
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_UpdatesRun);
+
+    EnvironmentProbes.SetMotionTolerance(Velocity.Size() * DeltaSeconds());
+
+    // State machine first: refreshes the transition signals and runs the current state's tick and transitions.
+    TickMovement();
+
     Local_UpdateMovement(MovementData.GetCurrentMovementType());
+
+    // The update is consumed; calls outside the next one fall back to the frame delta.
+    MovementDeltaSeconds = 0.0f;
+
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        UpdateReplicatedMovementState();
+    }
 }
 
 void UAdvanceMovementComponent::InitializeAdvanceMovementComponent()
@@ -47,367 +393,1671 @@ void UAdvanceMovementComponent::InitializeAdvanceMovementComponent()
 
 #pragma endregion
 
-#pragma region Utility
+#pragma region ReplicatedMovementState
 
-float UAdvanceMovementComponent::DeltaSeconds()
+void UAdvanceMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-    if (UWorld* World = GetWorld())
-    {
-        return World->GetDeltaSeconds();
-    }
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    return 0.0f;
+    // The owning client predicts its own state through saved moves; only simulated proxies need this.
+    DOREPLIFETIME_CONDITION(UAdvanceMovementComponent, ReplicatedMovementState, COND_SimulatedOnly);
 }
 
-#pragma endregion
+void UAdvanceMovementComponent::UpdateReplicatedMovementState()
+{
+    const FMovementStateSnapshot& Current = ReplicatedMovementState.Snapshot;
+    const FAdvanceMovementPayload Payload = MakeMovementPayload();
 
-#pragma region Owner
+    FMovementStateSnapshot Snapshot;
+    Snapshot.CurrentType  = Payload.Type;
+    Snapshot.PreviousType = MovementData.GetPreviousMovementType();
+    Snapshot.Phase        = MovementData.GetModuleState(Payload.Type).GetPhase();
+    Snapshot.DirectionYaw = Payload.DirectionYaw;
+    Snapshot.Target       = Payload.Target;
 
+    // Keep the entry time while the type holds so a running movement does not resend it.
+    Snapshot.EnteredAtMs = Current.CurrentType == Payload.Type && ReplicatedMovementState.ChangeCount > 0
+        ? Current.EnteredAtMs
+        : static_cast<uint32>(GetServerWorldTimeSeconds() * 1000.0);
 
-ACharacterModule* UAdvanceMovementComponent::GetOwnerCharacter() const
-{
-    if (OwnerCharacter != nullptr)
-    {
-        #if DEV_DEBUG_MODE
-        UE_LOG(LogTemp, Verbose, TEXT("OwnerCharacter is already valid."));
-        #endif
+    ReplicatedMovementState.SetSnapshot(Snapshot);
+}
 
-        return OwnerCharacter.Get();
-    }
+void UAdvanceMovementComponent::OnRep_ReplicatedMovementState()
+{
+    const FMovementStateSnapshot& Snapshot = ReplicatedMovementState.Snapshot;
 
-    ACharacterModule* ResolvedOwner = Cast<ACharacterModule>(GetOwner());
-    if (!ResolvedOwner)
+    if (!IsValidMovementTypeIndex(MovementTypeIndex(Snapshot.CurrentType)))
     {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("Failed to resolve owner as ACharacterModule");
-        #endif
-
-        return nullptr;
+        return;
     }
 
-    #if DEV_DEBUG_MODE
-    LOG_INFO("OwnerCharacter was null. Resolved and cached from GetOwner().");
-    #endif
+    FAdvanceMovementPayload Payload;
+    Payload.Type         = Snapshot.CurrentType;
+    Payload.DirectionYaw = Snapshot.DirectionYaw;
+    Payload.Target       = Snapshot.Target;
 
-     Lazily cache the result (safe to cast away const here)
-    const_cast<UAdvanceMovementComponent*>(this)->OwnerCharacter = ResolvedOwner;
-    return ResolvedOwner;
-}
+    ApplyMovementPayload(Payload, EMovementSwitchReason::Network);
 
+    MovementData.SetPreviousMovementType(Snapshot.PreviousType);
+    MovementData.SetModulePhase(Snapshot.CurrentType, Snapshot.Phase);
 
+    // A proxy learns of a movement some time after it started; carry the time already spent in it over from the server.
+    const double Elapsed = GetServerWorldTimeSeconds() - Snapshot.EnteredAtMs / 1000.0;
 
-void UAdvanceMovementComponent::SetOwnerCharacter(ACharacterModule* InOwnerCharacter)
-{
-    OwnerCharacter = InOwnerCharacter; 
+    FMovementModuleState& ModuleState = MovementData.GetModuleState(Snapshot.CurrentType);
+    ModuleState.ResetDuration();
+    ModuleState.UpdateDuration(static_cast<float>(FMath::Max(Elapsed, 0.0)));
+}
 
-#if DEV_DEBUG_MODE
-    if (OwnerCharacter == nullptr)
-    {
-        LOG_ERROR("OwnerCharacter is null after SetOwnerCharacter call!");
-    }
-    else
+double UAdvanceMovementComponent::GetServerWorldTimeSeconds() const
+{
+    const UWorld* World = GetWorld();
+    if (!World)
     {
-        LOG_INFO("OwnerCharacter is not null after SetOwnerCharacter call.");
+        return 0.0;
     }
-#endif
+
+    const AGameStateBase* GameState = World->GetGameState();
+    return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
 }
 
 #pragma endregion
 
-#pragma region OwnerData
-
-FCharacterData* UAdvanceMovementComponent::GetOwnerData() const
-{
-    return OwnerData;
-}
-
+#pragma region Replay
 
-void UAdvanceMovementComponent::SetOwnerData(FCharacterData* InOwnerData)
+void UAdvanceMovementComponent::BeginReplayFrame(float& DeltaTime)
 {
-    if (InOwnerData == nullptr)
+    if (Replay->IsRecording())
     {
-#if DEV_DEBUG_MODE
-        LOG_ERROR("Attempted to set OwnerData to nullptr, operation ignored.");
-#endif
-        return;
-    }
-
-    OwnerData = InOwnerData;
+        EMovementReplayFlags Flags = EMovementReplayFlags::None;
 
-#if DEV_DEBUG_MODE
-    LOG_INFO("OwnerData reference successfully updated.");
-#endif
-}
+        if (CharacterOwner && CharacterOwner->bPressedJump)
+        {
+            Flags |= EMovementReplayFlags::PressedJump;
+        }
 
+        if (bWantsToCrouch)
+        {
+            Flags |= EMovementReplayFlags::WantsCrouch;
+        }
 
+        // Pin this frame's input flags so the guards run on exactly what the frame records.
+        SetExternalInput(CaptureInputBits());
 
-#pragma endregion
+        Replay->RecordFrame(DeltaTime, GetActorLocation(), Velocity, GetActiveMovementType(), Flags, MovementInput.Bits);
 
-#pragma region OwnerAbility
+        if (Replay->GetFrameIndex() == 0)
+        {
+            const AController* Controller = CharacterOwner ? CharacterOwner->GetController() : nullptr;
+            Replay->RecordStartRotation(UpdatedComponent ? UpdatedComponent->GetComponentRotation() : FRotator::ZeroRotator,
+                Controller ? Controller->GetControlRotation() : FRotator::ZeroRotator);
+        }
+        return;
+    }
 
-void UAdvanceMovementComponent::UpdateCharacterAbility(FCharacterAbility* Ability)
-{
-    if (!Ability)
+    const FMovementReplayFrame* Frame = Replay->AdvanceFrame();
+    if (!Frame)
     {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("");
-        #endif
         return;
     }
 
-    const FMovementAbility& MovementAbility = Ability->GetMovementAbility();
-    auto& Modules = MovementData.GetMovementModules();
-
-    const FAbilityModule* SprintModule = MovementAbility.GetAbilities().Find(EMovementAbilityType::Sprint);
-    if (SprintModule && SprintModule->AbilityLocked())
+    // The first frame places the character where the recording started; later ones are compared against it.
+    if (Replay->GetFrameIndex() == 0)
     {
-        if (FMovementModule* SprintMovement = Modules.Find(EMovementType::Sprint))
+        if (UpdatedComponent)
         {
-            SprintMovement->SetPhase(EMovementPhase::ReadyToAttempt);
+            UpdatedComponent->SetWorldLocationAndRotation(FVector(Frame->Location), Replay->GetStartRotation(), false, nullptr, ETeleportType::TeleportPhysics);
         }
-        else
-        {
-            #if DEV_DEBUG_MODE
-            LOG_ERROR("Sprint movement module not found.");
-            #endif
 
+        if (AController* Controller = CharacterOwner ? CharacterOwner->GetController() : nullptr)
+        {
+            Controller->SetControlRotation(Replay->GetStartControlRotation());
         }
-    }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Jump))
-    {
+        Velocity = FVector(Frame->Velocity);
 
+        FAdvanceMovementPayload Payload;
+        Payload.Type = Frame->MovementType;
+        ApplyMovementPayload(Payload, EMovementSwitchReason::Forced);
     }
-
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::DoubleJump))
+    else
     {
-
+        Replay->CompareFrame(GetActorLocation(), GetActiveMovementType());
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::CoyoteJump))
-    {
+    DeltaTime = Frame->DeltaTime;
 
+    if (CharacterOwner)
+    {
+        CharacterOwner->bPressedJump = EnumHasAnyFlags(Frame->Flags, EMovementReplayFlags::PressedJump);
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Crouch))
-    {
+    bWantsToCrouch = EnumHasAnyFlags(Frame->Flags, EMovementReplayFlags::WantsCrouch);
 
-    }
+    // The guards read the recorded input flags, not whatever the live input cache holds.
+    SetExternalInput(Frame->InputBits);
+}
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Prone))
+void UAdvanceMovementComponent::EndReplayFrame(EMovementType FrameType, uint64 Cycles)
+{
+    if (!Replay->IsPlaying())
     {
-
+        return;
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Roll))
-    {
+    Replay->AddTiming(FrameType, Cycles);
 
+    if (Replay->GetFrameIndex() + 1 >= Replay->GetFrameCount())
+    {
+        StopReplay();
     }
+}
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Slide))
-    {
+FVector UAdvanceMovementComponent::ConsumeInputVector()
+{
+    const FVector Input = Super::ConsumeInputVector();
+    return Replay.IsValid() ? Replay->ResolveInput(Input) : Input;
+}
 
-    }
+void UAdvanceMovementComponent::StartReplayRecording()
+{
+    StopReplay();
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::WallRun))
-    {
+    Replay = MakeUnique<FMovementReplay>();
+    Replay->StartRecording();
+    EnvironmentProbes.SetReplay(Replay.Get());
+}
 
+bool UAdvanceMovementComponent::SaveReplayRecording(const FString& Filename)
+{
+    if (!Replay.IsValid() || !Replay->IsRecording() || Replay->GetFrameCount() == 0)
+    {
+        return false;
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::VerticalWallRun))
-    {
+    Replay->Stop();
+    const bool bSaved = Replay->Save(Filename);
 
-    }
+    UE_LOG(LogAdvanceMovement, Display, TEXT("Movement replay %s: %d frames, %d probes %s %s"),
+        *GetNameSafe(GetOwner()), Replay->GetFrameCount(), Replay->GetProbeCount(), bSaved ? TEXT("saved to") : TEXT("failed to save to"), *Filename);
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Hang))
-    {
+    StopReplay();
+    return bSaved;
+}
 
-    }
+bool UAdvanceMovementComponent::StartReplayPlayback(const FString& Filename)
+{
+    StopReplay();
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Dash))
+    TUniquePtr<FMovementReplay> Loaded = MakeUnique<FMovementReplay>();
+    if (!Loaded->Load(Filename) || !Loaded->StartPlayback())
     {
-
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Movement replay: cannot play %s"), *Filename);
+        return false;
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Teleport))
-    {
+    Replay = MoveTemp(Loaded);
+    EnvironmentProbes.Reset();
+    EnvironmentProbes.SetReplay(Replay.Get());
 
+    // Run the movement logic from TickComponent so each tick is timed as a whole, even if batching is switched on meanwhile.
+    if (UAdvanceMovementSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr)
+    {
+        bReplayWasRegistered = Subsystem->UnregisterComponent(this);
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Vault))
-    {
+    return true;
+}
 
+void UAdvanceMovementComponent::StopReplay()
+{
+    if (!Replay.IsValid())
+    {
+        return;
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Mantle))
+    if (Replay->IsPlaying())
     {
-
+        Replay->LogReport(GetNameSafe(GetOwner()));
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Glide))
+    Replay->Stop();
+    EnvironmentProbes.SetReplay(nullptr);
+    Replay.Reset();
+    ClearExternalInput();
+
+    if (bReplayWasRegistered)
     {
+        bReplayWasRegistered = false;
 
+        if (UAdvanceMovementSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr)
+        {
+            Subsystem->RegisterComponent(this);
+        }
     }
+}
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Swim))
-    {
+#pragma endregion
 
+#pragma region TickLOD
+
+void UAdvanceMovementComponent::UpdateTickLOD(float DeltaTime)
+{
+    TickLODRefreshCountdown -= DeltaTime;
+
+    if (TickLODRefreshCountdown <= 0.0f)
+    {
+        // Adding the interval rather than resetting to it keeps the offset from BeginPlay.
+        TickLOD                 = EvaluateTickLOD();
+        TickLODRefreshCountdown = FMath::Max(TickLODRefreshCountdown + GAdvanceMovementLODRefreshInterval, 0.0f);
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Dive))
+    switch (TickLOD)
     {
+    case EMovementTickLOD::Full:    INC_DWORD_STAT(STAT_AdvanceMovement_LODFull);    break;
+    case EMovementTickLOD::Reduced: INC_DWORD_STAT(STAT_AdvanceMovement_LODReduced); break;
+    case EMovementTickLOD::Minimal: INC_DWORD_STAT(STAT_AdvanceMovement_LODMinimal); break;
+    }
+}
+
+EMovementTickLOD UAdvanceMovementComponent::EvaluateTickLOD() const
+{
+    const UWorld* World = GetWorld();
 
+    if (!GAdvanceMovementLODEnabled || !World || !CharacterOwner || CharacterOwner->IsPlayerControlled())
+    {
+        return EMovementTickLOD::Full;
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Hover))
+    const FVector OwnerLocation = CharacterOwner->GetActorLocation();
+    float NearestDistanceSquared = TNumericLimits<float>::Max();
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
     {
+        const APlayerController* PlayerController = It->Get();
+        if (!PlayerController)
+        {
+            continue;
+        }
 
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+        NearestDistanceSquared = FMath::Min(NearestDistanceSquared, static_cast<float>(FVector::DistSquared(OwnerLocation, ViewLocation)));
     }
 
-    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Fly))
+    EMovementTickLOD LOD = EMovementTickLOD::Full;
+
+    if (NearestDistanceSquared >= FMath::Square(GAdvanceMovementLODMinimalDistance))
+    {
+        LOD = EMovementTickLOD::Minimal;
+    }
+    else if (NearestDistanceSquared >= FMath::Square(GAdvanceMovementLODReducedDistance))
     {
+        LOD = EMovementTickLOD::Reduced;
+    }
 
+    // Characters nobody has seen lately drop one level. Dedicated servers render nothing, so distance alone decides there.
+    if (LOD == EMovementTickLOD::Full && !IsRunningDedicatedServer() && !CharacterOwner->WasRecentlyRendered(GAdvanceMovementLODRefreshInterval))
+    {
+        LOD = EMovementTickLOD::Reduced;
     }
 
+    return LOD;
 }
 
-void UAdvanceMovementComponent::SetOwnerAbility(FCharacterAbility* InAbility)
+bool UAdvanceMovementComponent::ConsumeMovementUpdate(float DeltaTime)
 {
-    if (InAbility == nullptr)
-    {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("Attempted to set OwnerAbility to nullptr. Operation ignored.");
-        #endif
-        return;
+    AccumulatedMovementDelta += DeltaTime;
+
+    const int32 Index = MovementTypeIndex(MovementData.GetCurrentMovementType());
+    const float Interval = MovementData.GetModuleStates().IsValidIndex(Index) ? MovementData.GetModuleStates()[Index].GetUpdateInterval(TickLOD) : 0.0f;
+
+    if (AccumulatedMovementDelta < Interval)
+    {
+        return false;
     }
 
-    OwnerAbility = InAbility;
+    MovementDeltaSeconds     = AccumulatedMovementDelta;
+    AccumulatedMovementDelta = 0.0f;
+    return true;
+}
 
-    #if DEV_DEBUG_MODE
-    LOG_INFO("OwnerAbility successfully updated.");
-    #endif
+#pragma endregion
+
+#pragma region DetectionBudget
+
+EMovementDetectionPriority UAdvanceMovementComponent::EvaluateDetectionPriority() const
+{
+    if (!CharacterOwner || CharacterOwner->IsPlayerControlled())
+    {
+        return EMovementDetectionPriority::Critical;
+    }
+
+    EMovementDetectionPriority Priority = EMovementDetectionPriority::Low;
+
+    // Airborne characters must catch a ledge now; grounded ones near a player view (Full TickLOD) come next.
+    if (IsFalling() || IsCurrentMovementState(EMovementState::Fall) || IsCurrentMovementState(EMovementState::Jump))
+    {
+        Priority = EMovementDetectionPriority::High;
+    }
+    else if (TickLOD == EMovementTickLOD::Full)
+    {
+        Priority = EMovementDetectionPriority::Normal;
+    }
+
+    // Characters that keep losing their slot climb one step per AgingFrames deferrals.
+    if (GAdvanceMovementDetectionAgingFrames > 0)
+    {
+        const int32 Boost = ConsecutiveDeferrals / GAdvanceMovementDetectionAgingFrames;
+        Priority = static_cast<EMovementDetectionPriority>(FMath::Min(static_cast<int32>(Priority) + Boost, static_cast<int32>(EMovementDetectionPriority::High)));
+    }
+
+    return Priority;
 }
 
-FCharacterAbility* UAdvanceMovementComponent::GetOwnerAbility() const
+bool UAdvanceMovementComponent::RunBudgetedDetection(bool (UAdvanceMovementComponent::*Detect)())
 {
-    return OwnerAbility;
+    const UWorld* World = GetWorld();
+    UAdvanceMovementSubsystem* Subsystem = World ? World->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr;
+
+    if (Subsystem && !Subsystem->RequestDetectionSlot(EvaluateDetectionPriority()))
+    {
+        ++ConsecutiveDeferrals;
+        return false;
+    }
+
+    ConsecutiveDeferrals = 0;
+    return (this->*Detect)();
 }
 
+#pragma endregion
+
+#pragma region Utility
+
+float UAdvanceMovementComponent::DeltaSeconds()
+{
+    if (MovementDeltaSeconds > 0.0f)
+    {
+        return MovementDeltaSeconds;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        return World->GetDeltaSeconds();
+    }
+
+    return 0.0f;
+}
 
 #pragma endregion
 
-#pragma region CharacterAttribute
+#pragma region Owner
 
-void UAdvanceMovementComponent::SetOwnerAttribute(FCharacterAttribute* InAttribute)
+
+ACharacterModule* UAdvanceMovementComponent::GetOwnerCharacter() const
 {
-    if (InAttribute == nullptr)
+    if (OwnerCharacter != nullptr)
     {
         #if DEV_DEBUG_MODE
-        LOG_ERROR("Attempted to set OwnerAttribute to nullptr. Operation ignored.");
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("OwnerCharacter is already valid."));
         #endif
-        return;
+
+        return OwnerCharacter.Get();
     }
 
-    OwnerAttribute = InAttribute;
+    ACharacterModule* ResolvedOwner = Cast<ACharacterModule>(GetOwner());
+    if (!ResolvedOwner)
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("Failed to resolve owner as ACharacterModule");
+        #endif
+
+        return nullptr;
+    }
+
+    #if DEV_DEBUG_MODE
+    LOG_INFO("OwnerCharacter was null. Resolved and cached from GetOwner().");
+    #endif
+
+     Lazily cache the result (safe to cast away const here)
+    const_cast<UAdvanceMovementComponent*>(this)->OwnerCharacter = ResolvedOwner;
+    return ResolvedOwner;
+}
+
+
+
+void UAdvanceMovementComponent::SetOwnerCharacter(ACharacterModule* InOwnerCharacter)
+{
+    OwnerCharacter = InOwnerCharacter; 
 
 #if DEV_DEBUG_MODE
-    LOG_INFO("OwnerAttribute successfully updated.");
+    if (OwnerCharacter == nullptr)
+    {
+        LOG_ERROR("OwnerCharacter is null after SetOwnerCharacter call!");
+    }
+    else
+    {
+        LOG_INFO("OwnerCharacter is not null after SetOwnerCharacter call.");
+    }
 #endif
 }
 
-FCharacterAttribute* UAdvanceMovementComponent::GetOwnerAttribute() const
+#pragma endregion
+
+#pragma region OwnerData
+
+FCharacterData* UAdvanceMovementComponent::GetOwnerData() const
 {
-    return OwnerAttribute;
+    return OwnerData;
+}
+
+
+void UAdvanceMovementComponent::SetOwnerData(FCharacterData* InOwnerData)
+{
+    if (InOwnerData == nullptr)
+    {
+#if DEV_DEBUG_MODE
+        LOG_ERROR("Attempted to set OwnerData to nullptr, operation ignored.");
+#endif
+        return;
+    }
+
+    OwnerData = InOwnerData;
+
+    // New owner data carries its own ability unlocks.
+    NotifyMovementSignal(EMovementSignal::Ability);
+
+#if DEV_DEBUG_MODE
+    LOG_INFO("OwnerData reference successfully updated.");
+#endif
 }
 
+
+
 #pragma endregion
 
-#pragma region CharacterLevel
+#pragma region OwnerAbility
 
-void UAdvanceMovementComponent::SetOwnerLevel(FCharacterLevel* InLevel)
+void UAdvanceMovementComponent::UpdateCharacterAbility(FCharacterAbility* Ability)
 {
-    if (InLevel == nullptr)
+    if (!Ability)
     {
         #if DEV_DEBUG_MODE
-        LOG_ERROR("Attempted to set OwnerLevel to nullptr. Operation ignored.");
+        LOG_ERROR("");
         #endif
         return;
     }
 
-    OwnerLevel = InLevel;
+    // Locks and unlocks change what the Stance and Traversal guards accept.
+    NotifyMovementSignal(EMovementSignal::Ability);
 
-#if DEV_DEBUG_MODE
-    LOG_INFO("OwnerLevel successfully updated.");
-#endif
+    const FMovementAbility& MovementAbility = Ability->GetMovementAbility();
+
+    const FAbilityModule* SprintModule = MovementAbility.GetAbilities().Find(EMovementAbilityType::Sprint);
+    if (SprintModule && SprintModule->AbilityLocked())
+    {
+        if (MovementData.FindMovementModule(EMovementType::Sprint))
+        {
+            MovementData.SetModulePhase(EMovementType::Sprint, EMovementPhase::ReadyToAttempt);
+        }
+        else
+        {
+            #if DEV_DEBUG_MODE
+            LOG_ERROR("Sprint movement module not found.");
+            #endif
+
+        }
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Jump))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::DoubleJump))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::CoyoteJump))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Crouch))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Prone))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Roll))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Slide))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::WallRun))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::VerticalWallRun))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Hang))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Dash))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Teleport))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Vault))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Mantle))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Glide))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Swim))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Dive))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Hover))
+    {
+
+    }
+
+    if (MovementAbility.GetAbilities().Contains(EMovementAbilityType::Fly))
+    {
+
+    }
+
+}
+
+void UAdvanceMovementComponent::SetOwnerAbility(FCharacterAbility* InAbility)
+{
+    if (InAbility == nullptr)
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("Attempted to set OwnerAbility to nullptr. Operation ignored.");
+        #endif
+        return;
+    }
+
+    OwnerAbility = InAbility;
+    NotifyMovementSignal(EMovementSignal::Ability);
+
+    #if DEV_DEBUG_MODE
+    LOG_INFO("OwnerAbility successfully updated.");
+    #endif
+}
+
+FCharacterAbility* UAdvanceMovementComponent::GetOwnerAbility() const
+{
+    return OwnerAbility;
+}
+
+
+#pragma endregion
+
+#pragma region CharacterAttribute
+
+void UAdvanceMovementComponent::SetOwnerAttribute(FCharacterAttribute* InAttribute)
+{
+    if (InAttribute == nullptr)
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("Attempted to set OwnerAttribute to nullptr. Operation ignored.");
+        #endif
+        return;
+    }
+
+    OwnerAttribute = InAttribute;
+
+#if DEV_DEBUG_MODE
+    LOG_INFO("OwnerAttribute successfully updated.");
+#endif
+}
+
+FCharacterAttribute* UAdvanceMovementComponent::GetOwnerAttribute() const
+{
+    return OwnerAttribute;
+}
+
+#pragma endregion
+
+#pragma region CharacterLevel
+
+void UAdvanceMovementComponent::SetOwnerLevel(FCharacterLevel* InLevel)
+{
+    if (InLevel == nullptr)
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("Attempted to set OwnerLevel to nullptr. Operation ignored.");
+        #endif
+        return;
+    }
+
+    OwnerLevel = InLevel;
+
+#if DEV_DEBUG_MODE
+    LOG_INFO("OwnerLevel successfully updated.");
+#endif
+}
+
+FCharacterLevel* UAdvanceMovementComponent::GetOwnerLevel() const
+{
+    return OwnerLevel;
+}
+
+#pragma endregion
+
+#pragma region PlayerInputCache
+
+UPlayerInputCache* UAdvanceMovementComponent::GetPlayerInputCache() const
+{
+    return PlayerInputCache.Get();
+}
+
+void UAdvanceMovementComponent::SetPlayerInputCache(UPlayerInputCache* NewPlayerInputCache)
+{
+    PlayerInputCache = NewPlayerInputCache;
+
+#if DEV_DEBUG_MODE
+    if (PlayerInputCache == nullptr)
+    {
+        LOG_INFO("PlayerInputCache cleared (nullptr) in SetPlayerInputCache.");
+    }
+    else
+    {
+        LOG_INFO("PlayerInputCache updated.");
+    }
+#endif
+}
+
+#pragma endregion
+
+#pragma region MovementData
+
+FCharacterMovement& UAdvanceMovementComponent::GetMovementData()
+{
+    return MovementData;
+}
+
+const FCharacterMovement& UAdvanceMovementComponent::GetMovementData() const
+{
+    return MovementData;
+}
+
+void UAdvanceMovementComponent::SetMovementData(const FCharacterMovement& InMovement)
+{
+    MovementData = InMovement;
+}
+
+#pragma endregion
+
+#pragma region Switch
+
+void UAdvanceMovementComponent::SwitchMovement(EMovementType PreviousType, EMovementType CurrentType, EMovementSwitchReason Reason)
+{
+    RecordMovementSwitch(PreviousType, CurrentType, Reason);
+
+    switch (NetworkType)
+    {
+    case Local:
+        Local_DeactivateMovement(PreviousType);
+        Local_ActivateMovement(CurrentType);
+        break;
+
+    case Online:
+        // Predicted exactly like Local. The new type rides on the next saved move and the server applies it in MoveAutonomous.
+        Local_DeactivateMovement(PreviousType);
+        Local_ActivateMovement(CurrentType);
+        break;
+    }
+}
+
+#pragma endregion
+
+#pragma region NetworkPrediction
+
+FNetworkPredictionData_Client* UAdvanceMovementComponent::GetPredictionData_Client() const
+{
+    if (ClientPredictionData == nullptr)
+    {
+        UAdvanceMovementComponent* MutableThis = const_cast<UAdvanceMovementComponent*>(this);
+        MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Advance(*this);
+    }
+
+    return ClientPredictionData;
+}
+
+FAdvanceMovementPayload UAdvanceMovementComponent::MakeMovementPayload() const
+{
+    FAdvanceMovementPayload Payload;
+    Payload.Type = GetActiveMovementType();
+
+    if (FAdvanceMovementPayload::UsesDirection(Payload.Type))
+    {
+        const FVector Direction = Velocity.GetSafeNormal2D();
+        Payload.SetDirection(Direction.IsNearlyZero() && CharacterOwner ? CharacterOwner->GetActorForwardVector() : Direction);
+    }
+
+    if (FAdvanceMovementPayload::UsesTarget(Payload.Type))
+    {
+        switch (Payload.Type)
+        {
+        case EMovementType::Grappling:
+        case EMovementType::Zipline:
+            Payload.Target = TargetAnchor.Location;
+            break;
+
+        case EMovementType::Hang:
+        case EMovementType::Vault:
+        case EMovementType::Mantle:
+            Payload.Target = LedgeInfo.EdgePoint;
+            break;
+
+        case EMovementType::Teleport:
+            Payload.Target = Teleport ? Teleport->GetTargetLocation() : FVector::ZeroVector;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return Payload;
+}
+
+void UAdvanceMovementComponent::ApplyMovementPayload(const FAdvanceMovementPayload& Payload, EMovementSwitchReason Reason)
+{
+    const EMovementType PreviousType = GetActiveMovementType();
+    if (Payload.Type == PreviousType)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_NetworkSwitches);
+
+    const EMovementState State = MovementStateFromType(Payload.Type);
+
+    // Types without a legacy state only exist in the movement data.
+    if (State == EMovementState::Off)
+    {
+        MovementData.SetMovementType(Payload.Type);
+        SwitchMovement(PreviousType, Payload.Type, Reason);
+        return;
+    }
+
+    TGuardValue<EMovementSwitchReason> ReasonScope(SwitchReason, Reason);
+    SetMovementState(State);
+}
+
+void UAdvanceMovementComponent::RestoreMovementPayload(const FAdvanceMovementPayload& Payload, EMovementPhase Phase)
+{
+    if (!IsValidMovementTypeIndex(MovementTypeIndex(Payload.Type)))
+    {
+        return;
+    }
+
+    const EMovementState State = MovementStateFromType(Payload.Type);
+
+    if (State != EMovementState::Off && State != CurrentMovementState)
+    {
+        CurrentMovementState = State;
+
+        // Let the restored state's guards look at the world again on the next tick.
+        PendingSignals |= EMovementSignal::State;
+    }
+
+    MovementData.SetCurrentMovementType(Payload.Type);
+    MovementData.SetModulePhase(Payload.Type, Phase);
+}
+
+EMovementType UAdvanceMovementComponent::GetActiveMovementType() const
+{
+    // The legacy state machine is what actually runs; only types without a state (Zipline) come from the movement data.
+    const EMovementType StateType = MovementTypeFromState(CurrentMovementState);
+    return StateType != EMovementType::Null ? StateType : MovementData.GetCurrentMovementType();
+}
+
+EMovementPhase UAdvanceMovementComponent::GetCurrentMovementPhase() const
+{
+    const EMovementType Type = GetActiveMovementType();
+
+    return IsValidMovementTypeIndex(MovementTypeIndex(Type)) ? MovementData.GetModuleState(Type).GetPhase() : EMovementPhase::ReadyToAttempt;
+}
+
+void UAdvanceMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+    Super::UpdateFromCompressedFlags(Flags);
+
+    bClientMovementSwitched = (Flags & FSavedMove_Advance::FLAG_MovementSwitched) != 0;
+
+    // Server: the guards of a remote client run on the input flags that came with its move, not on a local input cache.
+    if (const FCharacterNetworkMoveData* MoveData = GetOwnerRole() == ROLE_Authority ? GetCurrentNetworkMoveData() : nullptr)
+    {
+        SetExternalInput(static_cast<const FAdvanceNetworkMoveData*>(MoveData)->InputBits);
+    }
+}
+
+void UAdvanceMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+    // Server: the client predicted its switch before simulating this move, so decide it here, with the move's compressed
+    // and movement input flags applied, before the move runs in whichever type the server settled on.
+    const FCharacterNetworkMoveData* MoveData = GetOwnerRole() == ROLE_Authority ? GetCurrentNetworkMoveData() : nullptr;
+
+    if (MoveData)
+    {
+        UpdateFromCompressedFlags(CompressedFlags);
+        ResolveClientSwitch(static_cast<const FAdvanceNetworkMoveData*>(MoveData)->MovementPayload);
+    }
+
+    const EMovementType SimulatedType = GetActiveMovementType();
+
+    Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+
+    if (MoveData && FMovementValidator::IsEnabled() && GetWorld())
+    {
+        SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_ValidateMove);
+
+        // Against the limits of the type the server just ran the move in.
+        MovementValidator.ValidateVelocity(GetValidationLimits(SimulatedType), Velocity, DeltaTime, GetWorld()->GetTimeSeconds());
+        EscalateAnomalies();
+    }
+}
+
+bool UAdvanceMovementComponent::ResolveClientSwitch(const FAdvanceMovementPayload& Requested)
+{
+    const EMovementType ServerType = GetActiveMovementType();
+    if (Requested.Type == ServerType)
+    {
+        return true;
+    }
+
+    if (ValidateClientPayload(Requested))
+    {
+        const FMovementTransitionGraph& Graph = GetMovementTransitionGraph();
+
+        // Run the server's own guard for the requested edge; it reads the server's detectors, not the client's payload.
+        if (Graph.IsAllowed(ServerType, Requested.Type))
+        {
+            const FMovementTransitionEdge& Edge = Graph.Matrix[MovementTypeIndex(ServerType)][MovementTypeIndex(Requested.Type)];
+
+            TGuardValue<EMovementSwitchReason> ReasonScope(SwitchReason, EMovementSwitchReason::Network);
+            (this->*Edge.Action)();
+        }
+
+        if (GetActiveMovementType() == Requested.Type)
+        {
+            INC_DWORD_STAT(STAT_AdvanceMovement_NetworkSwitches);
+            return true;
+        }
+    }
+
+    // Refused: the response of this move carries the server's type and the client rolls back to it.
+    INC_DWORD_STAT(STAT_AdvanceMovement_RejectedSwitches);
+    ForceClientCorrection();
+    return false;
+}
+
+FMovementValidationLimits UAdvanceMovementComponent::GetValidationLimits(EMovementType Type) const
+{
+    FMovementValidationLimits Limits;
+
+    if (!IsValidMovementTypeIndex(MovementTypeIndex(Type)) || !MovementData.GetMovementModules().IsValidIndex(MovementTypeIndex(Type)))
+    {
+        return Limits;
+    }
+
+    const FMovementModule& Module = MovementData.GetMovementModule(Type);
+    const FMovementAttribute& Attribute = Module.GetMovementAttributes();
+    const FMovementCost& Cost = Module.GetMovementCost();
+
+    Limits.MaximumSpeed    = Attribute.GetMaximumSpeed();
+    Limits.JumpImpulseMaxZ = Attribute.GetJumpImpulseMaxZ();
+    Limits.Cost            = Cost.GetStaminaCost() + Cost.GetEnergyCost();
+
+    const float CapsuleHeight = OwnerCapsuleComponent ? OwnerCapsuleComponent->GetScaledCapsuleHalfHeight() * 2.0f : 0.0f;
+
+    switch (Type)
+    {
+    case EMovementType::Teleport:
+        Limits.MaximumTargetDistance = Teleport ? Teleport->GetMaxDistance() : 0.0f;
+        break;
+
+    case EMovementType::Grappling:
+        Limits.MaximumTargetDistance = GAdvanceMovementGrappleRange + CapsuleHeight;
+        break;
+
+    case EMovementType::Zipline:
+        Limits.MaximumTargetDistance = GAdvanceMovementZiplineRange + CapsuleHeight;
+        break;
+
+    case EMovementType::Hang:
+    case EMovementType::Vault:
+    case EMovementType::Mantle:
+        Limits.MaximumTargetDistance = GAdvanceMovementLedgeReach + FMath::Max(GAdvanceMovementLedgeMaxAbove + CapsuleHeight, Mantle ? Mantle->GetMaximumHeight() : 0.0f);
+        break;
+
+    default:
+        break;
+    }
+
+    return Limits;
+}
+
+bool UAdvanceMovementComponent::ValidateClientPayload(const FAdvanceMovementPayload& Payload)
+{
+    if (!FMovementValidator::IsEnabled() || !GetWorld())
+    {
+        return true;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_ValidateMove);
+
+    float TargetDistance = -1.0f;
+    bool bTargetAnchored = true;
+
+    if (FAdvanceMovementPayload::UsesTarget(Payload.Type))
+    {
+        TargetDistance = FVector::Dist(GetActorLocation(), Payload.Target);
+
+        // Zipline and grapple targets must sit on a registered anchor; one hash lookup around the target.
+        if (Payload.Type == EMovementType::Grappling || Payload.Type == EMovementType::Zipline)
+        {
+            const UAdvanceMovementSubsystem* Subsystem = GetWorld()->GetSubsystem<UAdvanceMovementSubsystem>();
+
+            FMovementAnchorQuery Query;
+            Query.Origin = Payload.Target;
+            Query.Range  = 50.0f;
+            Query.Types  = Payload.Type == EMovementType::Grappling ? EMovementAnchorType::Grapple : EMovementAnchorType::Zipline;
+
+            bTargetAnchored = !Subsystem || Subsystem->FindNearestAnchor(Query) != nullptr;
+        }
+    }
+
+    const bool bValid = MovementValidator.ValidateSwitch(GetValidationLimits(Payload.Type), TargetDistance, bTargetAnchored, GetWorld()->GetTimeSeconds());
+
+    #if DEV_DEBUG_MODE
+    if (!bValid)
+    {
+        UE_LOG(LogAdvanceMovement, Warning, TEXT("%s: rejected switch to %s (anomaly score %.2f)."),
+            *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(Payload.Type), MovementValidator.GetAnomalyScore());
+    }
+    #endif
+
+    EscalateAnomalies();
+    return bValid;
+}
+
+void UAdvanceMovementComponent::EscalateAnomalies()
+{
+    if (MovementValidator.IsAboveKickThreshold() && !bKickPending)
+    {
+        APlayerController* PlayerController = CharacterOwner ? Cast<APlayerController>(CharacterOwner->GetController()) : nullptr;
+
+        if (PlayerController && GetWorld())
+        {
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("%s: kicking for movement anomalies (score %.2f, %u anomalies)."),
+                *GetNameSafe(GetOwner()), MovementValidator.GetAnomalyScore(), MovementValidator.GetAnomalyCount());
+
+            // Called from inside MoveAutonomous: kicking now would destroy the controller and pawn mid-move.
+            bKickPending = true;
+
+            const TWeakObjectPtr<APlayerController> WeakController(PlayerController);
+            const TWeakObjectPtr<UWorld> WeakWorld(GetWorld());
+
+            GetWorld()->GetTimerManager().SetTimerForNextTick([WeakController, WeakWorld]()
+            {
+                APlayerController* Controller = WeakController.Get();
+                const AGameModeBase* GameMode = WeakWorld.IsValid() ? WeakWorld->GetAuthGameMode() : nullptr;
+
+                if (Controller && GameMode && GameMode->GameSession)
+                {
+                    GameMode->GameSession->KickPlayer(Controller, NSLOCTEXT("AdvanceMovement", "MovementAnomalyKick", "Invalid movement."));
+                }
+            });
+        }
+    }
+
+    if (MovementValidator.IsAboveThreshold())
+    {
+        ForceClientCorrection();
+    }
+}
+
+void UAdvanceMovementComponent::ForceClientCorrection()
+{
+    if (FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character())
+    {
+        ServerData->bForceClientUpdate = true;
+        INC_DWORD_STAT(STAT_AdvanceMovement_ForcedCorrections);
+    }
+}
+
+void UAdvanceMovementComponent::ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse)
+{
+    if (!MoveResponse.IsGoodMove())
+    {
+        ++ClientCorrectionCount;
+        INC_DWORD_STAT(STAT_AdvanceMovement_ClientCorrections);
+
+        // Take the server's movement type and phase at the corrected time stamp; the replayed saved moves then restore their own.
+        const FAdvanceMoveResponseDataContainer& Response = static_cast<const FAdvanceMoveResponseDataContainer&>(MoveResponse);
+        RestoreMovementPayload(Response.MovementPayload, Response.MovementPhase);
+    }
+
+    Super::ClientHandleMoveResponse(MoveResponse);
+}
+
+float UAdvanceMovementComponent::GetClientCorrectionRate() const
+{
+    const UWorld* World = GetWorld();
+    const double Elapsed = World ? World->GetRealTimeSeconds() - ClientCorrectionWindowStart : 0.0;
+
+    return Elapsed > 0.0 ? static_cast<float>((ClientCorrectionCount * 60.0) / Elapsed) : 0.0f;
+}
+
+void UAdvanceMovementComponent::ResetClientCorrections()
+{
+    const UWorld* World = GetWorld();
+
+    ClientCorrectionCount       = 0;
+    ClientCorrectionWindowStart = World ? World->GetRealTimeSeconds() : 0.0;
+}
+
+#pragma endregion
+
+#pragma region History
+
+namespace AdvanceMovementHistory
+{
+    // One switch of any character, kept for the crash dump. Plain data so the dump needs no UObject access.
+    struct FCrashRecord
+    {
+        UAdvanceMovementComponent::FMovementSwitchRecord Record;
+        FName Owner;
+    };
+
+    // Most recent switches across all characters. Preallocated; writing and dumping never allocate.
+    static TMovementRingBuffer<FCrashRecord, 256> CrashRecords;
+}
+
+void UAdvanceMovementComponent::RecordMovementSwitch(EMovementType From, EMovementType To, EMovementSwitchReason Reason)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_RecordSwitch);
+
+    FMovementSwitchRecord Record;
+    Record.Frame    = GFrameCounter;
+    Record.Location = FVector3f(GetActorLocation());
+    Record.From     = From;
+    Record.To       = To;
+    Record.Reason   = Reason;
+
+    MovementHistory.Push(Record);
+
+    AdvanceMovementHistory::FCrashRecord CrashRecord;
+    CrashRecord.Record = Record;
+    CrashRecord.Owner  = GetOwner() ? GetOwner()->GetFName() : NAME_None;
+
+    AdvanceMovementHistory::CrashRecords.Push(CrashRecord);
+}
+
+void UAdvanceMovementComponent::DumpMovementHistory() const
+{
+    UE_LOG(LogAdvanceMovement, Display, TEXT("Movement history of %s: %u switches (%u recorded)"),
+        *GetNameSafe(GetOwner()),
+        MovementHistory.Num(),
+        MovementHistory.GetTotalPushed());
+
+    MovementHistory.ForEach([](const FMovementSwitchRecord& Record)
+    {
+        UE_LOG(LogAdvanceMovement, Display, TEXT("  [%llu] %s -> %s reason %d at %s"),
+            Record.Frame,
+            *UEnum::GetValueAsString(Record.From),
+            *UEnum::GetValueAsString(Record.To),
+            static_cast<int32>(Record.Reason),
+            *Record.Location.ToString());
+    });
+}
+
+#if !UE_BUILD_SHIPPING
+
+double UAdvanceMovementComponent::BenchmarkRecordMovementSwitch(int32 Iterations)
+{
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        const EMovementType From = static_cast<EMovementType>((Iteration % MovementTypeCount) + static_cast<int32>(EMovementType::Idle));
+        const EMovementType To   = static_cast<EMovementType>(((Iteration + 1) % MovementTypeCount) + static_cast<int32>(EMovementType::Idle));
+        RecordMovementSwitch(From, To, EMovementSwitchReason::Unspecified);
+    }
+    return FPlatformTime::Seconds() - Start;
+}
+
+#endif
+
+namespace AdvanceMovementHistory
+{
+    // Dumps the history of every live component, or only those whose owner name contains the filter.
+    static void DumpAll(const TArray<FString>& Args)
+    {
+        const FString Filter = Args.Num() > 0 ? Args[0] : FString();
+
+        for (TObjectIterator<UAdvanceMovementComponent> It; It; ++It)
+        {
+            const UAdvanceMovementComponent* Component = *It;
+            if (!Component || Component->IsTemplate())
+            {
+                continue;
+            }
+
+            if (!Filter.IsEmpty() && !GetNameSafe(Component->GetOwner()).Contains(Filter))
+            {
+                continue;
+            }
+
+            Component->DumpMovementHistory();
+        }
+    }
+
+    /**
+     * Writes the process-wide crash records straight to the low-level output.
+     * Runs inside the error handler, so it touches no UObject, builds no FString and formats into stack buffers only.
+     * Types and reasons are written as their enum values.
+     */
+    static void DumpOnSystemError()
+    {
+        TCHAR Line[256];
+        TCHAR OwnerName[NAME_SIZE];
+
+        FCString::Snprintf(Line, UE_ARRAY_COUNT(Line), TEXT("AdvanceMovement: last %u movement switches (%u recorded)\n"),
+            CrashRecords.Num(), CrashRecords.GetTotalPushed());
+        FPlatformMisc::LowLevelOutputDebugString(Line);
+
+        CrashRecords.ForEach([&Line, &OwnerName](const FCrashRecord& CrashRecord)
+        {
+            const UAdvanceMovementComponent::FMovementSwitchRecord& Record = CrashRecord.Record;
+            CrashRecord.Owner.ToString(OwnerName, UE_ARRAY_COUNT(OwnerName));
+
+            FCString::Snprintf(Line, UE_ARRAY_COUNT(Line), TEXT("  [%llu] %s: %d -> %d reason %d at (%.0f, %.0f, %.0f)\n"),
+                Record.Frame,
+                OwnerName,
+                static_cast<int32>(Record.From),
+                static_cast<int32>(Record.To),
+                static_cast<int32>(Record.Reason),
+                Record.Location.X, Record.Location.Y, Record.Location.Z);
+            FPlatformMisc::LowLevelOutputDebugString(Line);
+        });
+    }
+
+    static FAutoConsoleCommand DumpCommand
+    (
+        TEXT("AdvanceMovement.DumpHistory"),
+        TEXT("Logs the recent movement switches of every character. Usage: AdvanceMovement.DumpHistory [OwnerNameFilter]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&DumpAll)
+    );
+
+    // Writes the crash records to the low-level output when the engine reports a crash or fatal error.
+    static FDelayedAutoRegisterHelper RegisterCrashDump
+    (
+        EDelayedRegisterRunPhase::EndOfEngineInit,
+        []()
+        {
+            FCoreDelegates::OnHandleSystemError.AddStatic(&DumpOnSystemError);
+        }
+    );
+
+#if !UE_BUILD_SHIPPING
+
+    /**
+     * Measures the per-call cost of RecordMovementSwitch on a transient component, so no character's history is touched.
+     * Overwrites the crash records with the benchmark switches.
+     * Usage: AdvanceMovement.BenchmarkHistory [Iterations]
+     */
+    static void Benchmark(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+        UAdvanceMovementComponent* Component = NewObject<UAdvanceMovementComponent>(GetTransientPackage());
+        const double Seconds = Component->BenchmarkRecordMovementSwitch(Iterations);
+
+        UE_LOG(LogAdvanceMovement, Display, TEXT("AdvanceMovement history (%d switches): %.2f ns/switch"),
+            Iterations,
+            (Seconds * 1.0e9) / Iterations);
+    }
+
+    static FAutoConsoleCommand BenchmarkCommand
+    (
+        TEXT("AdvanceMovement.BenchmarkHistory"),
+        TEXT("Measures the per-call cost of RecordMovementSwitch, including the crash record it writes. Overwrites the crash records."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Benchmark)
+    );
+
+#endif
+}
+
+#pragma endregion
+
+#pragma region Dispatch
+
+#if !UE_BUILD_SHIPPING
+
+void UAdvanceMovementComponent::BenchmarkMovementDispatch(int32 Iterations, double& OutMapSeconds, double& OutTableSeconds)
+{
+    // Previous layout: one hash map entry and one capturing lambda per movement type, calling the same handlers.
+    TMap<EMovementType, TFunction<void()>> MapHandlers;
+    for (int32 Index = 0; Index < MovementTypeCount; ++Index)
+    {
+        const EMovementType Type = static_cast<EMovementType>(Index + static_cast<int32>(EMovementType::Idle));
+        if (const FMovementHandler Handler = GetMovementDispatchTable().Deactivate.Find(Type))
+        {
+            MapHandlers.Add(Type, [this, Handler]() { (this->*Handler)(); });
+        }
+    }
+
+    const double MapStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        const EMovementType Type = static_cast<EMovementType>((Iteration % MovementTypeCount) + static_cast<int32>(EMovementType::Idle));
+        if (const TFunction<void()>* Handler = MapHandlers.Find(Type))
+        {
+            (*Handler)();
+        }
+    }
+    OutMapSeconds = FPlatformTime::Seconds() - MapStart;
+
+    // Current layout: the class's shared table, looked up the way Local_DeactivateMovement does.
+    const double TableStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        const EMovementType Type = static_cast<EMovementType>((Iteration % MovementTypeCount) + static_cast<int32>(EMovementType::Idle));
+        if (const FMovementHandler Handler = GetMovementDispatchTable().Deactivate.Find(Type))
+        {
+            (this->*Handler)();
+        }
+    }
+    OutTableSeconds = FPlatformTime::Seconds() - TableStart;
+}
+
+namespace AdvanceMovementDispatchBenchmark
+{
+    /**
+     * Measures the per-call cost of the component's dispatch table against the previous TMap<EMovementType, TFunction> lookup,
+     * both calling the real Deactivate handlers of a transient component.
+     * Usage: AdvanceMovement.BenchmarkDispatch [Iterations]
+     */
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+        UAdvanceMovementComponent* Component = NewObject<UAdvanceMovementComponent>(GetTransientPackage());
+
+        double MapSeconds   = 0.0;
+        double TableSeconds = 0.0;
+        Component->BenchmarkMovementDispatch(Iterations, MapSeconds, TableSeconds);
+
+        UE_LOG(LogAdvanceMovement, Display, TEXT("AdvanceMovement dispatch (%d calls): TMap+TFunction %.2f ns/call, table %.2f ns/call"),
+            Iterations,
+            (MapSeconds * 1.0e9) / Iterations,
+            (TableSeconds * 1.0e9) / Iterations);
+    }
+
+    static FAutoConsoleCommand Command
+    (
+        TEXT("AdvanceMovement.BenchmarkDispatch"),
+        TEXT("Compares per-call movement dispatch cost of the TMap/TFunction layout and the component's handler table, on the real Deactivate handlers."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+    );
+}
+
+namespace AdvanceMovementMemoryReport
+{
+    /**
+     * Logs the movement module footprint of every live component, split into the hot per-tick block and the cold module block.
+     * "Per-tick bytes" is what one update handler touches: a whole module before the split, one hot state after it.
+     * Usage: AdvanceMovement.MemoryReport
+     */
+    static void Run()
+    {
+        const SIZE_T ColdModuleSize = sizeof(FMovementModule);
+        const SIZE_T HotStateSize   = sizeof(FMovementModuleState);
+
+        UE_LOG(LogAdvanceMovement, Display, TEXT("AdvanceMovement memory: FMovementModule %d bytes, FMovementModuleState %d bytes, per-tick bytes %d -> %d"),
+            static_cast<int32>(ColdModuleSize),
+            static_cast<int32>(HotStateSize),
+            static_cast<int32>(ColdModuleSize),
+            static_cast<int32>(HotStateSize));
+
+        int32 ComponentCount = 0;
+        for (TObjectIterator<UAdvanceMovementComponent> It; It; ++It)
+        {
+            const UAdvanceMovementComponent* Component = *It;
+            if (!Component || Component->IsTemplate())
+            {
+                continue;
+            }
+
+            const FCharacterMovement& Movement = Component->GetMovementData();
+            const SIZE_T ColdBytes = Movement.GetMovementModules().Num() * sizeof(FMovementModule);
+            const SIZE_T HotBytes  = Movement.GetModuleStates().GetAllocatedSize();
+
+            UE_LOG(LogAdvanceMovement, Display, TEXT("  %s: cold %d bytes, hot %d bytes, total %d bytes"),
+                *GetNameSafe(Component->GetOwner()),
+                static_cast<int32>(ColdBytes),
+                static_cast<int32>(HotBytes),
+                static_cast<int32>(ColdBytes + HotBytes));
+
+            ++ComponentCount;
+        }
+
+        UE_LOG(LogAdvanceMovement, Display, TEXT("AdvanceMovement memory: %d components"), ComponentCount);
+    }
+
+    static FAutoConsoleCommand Command
+    (
+        TEXT("AdvanceMovement.MemoryReport"),
+        TEXT("Logs per-character movement module memory, split into hot per-tick state and cold module data."),
+        FConsoleCommandDelegate::CreateStatic(&Run)
+    );
+}
+
+namespace AdvanceMovementProbeReport
+{
+    /**
+     * Logs how many environment queries each character answered from its frame cache and how many had to trace.
+     * Usage: AdvanceMovement.ProbeReport
+     */
+    static void Run()
+    {
+        uint64 TotalHits   = 0;
+        uint64 TotalMisses = 0;
+
+        for (TObjectIterator<UAdvanceMovementComponent> It; It; ++It)
+        {
+            const UAdvanceMovementComponent* Component = *It;
+            if (!Component || Component->IsTemplate())
+            {
+                continue;
+            }
+
+            const FMovementProbes& Probes = Component->GetEnvironmentProbes();
+            TotalHits   += Probes.GetCacheHits();
+            TotalMisses += Probes.GetCacheMisses();
+
+            UE_LOG(LogAdvanceMovement, Display, TEXT("  %s: %u cached, %u traced"),
+                *GetNameSafe(Component->GetOwner()),
+                Probes.GetCacheHits(),
+                Probes.GetCacheMisses());
+        }
+
+        const uint64 TotalQueries = TotalHits + TotalMisses;
+        UE_LOG(LogAdvanceMovement, Display, TEXT("AdvanceMovement probes: %llu queries, %llu traces saved (%.1f%%)"),
+            TotalQueries,
+            TotalHits,
+            TotalQueries > 0 ? 100.0 * static_cast<double>(TotalHits) / static_cast<double>(TotalQueries) : 0.0);
+    }
+
+    static FAutoConsoleCommand Command
+    (
+        TEXT("AdvanceMovement.ProbeReport"),
+        TEXT("Logs per-character environment probe cache hits and misses."),
+        FConsoleCommandDelegate::CreateStatic(&Run)
+    );
+}
+
+namespace AdvanceMovementNetReport
+{
+    /**
+     * Logs server corrections received by each locally controlled character and the rate per minute.
+     * To measure under lag, run a listen or dedicated server and a client as two processes, set
+     * NetEmulation.PktLag and NetEmulation.PktLoss on the client, play, then run this command there.
+     * Usage: AdvanceMovement.NetReport [reset]
+     */
+    static void Run(const TArray<FString>& Args)
+    {
+        const bool bReset = Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+
+        for (TObjectIterator<UAdvanceMovementComponent> It; It; ++It)
+        {
+            UAdvanceMovementComponent* Component = *It;
+            if (!Component || Component->IsTemplate() || !Component->GetWorld() || !Component->GetWorld()->IsGameWorld())
+            {
+                continue;
+            }
+
+            const APawn* Pawn = Cast<APawn>(Component->GetOwner());
+            if (!Pawn || !Pawn->IsLocallyControlled() || Pawn->HasAuthority())
+            {
+                continue;
+            }
+
+            if (bReset)
+            {
+                Component->ResetClientCorrections();
+                continue;
+            }
+
+            UE_LOG(LogAdvanceMovement, Display, TEXT("  %s: %u corrections, %.2f per minute"),
+                *GetNameSafe(Pawn),
+                Component->GetClientCorrectionCount(),
+                Component->GetClientCorrectionRate());
+        }
+    }
+
+    static FAutoConsoleCommand Command
+    (
+        TEXT("AdvanceMovement.NetReport"),
+        TEXT("Logs server corrections per locally controlled client character. Pass 'reset' to restart the count."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+    );
 }
 
-FCharacterLevel* UAdvanceMovementComponent::GetOwnerLevel() const
+namespace AdvanceMovementNetStateReport
 {
-    return OwnerLevel;
-}
+    /**
+     * Logs, per server-side character, the replicated movement bandwidth of the packed state against what replicating the whole
+     * FCharacterMovement on every change would cost. Run on the server after some play time.
+     * Usage: AdvanceMovement.NetStateReport
+     */
+    static void Run()
+    {
+        for (TObjectIterator<UAdvanceMovementComponent> It; It; ++It)
+        {
+            const UAdvanceMovementComponent* Component = *It;
+            const UWorld* World = Component ? Component->GetWorld() : nullptr;
 
-#pragma endregion
+            if (!Component || Component->IsTemplate() || !World || !World->IsGameWorld() || Component->GetOwnerRole() != ROLE_Authority)
+            {
+                continue;
+            }
 
-#pragma region PlayerInputCache
+            const double Elapsed = World->GetTimeSeconds() - Component->GetReplicatedStateStartTime();
+            if (Elapsed <= 0.0)
+            {
+                continue;
+            }
 
-UPlayerInputCache* UAdvanceMovementComponent::GetPlayerInputCache() const
-{
-    return PlayerInputCache.Get();
+            // Unversioned binary size of the whole movement struct: a lower bound on what replicating it would send per change.
+            TArray<uint8> FullBytes;
+            FMemoryWriter Writer(FullBytes);
+            FCharacterMovement::StaticStruct()->SerializeBin(Writer, const_cast<FCharacterMovement*>(&Component->GetMovementData()));
+
+            const FReplicatedMovementState& State = Component->GetReplicatedMovementState();
+            const double SendsPerSecond = State.SendCount / Elapsed;
+
+            // Both rates cover the same sends to every connection.
+            UE_LOG(LogAdvanceMovement, Display, TEXT("  %s: %.1f changes/s, %.1f sends/s, full struct %d bytes -> %.1f B/s, packed state %.1f B/s (max %d bytes per send)"),
+                *GetNameSafe(Component->GetOwner()),
+                State.ChangeCount / Elapsed,
+                SendsPerSecond,
+                FullBytes.Num(),
+                FullBytes.Num() * SendsPerSecond,
+                (State.BitsSent / 8.0) / Elapsed,
+                FReplicatedMovementState::GetMaxFullStateBytes());
+        }
+    }
+
+    static FAutoConsoleCommand Command
+    (
+        TEXT("AdvanceMovement.NetStateReport"),
+        TEXT("Logs per-character replicated movement state bytes per second, packed against the full movement struct."),
+        FConsoleCommandDelegate::CreateStatic(&Run)
+    );
 }
 
-void UAdvanceMovementComponent::SetPlayerInputCache(UPlayerInputCache* NewPlayerInputCache)
+namespace AdvanceMovementReplay
 {
-    PlayerInputCache = NewPlayerInputCache;
+    // Returns the Index-th advance movement component of the world, in object iteration order.
+    static UAdvanceMovementComponent* FindComponent(UWorld* World, int32 Index)
+    {
+        for (TObjectIterator<UAdvanceMovementComponent> It; It; ++It)
+        {
+            UAdvanceMovementComponent* Component = *It;
 
-#if DEV_DEBUG_MODE
-    if (PlayerInputCache == nullptr)
+            if (Component && !Component->IsTemplate() && Component->GetWorld() == World && Index-- == 0)
+            {
+                return Component;
+            }
+        }
+
+        UE_LOG(LogAdvanceMovement, Warning, TEXT("Movement replay: no advance movement component at that index."));
+        return nullptr;
+    }
+
+    static int32 ParseIndex(const TArray<FString>& Args, int32 ArgIndex)
     {
-        LOG_INFO("PlayerInputCache cleared (nullptr) in SetPlayerInputCache.");
+        return Args.IsValidIndex(ArgIndex) ? FMath::Max(0, FCString::Atoi(*Args[ArgIndex])) : 0;
     }
-    else
+
+    /**
+     * Starts recording a character's movement.
+     * Usage: AdvanceMovement.Replay.Record [ComponentIndex]
+     */
+    static void Record(const TArray<FString>& Args, UWorld* World)
     {
-        LOG_INFO("PlayerInputCache updated.");
+        if (UAdvanceMovementComponent* Component = FindComponent(World, ParseIndex(Args, 0)))
+        {
+            Component->StartReplayRecording();
+        }
     }
-#endif
-}
 
-#pragma endregion
+    /**
+     * Stops recording and writes the file, relative names going to Saved/MovementReplays.
+     * Usage: AdvanceMovement.Replay.Save <Name> [ComponentIndex]
+     */
+    static void Save(const TArray<FString>& Args, UWorld* World)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("Usage: AdvanceMovement.Replay.Save <Name> [ComponentIndex]"));
+            return;
+        }
 
-#pragma region MovementData
+        if (UAdvanceMovementComponent* Component = FindComponent(World, ParseIndex(Args, 1)))
+        {
+            Component->SaveReplayRecording(FMovementReplay::ResolveFilename(Args[0]));
+        }
+    }
 
-FCharacterMovement& UAdvanceMovementComponent::GetMovementData()
-{
-    return MovementData;
-}
+    /**
+     * Drives a character from a recorded file and logs divergence and per-state tick timings when it ends.
+     * Usage: AdvanceMovement.Replay.Play <Name> [ComponentIndex]
+     */
+    static void Play(const TArray<FString>& Args, UWorld* World)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("Usage: AdvanceMovement.Replay.Play <Name> [ComponentIndex]"));
+            return;
+        }
 
-const FCharacterMovement& UAdvanceMovementComponent::GetMovementData() const
-{
-    return MovementData;
-}
+        if (UAdvanceMovementComponent* Component = FindComponent(World, ParseIndex(Args, 1)))
+        {
+            Component->StartReplayPlayback(FMovementReplay::ResolveFilename(Args[0]));
+        }
+    }
 
-void UAdvanceMovementComponent::SetMovementData(const FCharacterMovement& InMovement)
-{
-    MovementData = InMovement;
-}
+    /**
+     * Ends recording without saving, or ends playback early and logs its report.
+     * Usage: AdvanceMovement.Replay.Stop [ComponentIndex]
+     */
+    static void Stop(const TArray<FString>& Args, UWorld* World)
+    {
+        if (UAdvanceMovementComponent* Component = FindComponent(World, ParseIndex(Args, 0)))
+        {
+            Component->StopReplay();
+        }
+    }
 
-#pragma endregion
+    static FAutoConsoleCommandWithWorldAndArgs RecordCommand
+    (
+        TEXT("AdvanceMovement.Replay.Record"),
+        TEXT("Records inputs, delta times and probe answers of a character's movement."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Record)
+    );
 
-#pragma region Switch
+    static FAutoConsoleCommandWithWorldAndArgs SaveCommand
+    (
+        TEXT("AdvanceMovement.Replay.Save"),
+        TEXT("Stops recording and writes the movement replay file."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Save)
+    );
 
-void UAdvanceMovementComponent::SwitchMovement(EMovementType PreviousType, EMovementType CurrentType)
-{
-    switch (NetworkType)
-    {
-    case Local:
-        Local_DeactivateMovement(PreviousType);
-        Local_ActivateMovement(CurrentType);
-        break;
+    static FAutoConsoleCommandWithWorldAndArgs PlayCommand
+    (
+        TEXT("AdvanceMovement.Replay.Play"),
+        TEXT("Plays a movement replay file back on a character and reports divergence and per-state tick cost."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Play)
+    );
 
-    case Online:
-        break;
-    }
+    static FAutoConsoleCommandWithWorldAndArgs StopCommand
+    (
+        TEXT("AdvanceMovement.Replay.Stop"),
+        TEXT("Stops movement replay recording or playback."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Stop)
+    );
 }
 
+#endif
+
 #pragma endregion
 
 #pragma region Activate
@@ -415,45 +2065,46 @@ void UAdvanceMovementComponent::SwitchMovement(EMovementType PreviousType, EMove
 
 
 
-void UAdvanceMovementComponent::InitializeActivateMovementHandlers()
-{
-    ActivateMovementHandlers.Add(Idle,                  [this]() { ActivateIdle(); });
-    ActivateMovementHandlers.Add(Walk,                  [this]() { ActivateWalk(); });
-    ActivateMovementHandlers.Add(Run,                   [this]() { ActivateRun(); });
-    ActivateMovementHandlers.Add(Sprint,                [this]() { ActivateSprint(); });
-    ActivateMovementHandlers.Add(EMovementType::Crouch, [this]() { ActivateCrouch(); });
-    ActivateMovementHandlers.Add(Prone,                 [this]() { ActivateProne(); });
-    ActivateMovementHandlers.Add(Crawl,                 [this]() { ActivateCrawl(); });
-    ActivateMovementHandlers.Add(Fall,                  [this]() { ActivateFall(); });
-    ActivateMovementHandlers.Add(Jump,                  [this]() { ActivateJump(); });
-    ActivateMovementHandlers.Add(Slide,                 [this]() { ActivateSlide(); });
-    ActivateMovementHandlers.Add(Roll,                  [this]() { ActivateRoll(); });
-    ActivateMovementHandlers.Add(WallRun,               [this]() { ActivateWallRun(); });
-    ActivateMovementHandlers.Add(VerticalWallRun,       [this]() { ActivateVerticalWallRun(); });
-    ActivateMovementHandlers.Add(Hang,                  [this]() { ActivateHang(); });
-    ActivateMovementHandlers.Add(Dash,                  [this]() { ActivateDash(); });
-    ActivateMovementHandlers.Add(Teleport,              [this]() { ActivateTeleport(); });
-    ActivateMovementHandlers.Add(Vault,                 [this]() { ActivateVault(); });
-    ActivateMovementHandlers.Add(Mantle,                [this]() { ActivateMantle(); });
-    ActivateMovementHandlers.Add(Glide,                 [this]() { ActivateGlide(); });
-    ActivateMovementHandlers.Add(EMovementType::Swim,   [this]() { ActivateSwim(); });
-    ActivateMovementHandlers.Add(Dive,                  [this]() { ActivateDive(); });
-    ActivateMovementHandlers.Add(Hover,                 [this]() { ActivateHover(); });
-    ActivateMovementHandlers.Add(Fly,                   [this]() { ActivateFly(); });
-    ActivateMovementHandlers.Add(Grappling,             [this]() { ActivateGrappling(); });
-    ActivateMovementHandlers.Add(Zipline,               [this]() { ActivateZipline(); });
+constexpr UAdvanceMovementComponent::FMovementHandlerTable UAdvanceMovementComponent::MakeActivateMovementHandlers()
+{
+    FMovementHandlerTable Table;
+
+    Table.Handlers[MovementTypeIndex(EMovementType::Idle)]            = &UAdvanceMovementComponent::ActivateIdle;
+    Table.Handlers[MovementTypeIndex(EMovementType::Walk)]            = &UAdvanceMovementComponent::ActivateWalk;
+    Table.Handlers[MovementTypeIndex(EMovementType::Run)]             = &UAdvanceMovementComponent::ActivateRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::Sprint)]          = &UAdvanceMovementComponent::ActivateSprint;
+    Table.Handlers[MovementTypeIndex(EMovementType::Crouch)]          = &UAdvanceMovementComponent::ActivateCrouch;
+    Table.Handlers[MovementTypeIndex(EMovementType::Prone)]           = &UAdvanceMovementComponent::ActivateProne;
+    Table.Handlers[MovementTypeIndex(EMovementType::Crawl)]           = &UAdvanceMovementComponent::ActivateCrawl;
+    Table.Handlers[MovementTypeIndex(EMovementType::Fall)]            = &UAdvanceMovementComponent::ActivateFall;
+    Table.Handlers[MovementTypeIndex(EMovementType::Jump)]            = &UAdvanceMovementComponent::ActivateJump;
+    Table.Handlers[MovementTypeIndex(EMovementType::Slide)]           = &UAdvanceMovementComponent::ActivateSlide;
+    Table.Handlers[MovementTypeIndex(EMovementType::Roll)]            = &UAdvanceMovementComponent::ActivateRoll;
+    Table.Handlers[MovementTypeIndex(EMovementType::WallRun)]         = &UAdvanceMovementComponent::ActivateWallRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::VerticalWallRun)] = &UAdvanceMovementComponent::ActivateVerticalWallRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::Hang)]            = &UAdvanceMovementComponent::ActivateHang;
+    Table.Handlers[MovementTypeIndex(EMovementType::Dash)]            = &UAdvanceMovementComponent::ActivateDash;
+    Table.Handlers[MovementTypeIndex(EMovementType::Teleport)]        = &UAdvanceMovementComponent::ActivateTeleport;
+    Table.Handlers[MovementTypeIndex(EMovementType::Vault)]           = &UAdvanceMovementComponent::ActivateVault;
+    Table.Handlers[MovementTypeIndex(EMovementType::Mantle)]          = &UAdvanceMovementComponent::ActivateMantle;
+    Table.Handlers[MovementTypeIndex(EMovementType::Glide)]           = &UAdvanceMovementComponent::ActivateGlide;
+    Table.Handlers[MovementTypeIndex(EMovementType::Swim)]            = &UAdvanceMovementComponent::ActivateSwim;
+    Table.Handlers[MovementTypeIndex(EMovementType::Dive)]            = &UAdvanceMovementComponent::ActivateDive;
+    Table.Handlers[MovementTypeIndex(EMovementType::Hover)]           = &UAdvanceMovementComponent::ActivateHover;
+    Table.Handlers[MovementTypeIndex(EMovementType::Fly)]             = &UAdvanceMovementComponent::ActivateFly;
+    Table.Handlers[MovementTypeIndex(EMovementType::Grappling)]       = &UAdvanceMovementComponent::ActivateGrappling;
+    Table.Handlers[MovementTypeIndex(EMovementType::Zipline)]         = &UAdvanceMovementComponent::ActivateZipline;
+
+    return Table;
 }
 
 void UAdvanceMovementComponent::ActivateIdle()
 {
-     Get a mutable reference to the module map
-    TMap<EMovementType, FMovementModule>& Modules = MovementData.GetMovementModules();
-
-     Try to find the Idle movement module
-    FMovementModule* Module = Modules.Find(Idle);
+    // Try to find the Idle movement module
+    FMovementModule* Module = MovementData.FindMovementModule(Idle);
 
-     Validate the module and on it
-    if (!Module || Module->Locked())
+    // Validate the module; the runtime lock lives in the hot state
+    if (!Module || MovementData.GetModuleState(EMovementType::Idle).Locked())
     {
         LOG_ERROR("Idle movement module is either missing or currently locked.");
         return;
@@ -469,15 +2120,15 @@ void UAdvanceMovementComponent::ActivateIdle()
         {
         case ECharacterType::Player:
             Progress.UpdateAttemptCount();
-            Progress.UpdateDuration(DeltaSeconds());
+            MovementData.GetModuleState(EMovementType::Idle).UpdateDuration(DeltaSeconds());
 
             if (SystemCore->GetMovementConfiguration().InterpolateMovementSpeedDisabled())
             {
                 MaxWalkSpeed = Attribute.GetDesiredSpeed();
             }
 
-            Module->SetMovementPhase(InProgress);
-            Module->SetMovementUpdate(Enabled);
+            MovementData.SetModulePhase(EMovementType::Idle, InProgress);
+            MovementData.SetModuleUpdate(EMovementType::Idle, Enabled);
             break;
         }
         
@@ -487,9 +2138,11 @@ void UAdvanceMovementComponent::ActivateIdle()
 
 void UAdvanceMovementComponent::Local_ActivateMovement(EMovementType Type)
 {
-    if (const TFunction<void()>* Handler = ActivateMovementHandlers.Find(Type))
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_ActivateDispatch);
+
+    if (const FMovementHandler Handler = GetMovementDispatchTable().Activate.Find(Type))
     {
-        (*Handler)();
+        (this->*Handler)();
     }
 #if DEV_DEBUG_MODE
     else
@@ -624,43 +2277,47 @@ void UAdvanceMovementComponent::ActivateZipline()
 
 #pragma region Update
 
-void UAdvanceMovementComponent::InitializeUpdateMovementHandlers()
-{
-    UpdateMovementHandlers.Add(EMovementType::Idle, [this]() { UpdateIdle(); });
-    UpdateMovementHandlers.Add(EMovementType::Walk, [this]() { UpdateWalk(); });
-    UpdateMovementHandlers.Add(EMovementType::Run, [this]() { UpdateRun(); });
-    UpdateMovementHandlers.Add(EMovementType::Sprint, [this]() { UpdateSprint(); });
-    UpdateMovementHandlers.Add(EMovementType::Crouch, [this]() { UpdateCrouch(); });
-    UpdateMovementHandlers.Add(EMovementType::Prone, [this]() { UpdateProne(); });
-    UpdateMovementHandlers.Add(EMovementType::Crawl, [this]() { UpdateCrawl(); });
-    UpdateMovementHandlers.Add(EMovementType::Fall, [this]() { UpdateFall(); });
-    UpdateMovementHandlers.Add(EMovementType::Jump, [this]() { UpdateJump(); });
-    UpdateMovementHandlers.Add(EMovementType::Slide, [this]() { UpdateSlide(); });
-    UpdateMovementHandlers.Add(EMovementType::Roll, [this]() { UpdateRoll(); });
-    UpdateMovementHandlers.Add(EMovementType::WallRun, [this]() { UpdateWallRun(); });
-    UpdateMovementHandlers.Add(EMovementType::VerticalWallRun, [this]() { UpdateVerticalWallRun(); });
-    UpdateMovementHandlers.Add(EMovementType::Hang, [this]() { UpdateHang(); });
-    UpdateMovementHandlers.Add(EMovementType::Dash, [this]() { UpdateDash(); });
-    UpdateMovementHandlers.Add(EMovementType::Teleport, [this]() { UpdateTeleport(); });
-    UpdateMovementHandlers.Add(EMovementType::Vault, [this]() { UpdateVault(); });
-    UpdateMovementHandlers.Add(EMovementType::Mantle, [this]() { UpdateMantle(); });
-    UpdateMovementHandlers.Add(EMovementType::Glide, [this]() { UpdateGlide(); });
-    UpdateMovementHandlers.Add(EMovementType::Swim, [this]() { UpdateSwim(); });
-    UpdateMovementHandlers.Add(EMovementType::Dive, [this]() { UpdateDive(); });
-    UpdateMovementHandlers.Add(EMovementType::Hover, [this]() { UpdateHover(); });
-    UpdateMovementHandlers.Add(EMovementType::Fly, [this]() { UpdateFly(); });
-    UpdateMovementHandlers.Add(EMovementType::Grappling, [this]() { UpdateGrappling(); });
-    UpdateMovementHandlers.Add(EMovementType::Zipline, [this]() { UpdateZipline(); });
+constexpr UAdvanceMovementComponent::FMovementHandlerTable UAdvanceMovementComponent::MakeUpdateMovementHandlers()
+{
+    FMovementHandlerTable Table;
+
+    Table.Handlers[MovementTypeIndex(EMovementType::Idle)]            = &UAdvanceMovementComponent::UpdateIdle;
+    Table.Handlers[MovementTypeIndex(EMovementType::Walk)]            = &UAdvanceMovementComponent::UpdateWalk;
+    Table.Handlers[MovementTypeIndex(EMovementType::Run)]             = &UAdvanceMovementComponent::UpdateRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::Sprint)]          = &UAdvanceMovementComponent::UpdateSprint;
+    Table.Handlers[MovementTypeIndex(EMovementType::Crouch)]          = &UAdvanceMovementComponent::UpdateCrouch;
+    Table.Handlers[MovementTypeIndex(EMovementType::Prone)]           = &UAdvanceMovementComponent::UpdateProne;
+    Table.Handlers[MovementTypeIndex(EMovementType::Crawl)]           = &UAdvanceMovementComponent::UpdateCrawl;
+    Table.Handlers[MovementTypeIndex(EMovementType::Fall)]            = &UAdvanceMovementComponent::UpdateFall;
+    Table.Handlers[MovementTypeIndex(EMovementType::Jump)]            = &UAdvanceMovementComponent::UpdateJump;
+    Table.Handlers[MovementTypeIndex(EMovementType::Slide)]           = &UAdvanceMovementComponent::UpdateSlide;
+    Table.Handlers[MovementTypeIndex(EMovementType::Roll)]            = &UAdvanceMovementComponent::UpdateRoll;
+    Table.Handlers[MovementTypeIndex(EMovementType::WallRun)]         = &UAdvanceMovementComponent::UpdateWallRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::VerticalWallRun)] = &UAdvanceMovementComponent::UpdateVerticalWallRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::Hang)]            = &UAdvanceMovementComponent::UpdateHang;
+    Table.Handlers[MovementTypeIndex(EMovementType::Dash)]            = &UAdvanceMovementComponent::UpdateDash;
+    Table.Handlers[MovementTypeIndex(EMovementType::Teleport)]        = &UAdvanceMovementComponent::UpdateTeleport;
+    Table.Handlers[MovementTypeIndex(EMovementType::Vault)]           = &UAdvanceMovementComponent::UpdateVault;
+    Table.Handlers[MovementTypeIndex(EMovementType::Mantle)]          = &UAdvanceMovementComponent::UpdateMantle;
+    Table.Handlers[MovementTypeIndex(EMovementType::Glide)]           = &UAdvanceMovementComponent::UpdateGlide;
+    Table.Handlers[MovementTypeIndex(EMovementType::Swim)]            = &UAdvanceMovementComponent::UpdateSwim;
+    Table.Handlers[MovementTypeIndex(EMovementType::Dive)]            = &UAdvanceMovementComponent::UpdateDive;
+    Table.Handlers[MovementTypeIndex(EMovementType::Hover)]           = &UAdvanceMovementComponent::UpdateHover;
+    Table.Handlers[MovementTypeIndex(EMovementType::Fly)]             = &UAdvanceMovementComponent::UpdateFly;
+    Table.Handlers[MovementTypeIndex(EMovementType::Grappling)]       = &UAdvanceMovementComponent::UpdateGrappling;
+    Table.Handlers[MovementTypeIndex(EMovementType::Zipline)]         = &UAdvanceMovementComponent::UpdateZipline;
+
+    return Table;
 }
 
 
 bool UAdvanceMovementComponent::IsUpdateEnabled(EMovementType Type)
 {
-    const TMap<EMovementType, FMovementModule>& Modules = MovementData.GetMovementModules();
+    const int32 Index = MovementTypeIndex(Type);
 
-    if (const FMovementModule* Module = Modules.Find(Type))
+    if (MovementData.GetModuleStates().IsValidIndex(Index))
     {
-        return Module->GetUpdate() == Enabled;
+        return MovementData.GetModuleStates()[Index].UpdateEnabled();
     }
 
 #if DEV_DEBUG_MODE
@@ -672,9 +2329,11 @@ bool UAdvanceMovementComponent::IsUpdateEnabled(EMovementType Type)
 
 void UAdvanceMovementComponent::Local_UpdateMovement(EMovementType Type)
 {
-    if (const TFunction<void()>* Handler = UpdateMovementHandlers.Find(Type))
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_UpdateDispatch);
+
+    if (const FMovementHandler Handler = GetMovementDispatchTable().Update.Find(Type))
     {
-        (*Handler)();
+        (this->*Handler)();
     }
 #if DEV_DEBUG_MODE
     else
@@ -686,14 +2345,11 @@ void UAdvanceMovementComponent::Local_UpdateMovement(EMovementType Type)
 
 void UAdvanceMovementComponent::UpdateIdle()
 {
-     Get a mutable reference to the module map
-    TMap<EMovementType, FMovementModule>& Modules = MovementData.GetMovementModules();
+    // Only the hot state is touched per tick; FX, cost and delegates stay in the cold module
+    FMovementModuleState& ModuleState = MovementData.GetModuleState(EMovementType::Idle);
 
-     Try to find the Idle movement module
-    FMovementModule* Module = Modules.Find(EMovementType::Idle);
-
-     Validate the module and update it
-    if (!Module || Module->UpdateDisabled())
+    // Validate the module and update it
+    if (ModuleState.UpdateDisabled())
     {
         #if DEV_DEBUG_MODE
         LOG_ERROR("");
@@ -702,9 +2358,6 @@ void UAdvanceMovementComponent::UpdateIdle()
         return;
     }
 
-    const FMovementAttribute& Attribute = Module->GetMovementAttributes();
-    FMovementProgress& Progress         = Module->GetMovementProgress(); 
-
     switch (GetOwnerType())
     {
     case ECharacterType::Player:
@@ -713,13 +2366,13 @@ void UAdvanceMovementComponent::UpdateIdle()
         {
         case ENetworkType::Local:
 
-            if (Module->IsInProgress())
+            if (ModuleState.IsInProgress())
             {
-                Progress.UpdateDuration(DeltaSeconds());
+                ModuleState.UpdateDuration(DeltaSeconds());
 
                 if (SystemCore->GetMovementConfiguration().InterpolateMovementSpeedEnabled())
                 {
-                    MaxWalkSpeed = FMath::FInterpTo(MaxWalkSpeed, Attribute.GetDesiredSpeed(), DeltaSeconds(), Attribute.GetInterpolationSpeed());
+                    MaxWalkSpeed = FMath::FInterpTo(MaxWalkSpeed, ModuleState.GetDesiredSpeed(), DeltaSeconds(), ModuleState.GetInterpolationSpeed());
                 }
 
                 if (OwnerData)
@@ -728,9 +2381,9 @@ void UAdvanceMovementComponent::UpdateIdle()
                 }
 
 
-                if (PlayerInputCache && PlayerInputCache->AnyMovementInputActive())
+                if (MovementInput.AnyMovementInputActive())
                 {
-                    if (PlayerInputCache->InputWalkHeld() || PlayerInputCache->InputWalkPressed() || SystemCore->GetMovementConfiguration().WalkEnabled())
+                    if (MovementInput.InputWalkHeld() || MovementInput.InputWalkPressed() || SystemCore->GetMovementConfiguration().WalkEnabled())
                     {
                         SwitchMovement(Walk);
                     }
@@ -747,7 +2400,7 @@ void UAdvanceMovementComponent::UpdateIdle()
 
     case ECharacterType::AI:
     {
-         TODO: Idle behavior for AI characters
+        // TODO: Idle behavior for AI characters
         break;
     }
 
@@ -757,11 +2410,6 @@ void UAdvanceMovementComponent::UpdateIdle()
 
 }
 
-void UAdvanceMovementComponent::UpdateIdle()
-{
-     TODO: Implement UpdateIdle logic
-}
-
 void UAdvanceMovementComponent::UpdateWalk()
 {
      TODO: Implement UpdateWalk logic
@@ -886,40 +2534,58 @@ void UAdvanceMovementComponent::UpdateZipline()
 
 #pragma region Deactivate
 
-void UAdvanceMovementComponent::InitializeDeactivateMovementHandlers()
-{
-    DeactivateMovementHandlers.Add(EMovementType::Idle,             [this]() { DeactivateIdle(); });
-    DeactivateMovementHandlers.Add(EMovementType::Walk,             [this]() { DeactivateWalk(); });
-    DeactivateMovementHandlers.Add(EMovementType::Run,              [this]() { DeactivateRun(); });
-    DeactivateMovementHandlers.Add(EMovementType::Sprint,           [this]() { DeactivateSprint(); });
-    DeactivateMovementHandlers.Add(EMovementType::Crouch,           [this]() { DeactivateCrouch(); });
-    DeactivateMovementHandlers.Add(EMovementType::Prone,            [this]() { DeactivateProne(); });
-    DeactivateMovementHandlers.Add(EMovementType::Crawl,            [this]() { DeactivateCrawl(); });
-    DeactivateMovementHandlers.Add(EMovementType::Fall,             [this]() { DeactivateFall(); });
-    DeactivateMovementHandlers.Add(EMovementType::Jump,             [this]() { DeactivateJump(); });
-    DeactivateMovementHandlers.Add(EMovementType::Slide,            [this]() { DeactivateSlide(); });
-    DeactivateMovementHandlers.Add(EMovementType::Roll,             [this]() { DeactivateRoll(); });
-    DeactivateMovementHandlers.Add(EMovementType::WallRun,          [this]() { DeactivateWallRun(); });
-    DeactivateMovementHandlers.Add(EMovementType::VerticalWallRun,  [this]() { DeactivateVerticalWallRun(); });
-    DeactivateMovementHandlers.Add(EMovementType::Hang,             [this]() { DeactivateHang(); });
-    DeactivateMovementHandlers.Add(EMovementType::Dash,             [this]() { DeactivateDash(); });
-    DeactivateMovementHandlers.Add(EMovementType::Teleport,         [this]() { DeactivateTeleport(); });
-    DeactivateMovementHandlers.Add(EMovementType::Vault,            [this]() { DeactivateVault(); });
-    DeactivateMovementHandlers.Add(EMovementType::Mantle,           [this]() { DeactivateMantle(); });
-    DeactivateMovementHandlers.Add(EMovementType::Glide,            [this]() { DeactivateGlide(); });
-    DeactivateMovementHandlers.Add(EMovementType::Swim,             [this]() { DeactivateSwim(); });
-    DeactivateMovementHandlers.Add(EMovementType::Dive,             [this]() { DeactivateDive(); });
-    DeactivateMovementHandlers.Add(EMovementType::Hover,            [this]() { DeactivateHover(); });
-    DeactivateMovementHandlers.Add(EMovementType::Fly,              [this]() { DeactivateFly(); });
-    DeactivateMovementHandlers.Add(EMovementType::Grappling,        [this]() { DeactivateGrappling(); });
-    DeactivateMovementHandlers.Add(EMovementType::Zipline,          [this]() { DeactivateZipline(); });
+constexpr UAdvanceMovementComponent::FMovementHandlerTable UAdvanceMovementComponent::MakeDeactivateMovementHandlers()
+{
+    FMovementHandlerTable Table;
+
+    Table.Handlers[MovementTypeIndex(EMovementType::Idle)]            = &UAdvanceMovementComponent::DeactivateIdle;
+    Table.Handlers[MovementTypeIndex(EMovementType::Walk)]            = &UAdvanceMovementComponent::DeactivateWalk;
+    Table.Handlers[MovementTypeIndex(EMovementType::Run)]             = &UAdvanceMovementComponent::DeactivateRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::Sprint)]          = &UAdvanceMovementComponent::DeactivateSprint;
+    Table.Handlers[MovementTypeIndex(EMovementType::Crouch)]          = &UAdvanceMovementComponent::DeactivateCrouch;
+    Table.Handlers[MovementTypeIndex(EMovementType::Prone)]           = &UAdvanceMovementComponent::DeactivateProne;
+    Table.Handlers[MovementTypeIndex(EMovementType::Crawl)]           = &UAdvanceMovementComponent::DeactivateCrawl;
+    Table.Handlers[MovementTypeIndex(EMovementType::Fall)]            = &UAdvanceMovementComponent::DeactivateFall;
+    Table.Handlers[MovementTypeIndex(EMovementType::Jump)]            = &UAdvanceMovementComponent::DeactivateJump;
+    Table.Handlers[MovementTypeIndex(EMovementType::Slide)]           = &UAdvanceMovementComponent::DeactivateSlide;
+    Table.Handlers[MovementTypeIndex(EMovementType::Roll)]            = &UAdvanceMovementComponent::DeactivateRoll;
+    Table.Handlers[MovementTypeIndex(EMovementType::WallRun)]         = &UAdvanceMovementComponent::DeactivateWallRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::VerticalWallRun)] = &UAdvanceMovementComponent::DeactivateVerticalWallRun;
+    Table.Handlers[MovementTypeIndex(EMovementType::Hang)]            = &UAdvanceMovementComponent::DeactivateHang;
+    Table.Handlers[MovementTypeIndex(EMovementType::Dash)]            = &UAdvanceMovementComponent::DeactivateDash;
+    Table.Handlers[MovementTypeIndex(EMovementType::Teleport)]        = &UAdvanceMovementComponent::DeactivateTeleport;
+    Table.Handlers[MovementTypeIndex(EMovementType::Vault)]           = &UAdvanceMovementComponent::DeactivateVault;
+    Table.Handlers[MovementTypeIndex(EMovementType::Mantle)]          = &UAdvanceMovementComponent::DeactivateMantle;
+    Table.Handlers[MovementTypeIndex(EMovementType::Glide)]           = &UAdvanceMovementComponent::DeactivateGlide;
+    Table.Handlers[MovementTypeIndex(EMovementType::Swim)]            = &UAdvanceMovementComponent::DeactivateSwim;
+    Table.Handlers[MovementTypeIndex(EMovementType::Dive)]            = &UAdvanceMovementComponent::DeactivateDive;
+    Table.Handlers[MovementTypeIndex(EMovementType::Hover)]           = &UAdvanceMovementComponent::DeactivateHover;
+    Table.Handlers[MovementTypeIndex(EMovementType::Fly)]             = &UAdvanceMovementComponent::DeactivateFly;
+    Table.Handlers[MovementTypeIndex(EMovementType::Grappling)]       = &UAdvanceMovementComponent::DeactivateGrappling;
+    Table.Handlers[MovementTypeIndex(EMovementType::Zipline)]         = &UAdvanceMovementComponent::DeactivateZipline;
+
+    return Table;
+}
+
+const UAdvanceMovementComponent::FMovementDispatchTable UAdvanceMovementComponent::MovementDispatchTable =
+{
+    MakeActivateMovementHandlers(),
+    MakeUpdateMovementHandlers(),
+    MakeDeactivateMovementHandlers()
+};
+
+const UAdvanceMovementComponent::FMovementDispatchTable& UAdvanceMovementComponent::GetMovementDispatchTable() const
+{
+    return MovementDispatchTable;
 }
 
 void UAdvanceMovementComponent::Local_DeactivateMovement(EMovementType Type)
 {
-    if (const TFunction<void()>* Handler = DeactivateMovementHandlers.Find(Type))
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_DeactivateDispatch);
+
+    if (const FMovementHandler Handler = GetMovementDispatchTable().Deactivate.Find(Type))
     {
-        (*Handler)();
+        (this->*Handler)();
     }
 #if DEV_DEBUG_MODE
     else
@@ -931,7 +2597,7 @@ void UAdvanceMovementComponent::Local_DeactivateMovement(EMovementType Type)
 
 void UAdvanceMovementComponent::DeactivateIdle()
 {
-
+    MovementData.CommitModuleState(EMovementType::Idle);
 }
 
 void UAdvanceMovementComponent::DeactivateWalk()
@@ -1054,6 +2720,20 @@ void UAdvanceMovementComponent::SetMovementState(EMovementState NewMovementState
 {
     PreviousMovementState = CurrentMovementState;
     CurrentMovementState = NewMovementState;
+
+    ADVANCE_MOVEMENT_TRACE(GetOwner(), PreviousMovementState, CurrentMovementState);
+    RecordMovementSwitch(MovementTypeFromState(PreviousMovementState), MovementTypeFromState(CurrentMovementState), SwitchReason);
+
+    // Mirror the state into the movement type the network payload, replication and replay read. No SwitchMovement:
+    // the Enter function calling this already did the switch's work.
+    const EMovementType NewType = MovementTypeFromState(CurrentMovementState);
+    if (NewType != EMovementType::Null && NewType != MovementData.GetCurrentMovementType())
+    {
+        MovementData.SetMovementType(NewType);
+    }
+
+    ++TransitionSerial;
+    PendingSignals |= EMovementSignal::State;
 }
 
 EMovementState UAdvanceMovementComponent::GetCurrentMovementState() const
@@ -1131,87 +2811,465 @@ void UAdvanceMovementComponent::SetMaxWalkSpeed(float NewSpeed)
 
 #pragma endregion
 
-#pragma region TickMovement
+#pragma region Signal
 
-void UAdvanceMovementComponent::TickMovement()
+void UAdvanceMovementComponent::RefreshMovementSignals()
 {
-    const auto CurrentType = MovementData.GetMovementType();
-    const auto CurrentState = MovementData.GetMovementState();
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_RefreshSignals);
 
-    switch (CurrentType)
+    // A client move (server) or a replay frame supplies the input while bExternalInput is set.
+    if (!bExternalInput)
     {
-    case EMovementType::Basic:
+        MovementInput.Bits = CaptureInputBits();
+    }
+
+    FMovementSignalSnapshot Snapshot;
+    Snapshot.InputBits  = MovementInput.Bits;
+    Snapshot.bGrounded  = IsMovingOnGround();
+    Snapshot.bInWater   = DetectWater();
+
+    if (CharacterData)
     {
-        switch (CurrentState)
-        {
-        case EMovementState::Idle:      TickIdleMovement();     break;
-        case EMovementState::Walk:      TickWalkMovement();     break;
-        case EMovementState::Run:       TickRunMovement();      break;
-        case EMovementState::Sprint:    TickSprintMovement();   break;
-        case EMovementState::Crouch:    TickCrouchMovement();   break;
-        case EMovementState::Prone:     TickProneMovement();    break;
-        case EMovementState::Crawl:     TickCrawlMovement();    break;
-        case EMovementState::Fall:      TickFallMovement();     break;
+        Snapshot.Stamina = CharacterData->CharacterAttribute.CharacterStat.GetStamina();
+        Snapshot.Health  = CharacterData->CharacterAttribute.CharacterStat.GetHealth();
+    }
 
-        default:
+    if (const AActor* Owner = GetOwner())
+    {
+        Snapshot.Location = Owner->GetActorLocation();
+    }
+
+    EMovementSignal Changed = PendingSignals | EMovementSignal::Progress;
+
+    if (Snapshot.InputBits != SignalSnapshot.InputBits)                            { Changed |= EMovementSignal::Input; }
+    if (Snapshot.Stamina != SignalSnapshot.Stamina)                                { Changed |= EMovementSignal::Stamina; }
+    if (Snapshot.Health != SignalSnapshot.Health)                                  { Changed |= EMovementSignal::Health; }
+    if (Snapshot.bGrounded != SignalSnapshot.bGrounded)                            { Changed |= EMovementSignal::Ground; }
+    if (Snapshot.bInWater != SignalSnapshot.bInWater)                              { Changed |= EMovementSignal::Water; }
+    if (!Snapshot.Location.Equals(SignalSnapshot.Location, KINDA_SMALL_NUMBER))    { Changed |= EMovementSignal::Environment; }
+
+    SignalSnapshot              = Snapshot;
+    DirtySignals                = Changed;
+    PendingSignals              = EMovementSignal::None;
+    TransitionChecksThisTick    = 0;
+}
+
+void UAdvanceMovementComponent::SetExternalInput(uint64 InputBits)
+{
+    MovementInput.Bits = InputBits;
+    bExternalInput     = true;
+}
+
+void UAdvanceMovementComponent::ClearExternalInput()
+{
+    bExternalInput = false;
+}
+
+uint64 UAdvanceMovementComponent::CaptureInputBits() const
+{
+    if (!PlayerInputCache)
+    {
+        return 0;
+    }
+
+    FMovementInputBits Input;
+    Input.Set(EMovementInput::AnyMovementInputActive, PlayerInputCache->AnyMovementInputActive());
+    Input.Set(EMovementInput::MovementInputsInActive, PlayerInputCache->MovementInputsInActive());
+    Input.Set(EMovementInput::WalkPressed,            PlayerInputCache->InputWalkPressed());
+    Input.Set(EMovementInput::WalkHeld,               PlayerInputCache->InputWalkHeld());
+    Input.Set(EMovementInput::WalkInActive,           PlayerInputCache->InputWalkInActive());
+    Input.Set(EMovementInput::SprintPressed,          PlayerInputCache->InputSprintPressed());
+    Input.Set(EMovementInput::SprintHeld,             PlayerInputCache->InputSprintHeld());
+    Input.Set(EMovementInput::SprintReleased,         PlayerInputCache->InputSprintReleased());
+    Input.Set(EMovementInput::SprintInActive,         PlayerInputCache->InputSprintInActive());
+    Input.Set(EMovementInput::CrouchPressed,          PlayerInputCache->InputCrouchPressed());
+    Input.Set(EMovementInput::CrouchHeld,             PlayerInputCache->InputCrouchHeld());
+    Input.Set(EMovementInput::CrouchReleased,         PlayerInputCache->InputCrouchReleased());
+    Input.Set(EMovementInput::CrouchInActive,         PlayerInputCache->InputCrouchInActive());
+    Input.Set(EMovementInput::PronePressed,           PlayerInputCache->InputPronePressed());
+    Input.Set(EMovementInput::ProneHeld,              PlayerInputCache->InputProneHeld());
+    Input.Set(EMovementInput::ProneReleased,          PlayerInputCache->InputProneReleased());
+    Input.Set(EMovementInput::ProneInActive,          PlayerInputCache->InputProneInActive());
+    Input.Set(EMovementInput::JumpPressed,            PlayerInputCache->InputJumpPressed());
+    Input.Set(EMovementInput::JumpHeld,               PlayerInputCache->InputJumpHeld());
+    Input.Set(EMovementInput::JumpReleased,           PlayerInputCache->InputJumpReleased());
+    Input.Set(EMovementInput::JumpInActive,           PlayerInputCache->InputJumpInActive());
+    Input.Set(EMovementInput::SlidePressed,           PlayerInputCache->InputSlidePressed());
+    Input.Set(EMovementInput::SlideHeld,              PlayerInputCache->InputSlideHeld());
+    Input.Set(EMovementInput::RollPressed,            PlayerInputCache->InputRollPressed());
+    Input.Set(EMovementInput::RollHeld,               PlayerInputCache->InputRollHeld());
+    Input.Set(EMovementInput::RollInActive,           PlayerInputCache->InputRollInActive());
+    Input.Set(EMovementInput::DashPressed,            PlayerInputCache->InputDashPressed());
+    Input.Set(EMovementInput::DashHeld,               PlayerInputCache->InputDashHeld());
+    Input.Set(EMovementInput::VaultPressed,           PlayerInputCache->InputVaultPressed());
+    Input.Set(EMovementInput::VaultHeld,              PlayerInputCache->InputVaultHeld());
+    Input.Set(EMovementInput::MantlePressed,          PlayerInputCache->InputMantlePressed());
+    Input.Set(EMovementInput::MantleHeld,             PlayerInputCache->InputMantleHeld());
+    Input.Set(EMovementInput::HangPressed,            PlayerInputCache->InputHangPressed());
+    Input.Set(EMovementInput::HangHeld,               PlayerInputCache->InputHangHeld());
+    Input.Set(EMovementInput::HangReleased,           PlayerInputCache->InputHangReleased());
+    Input.Set(EMovementInput::GlidePressed,           PlayerInputCache->InputGlidePressed());
+    Input.Set(EMovementInput::GlideHeld,              PlayerInputCache->InputGlideHeld());
+    Input.Set(EMovementInput::DivePressed,            PlayerInputCache->InputDivePressed());
+    Input.Set(EMovementInput::DiveHeld,               PlayerInputCache->InputDiveHeld());
+    Input.Set(EMovementInput::MoveForwardPressed,     PlayerInputCache->InputMoveForwardPressed());
+    Input.Set(EMovementInput::MoveForwardHeld,        PlayerInputCache->InputMoveForwardHeld());
+    Input.Set(EMovementInput::MoveForwardReleased,    PlayerInputCache->InputMoveForwardReleased());
+    Input.Set(EMovementInput::MoveForwardInActive,    PlayerInputCache->InputMoveForwardInActive());
+    Input.Set(EMovementInput::MoveBackwardPressed,    PlayerInputCache->InputMoveBackwardPressed());
+    Input.Set(EMovementInput::MoveBackwardHeld,       PlayerInputCache->InputMoveBackwardHeld());
+    Input.Set(EMovementInput::MoveLeftPressed,        PlayerInputCache->InputMoveLeftPressed());
+    Input.Set(EMovementInput::MoveLeftHeld,           PlayerInputCache->InputMoveLeftHeld());
+    Input.Set(EMovementInput::MoveRightPressed,       PlayerInputCache->InputMoveRightPressed());
+    Input.Set(EMovementInput::MoveRightHeld,          PlayerInputCache->InputMoveRightHeld());
+
+    return Input.Bits;
+}
+
+bool UAdvanceMovementComponent::EvaluateTransition(EMovementSignal Signals, FMovementHandler Transition)
+{
+    if (!EnumHasAnyFlags(DirtySignals, Signals | EMovementSignal::State))
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_TransitionSkips);
+        return false;
+    }
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_TransitionChecks);
+    ++TransitionChecksThisTick;
+
+    // A switch made by this guard is attributed to the signal that woke it up.
+    TGuardValue<EMovementSwitchReason> ReasonScope(SwitchReason, GetSwitchReason(DirtySignals & Signals));
+
+    const uint32 SerialBefore = TransitionSerial;
+    (this->*Transition)();
+
+    return TransitionSerial != SerialBefore;
+}
+
+EMovementSwitchReason UAdvanceMovementComponent::GetSwitchReason(EMovementSignal Signals)
+{
+    if (EnumHasAnyFlags(Signals, EMovementSignal::Input))
+    {
+        return EMovementSwitchReason::Input;
+    }
+
+    if (EnumHasAnyFlags(Signals, EMovementSignal::Stamina | EMovementSignal::Health | EMovementSignal::Ability))
+    {
+        return EMovementSwitchReason::Attribute;
+    }
+
+    if (EnumHasAnyFlags(Signals, EMovementSignal::Ground | EMovementSignal::Water | EMovementSignal::Environment))
+    {
+        return EMovementSwitchReason::Environment;
+    }
+
+    // Only State or Progress: the source state ran its course.
+    return EMovementSwitchReason::Completed;
+}
+
+void UAdvanceMovementComponent::NotifyMovementSignal(EMovementSignal Signals)
+{
+    PendingSignals |= Signals;
+}
+
+#pragma endregion
+
+#pragma region TransitionGraph
+
+TConstArrayView<UAdvanceMovementComponent::FMovementTransitionEdge> UAdvanceMovementComponent::GetMovementTransitionEdges()
+{
+    // Source, Target, Action, Priority (lower first), Signals, Required context, Excluded context
+    static const FMovementTransitionEdge Edges[] =
+    {
+        /* Idle */
+        { EMovementType::Idle, EMovementType::Swim, &UAdvanceMovementComponent::IdleToSwim, 0, TransitionSignal::Aquatic | EMovementSignal::Ability, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Walk, &UAdvanceMovementComponent::IdleToWalk, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Run, &UAdvanceMovementComponent::IdleToRun, 2, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Crouch, &UAdvanceMovementComponent::IdleToCrouch, 3, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Prone, &UAdvanceMovementComponent::IdleToProne, 4, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Crawl, &UAdvanceMovementComponent::IdleToCrawl, 5, TransitionSignal::Injury, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Jump, &UAdvanceMovementComponent::IdleToJump, 6, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Roll, &UAdvanceMovementComponent::IdleToRoll, 7, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Dash, &UAdvanceMovementComponent::IdleToDash, 8, TransitionSignal::Stance | EMovementSignal::Environment, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Idle, EMovementType::Fall, &UAdvanceMovementComponent::IdleToFall, 9, TransitionSignal::Airborne, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* Walk */
+        { EMovementType::Walk, EMovementType::Idle, &UAdvanceMovementComponent::WalkToIdle, 0, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Run, &UAdvanceMovementComponent::WalkToRun, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Sprint, &UAdvanceMovementComponent::WalkToSprint, 2, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Crouch, &UAdvanceMovementComponent::WalkToCrouch, 3, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Prone, &UAdvanceMovementComponent::WalkToProne, 4, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Crawl, &UAdvanceMovementComponent::WalkToCrawl, 5, TransitionSignal::Injury, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Jump, &UAdvanceMovementComponent::WalkToJump, 6, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Roll, &UAdvanceMovementComponent::WalkToRoll, 7, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Dash, &UAdvanceMovementComponent::WalkToDash, 8, TransitionSignal::Stance | EMovementSignal::Environment, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Vault, &UAdvanceMovementComponent::WalkToVault, 9, TransitionSignal::Traversal, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Swim, &UAdvanceMovementComponent::WalkToSwim, 10, TransitionSignal::Aquatic, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Walk, EMovementType::Fall, &UAdvanceMovementComponent::WalkToFall, 11, TransitionSignal::Airborne, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* Run */
+        { EMovementType::Run, EMovementType::Idle, &UAdvanceMovementComponent::RunToIdle, 0, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Walk, &UAdvanceMovementComponent::RunToWalk, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Sprint, &UAdvanceMovementComponent::RunToSprint, 2, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Crouch, &UAdvanceMovementComponent::RunToCrouch, 3, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Prone, &UAdvanceMovementComponent::RunToProne, 4, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Crawl, &UAdvanceMovementComponent::RunToCrawl, 5, TransitionSignal::Injury, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Jump, &UAdvanceMovementComponent::RunToJump, 6, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Slide, &UAdvanceMovementComponent::RunToSlide, 7, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Dash, &UAdvanceMovementComponent::RunToDash, 8, TransitionSignal::Stance | EMovementSignal::Environment, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Vault, &UAdvanceMovementComponent::RunToVault, 9, TransitionSignal::Traversal, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Swim, &UAdvanceMovementComponent::RunToSwim, 10, TransitionSignal::Aquatic, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Run, EMovementType::Fall, &UAdvanceMovementComponent::RunToFall, 11, TransitionSignal::Airborne, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* Sprint */
+        { EMovementType::Sprint, EMovementType::Idle, &UAdvanceMovementComponent::SprintToIdle, 0, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Walk, &UAdvanceMovementComponent::SprintToWalk, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Run, &UAdvanceMovementComponent::SprintToRun, 2, TransitionSignal::Locomotion | EMovementSignal::Stamina, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Prone, &UAdvanceMovementComponent::SprintToProne, 3, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Crawl, &UAdvanceMovementComponent::SprintToCrawl, 4, TransitionSignal::Injury, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Jump, &UAdvanceMovementComponent::SprintToJump, 5, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Slide, &UAdvanceMovementComponent::SprintToSlide, 6, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Roll, &UAdvanceMovementComponent::SprintToRoll, 7, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Dash, &UAdvanceMovementComponent::SprintToDash, 8, TransitionSignal::Stance | EMovementSignal::Environment, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Vault, &UAdvanceMovementComponent::SprintToVault, 9, TransitionSignal::Traversal, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Mantle, &UAdvanceMovementComponent::SprintToMantle, 10, TransitionSignal::Traversal, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Swim, &UAdvanceMovementComponent::SprintToSwim, 11, TransitionSignal::Aquatic, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Sprint, EMovementType::Fall, &UAdvanceMovementComponent::SprintToFall, 12, TransitionSignal::Airborne, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* Crawl */
+        { EMovementType::Crawl, EMovementType::Idle, &UAdvanceMovementComponent::CrawlToIdle, 0, TransitionSignal::Locomotion | EMovementSignal::Health, EMovementTransitionContext::Grounded | EMovementTransitionContext::Recovered, EMovementTransitionContext::None },
+        { EMovementType::Crawl, EMovementType::Crouch, &UAdvanceMovementComponent::CrawlToCrouch, 1, TransitionSignal::Stance | EMovementSignal::Health, EMovementTransitionContext::Grounded | EMovementTransitionContext::Recovered, EMovementTransitionContext::None },
+        { EMovementType::Crawl, EMovementType::Prone, &UAdvanceMovementComponent::CrawlToProne, 2, TransitionSignal::Stance | EMovementSignal::Health, EMovementTransitionContext::Grounded | EMovementTransitionContext::Recovered, EMovementTransitionContext::None },
+        { EMovementType::Crawl, EMovementType::Fall, &UAdvanceMovementComponent::CrawlToFall, 3, TransitionSignal::Airborne | EMovementSignal::Health, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* Crouch */
+        { EMovementType::Crouch, EMovementType::Idle, &UAdvanceMovementComponent::CrouchToIdle, 0, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Walk, &UAdvanceMovementComponent::CrouchToWalk, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Run, &UAdvanceMovementComponent::CrouchToRun, 2, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Jump, &UAdvanceMovementComponent::CrouchToJump, 3, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Slide, &UAdvanceMovementComponent::CrouchToSlide, 4, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Roll, &UAdvanceMovementComponent::CrouchToRoll, 5, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Prone, &UAdvanceMovementComponent::CrouchToProne, 6, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Crawl, &UAdvanceMovementComponent::CrouchToCrawl, 7, TransitionSignal::Injury, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Crouch, EMovementType::Fall, &UAdvanceMovementComponent::CrouchToFall, 8, TransitionSignal::Airborne, EMovementTransitionContext::Airborne | EMovementTransitionContext::Drop, EMovementTransitionContext::None },
+
+        /* Prone */
+        { EMovementType::Prone, EMovementType::Idle, &UAdvanceMovementComponent::ProneToIdle, 0, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Prone, EMovementType::Walk, &UAdvanceMovementComponent::ProneToWalk, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Prone, EMovementType::Run, &UAdvanceMovementComponent::ProneToRun, 2, TransitionSignal::Locomotion, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Prone, EMovementType::Roll, &UAdvanceMovementComponent::ProneToRoll, 3, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Prone, EMovementType::Crouch, &UAdvanceMovementComponent::ProneToCrouch, 4, TransitionSignal::Stance, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Prone, EMovementType::Crawl, &UAdvanceMovementComponent::ProneToCrawl, 5, TransitionSignal::Injury, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::Prone, EMovementType::Fall, &UAdvanceMovementComponent::ProneToFall, 7, TransitionSignal::Airborne, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* Fall */
+        { EMovementType::Fall, EMovementType::VerticalWallRun, &UAdvanceMovementComponent::FallToVerticalWallRun, 0, TransitionSignal::Traversal, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Idle, &UAdvanceMovementComponent::FallToIdle, 1, TransitionSignal::Locomotion, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Walk, &UAdvanceMovementComponent::FallToWalk, 2, TransitionSignal::Locomotion, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Run, &UAdvanceMovementComponent::FallToRun, 3, TransitionSignal::Locomotion, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Crouch, &UAdvanceMovementComponent::FallToCrouch, 4, TransitionSignal::Stance, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Slide, &UAdvanceMovementComponent::FallToSlide, 5, EMovementSignal::Input | EMovementSignal::Environment, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Roll, &UAdvanceMovementComponent::FallToRoll, 6, EMovementSignal::Input | EMovementSignal::Environment, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Crawl, &UAdvanceMovementComponent::FallToCrawl, 7, TransitionSignal::Injury, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Jump, &UAdvanceMovementComponent::FallToJump, 8, TransitionSignal::Stance | EMovementSignal::Health, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Fall, EMovementType::Hang, &UAdvanceMovementComponent::FallToHang, 9, TransitionSignal::Traversal, EMovementTransitionContext::None, EMovementTransitionContext::None },
+
+        /* Jump */
+        { EMovementType::Jump, EMovementType::Idle, &UAdvanceMovementComponent::JumpToIdle, 0, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Jump, EMovementType::Walk, &UAdvanceMovementComponent::JumpToWalk, 1, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Jump, EMovementType::Run, &UAdvanceMovementComponent::JumpToRun, 2, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Landed, EMovementTransitionContext::None },
+        { EMovementType::Jump, EMovementType::VerticalWallRun, &UAdvanceMovementComponent::JumpToVerticalWallRun, 3, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Jump, EMovementType::Mantle, &UAdvanceMovementComponent::JumpToMantle, 4, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Jump, EMovementType::Fall, &UAdvanceMovementComponent::JumpToFall, 5, TransitionSignal::Airborne | EMovementSignal::Progress, EMovementTransitionContext::Descending, EMovementTransitionContext::None },
+        { EMovementType::Jump, EMovementType::Hang, &UAdvanceMovementComponent::JumpToHang, 6, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::Descending },
+        { EMovementType::Jump, EMovementType::WallRun, &UAdvanceMovementComponent::JumpToWallRun, 7, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::Descending },
+
+        /* Slide */
+        { EMovementType::Slide, EMovementType::Fall, &UAdvanceMovementComponent::SlideToFall, 0, TransitionSignal::Airborne | EMovementSignal::Progress, EMovementTransitionContext::Exhausted | EMovementTransitionContext::Drop, EMovementTransitionContext::None },
+        { EMovementType::Slide, EMovementType::Idle, &UAdvanceMovementComponent::SlideToIdle, 1, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Exhausted, EMovementTransitionContext::Drop },
+        { EMovementType::Slide, EMovementType::Crouch, &UAdvanceMovementComponent::SlideToCrouch, 2, TransitionSignal::Stance | EMovementSignal::Progress, EMovementTransitionContext::Completed, EMovementTransitionContext::Exhausted },
+
+        /* WallRun */
+        { EMovementType::WallRun, EMovementType::Jump, &UAdvanceMovementComponent::WallRunToJump, 0, TransitionSignal::Stance | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::WallRun, EMovementType::Mantle, &UAdvanceMovementComponent::WallRunToMantle, 1, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::WallRun, EMovementType::Idle, &UAdvanceMovementComponent::WallRunToIdle, 2, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::WallRun, EMovementType::Walk, &UAdvanceMovementComponent::WallRunToWalk, 3, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::WallRun, EMovementType::Run, &UAdvanceMovementComponent::WallRunToRun, 4, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Grounded, EMovementTransitionContext::None },
+        { EMovementType::WallRun, EMovementType::Fall, &UAdvanceMovementComponent::WallRunToFall, 5, TransitionSignal::Airborne | EMovementSignal::Progress, EMovementTransitionContext::Airborne, EMovementTransitionContext::None },
+
+        /* VerticalWallRun */
+        { EMovementType::VerticalWallRun, EMovementType::Hang, &UAdvanceMovementComponent::VerticalWallRunToHang, 0, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::VerticalWallRun, EMovementType::Mantle, &UAdvanceMovementComponent::VerticalWallRunToMantle, 1, TransitionSignal::Traversal | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::VerticalWallRun, EMovementType::Fall, &UAdvanceMovementComponent::VerticalWallRunToFall, 2, TransitionSignal::Airborne | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::VerticalWallRun, EMovementType::Jump, &UAdvanceMovementComponent::VerticalWallRunToJump, 3, TransitionSignal::Stance | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+
+        /* Hang */
+        { EMovementType::Hang, EMovementType::Jump, &UAdvanceMovementComponent::HangToJump, 0, TransitionSignal::Stance | EMovementSignal::Progress | EMovementSignal::Health, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Hang, EMovementType::Mantle, &UAdvanceMovementComponent::HangToMantle, 1, TransitionSignal::Traversal | EMovementSignal::Progress | EMovementSignal::Health, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Hang, EMovementType::Fall, &UAdvanceMovementComponent::HangToFall, 2, TransitionSignal::Airborne | EMovementSignal::Progress | EMovementSignal::Health, EMovementTransitionContext::None, EMovementTransitionContext::None },
+
+        /* Teleport */
+        { EMovementType::Teleport, EMovementType::Crawl, &UAdvanceMovementComponent::TeleportToCrawl, 0, TransitionSignal::Injury | EMovementSignal::Progress, EMovementTransitionContext::None, EMovementTransitionContext::None },
+        { EMovementType::Teleport, EMovementType::Fall, &UAdvanceMovementComponent::TeleportToFall, 1, TransitionSignal::Airborne | EMovementSignal::Progress, EMovementTransitionContext::Completed | EMovementTransitionContext::Drop, EMovementTransitionContext::None },
+        { EMovementType::Teleport, EMovementType::Idle, &UAdvanceMovementComponent::TeleportToIdle, 2, TransitionSignal::Locomotion | EMovementSignal::Progress, EMovementTransitionContext::Completed, EMovementTransitionContext::Drop },
+    };
+
+    return Edges;
+}
+
+void UAdvanceMovementComponent::FMovementTransitionGraph::Add(const FMovementTransitionEdge& Edge)
+{
+    const int32 SourceIndex = MovementTypeIndex(Edge.Source);
+    const int32 TargetIndex = MovementTypeIndex(Edge.Target);
+
+    if (!IsValidMovementTypeIndex(SourceIndex) || !IsValidMovementTypeIndex(TargetIndex) || !Edge.Action)
+    {
         #if DEV_DEBUG_MODE
-        LOG_WARNING("TickMovement Basic: Unhandled movement state.");
+        LOG_ERROR("Transition edge ignored: invalid source, target or action.");
         #endif
-        break;
-        }
-        break;
+        return;
     }
 
-    case EMovementType::Special:
+    #if DEV_DEBUG_MODE
+    if (Matrix[SourceIndex][TargetIndex].Action)
     {
-        switch (CurrentState)
-        {
-        case EMovementState::Jump:              TickJumpMovement();             break;
-        case EMovementState::Slide:             TickSlideMovement();            break;
-        case EMovementState::Roll:              TickRollMovement();             break;
-        case EMovementState::WallRun:           TickWallRunMovement();          break;
-        case EMovementState::VerticalWallRun:   TickVerticalWallRunMovement();  break;
-        case EMovementState::Hang:              TickHangMovement();             break;
-        case EMovementState::Dash:              TickDashMovement();             break;
-        case EMovementState::Teleport:          TickTeleportMovement();         break;
+        LOG_WARNING("Transition edge declared twice for the same source and target. The later declaration wins.");
+    }
+    #endif
 
-        default:
-            #if DEV_DEBUG_MODE
-            LOG_WARNING("TickMovement Special: Unhandled movement state.");
-            #endif
-            break;
+    Matrix[SourceIndex][TargetIndex] = Edge;
+}
+
+void UAdvanceMovementComponent::FMovementTransitionGraph::Finalize()
+{
+    for (int32 SourceIndex = 0; SourceIndex < MovementTypeCount; ++SourceIndex)
+    {
+        uint8 Count = 0;
+
+        for (int32 TargetIndex = 0; TargetIndex < MovementTypeCount; ++TargetIndex)
+        {
+            if (Matrix[SourceIndex][TargetIndex].Action)
+            {
+                Order[SourceIndex][Count++] = static_cast<uint8>(TargetIndex);
+            }
         }
-        break;
+
+        const FMovementTransitionEdge* Row = Matrix[SourceIndex];
+        Algo::StableSortBy(MakeArrayView(Order[SourceIndex], Count), [Row](uint8 TargetIndex) { return Row[TargetIndex].Priority; });
+
+        OrderCount[SourceIndex] = Count;
     }
+}
+
+bool UAdvanceMovementComponent::FMovementTransitionGraph::IsAllowed(EMovementType Source, EMovementType Target) const
+{
+    const int32 SourceIndex = MovementTypeIndex(Source);
+    const int32 TargetIndex = MovementTypeIndex(Target);
 
-    case EMovementType::Advance:
+    return IsValidMovementTypeIndex(SourceIndex) && IsValidMovementTypeIndex(TargetIndex) && Matrix[SourceIndex][TargetIndex].Action;
+}
+
+const UAdvanceMovementComponent::FMovementTransitionGraph& UAdvanceMovementComponent::GetMovementTransitionGraph() const
+{
+    static const FMovementTransitionGraph Graph = []()
     {
-        switch (CurrentState)
+        FMovementTransitionGraph Compiled;
+
+        for (const FMovementTransitionEdge& Edge : GetMovementTransitionEdges())
         {
-        case EMovementState::Vault:     TickVaultMovement();        break;
-        case EMovementState::Mantle:    TickMantleMovement();       break;
-        case EMovementState::Glide:     TickGlideMovement();        break;
-        case EMovementState::Swim:      TickSwimMovement();         break;
-        case EMovementState::Dive:      TickDiveMovement();         break;
-        case EMovementState::Hover:     TickHoverMovement();        break;
-        case EMovementState::Fly:       TickFlyMovement();          break;
-        case EMovementState::Grappling: TickGrapplingMovement();    break;
+            Compiled.Add(Edge);
+        }
 
-        default:
-            #if DEV_DEBUG_MODE
-            LOG_WARNING("TickMovement Advance: Unhandled movement state.");
-            #endif
+        Compiled.Finalize();
+        return Compiled;
+    }();
+
+    return Graph;
+}
+
+bool UAdvanceMovementComponent::EvaluateTransitions(EMovementType Source, EMovementTransitionContext Context, uint8 MinPriority, uint8 MaxPriority)
+{
+    const int32 SourceIndex = MovementTypeIndex(Source);
+
+    if (!IsValidMovementTypeIndex(SourceIndex))
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("EvaluateTransitions called with an invalid source movement type.");
+        #endif
+        return false;
+    }
+
+    Context |= IsMovingOnGround() ? EMovementTransitionContext::Grounded : EMovementTransitionContext::Airborne;
+
+    const FMovementTransitionGraph& Graph = GetMovementTransitionGraph();
+
+    for (uint8 OrderIndex = 0; OrderIndex < Graph.OrderCount[SourceIndex]; ++OrderIndex)
+    {
+        const FMovementTransitionEdge& Edge = Graph.Matrix[SourceIndex][Graph.Order[SourceIndex][OrderIndex]];
+
+        // Order is sorted by priority, so nothing after an edge above the band can be inside it.
+        if (Edge.Priority > MaxPriority)
+        {
             break;
         }
-        break;
+
+        if (Edge.Priority < MinPriority || !EnumHasAllFlags(Context, Edge.Required) || EnumHasAnyFlags(Context, Edge.Excluded))
+        {
+            continue;
+        }
+
+        if (EvaluateTransition(Edge.Signals, Edge.Action))
+        {
+            return true;
+        }
     }
 
-    case EMovementType::Null:
-    case EMovementType::Max:
+    return false;
+}
+
+#pragma endregion
+
+#pragma region TickMovement
+
+void UAdvanceMovementComponent::TickMovement()
+{
+    RefreshMovementSignals();
+
+    switch (CurrentMovementState)
+    {
+    /* Basic */
+    case EMovementState::Idle:              TickIdleMovement();             break;
+    case EMovementState::Walk:              TickWalkMovement();             break;
+    case EMovementState::Run:               TickRunMovement();              break;
+    case EMovementState::Sprint:            TickSprintMovement();           break;
+    case EMovementState::Crouch:            TickCrouchMovement();           break;
+    case EMovementState::Prone:             TickProneMovement();            break;
+    case EMovementState::Crawl:             TickCrawlMovement();            break;
+    case EMovementState::Fall:              TickFallMovement();             break;
+
+    /* Special */
+    case EMovementState::Jump:              TickJumpMovement();             break;
+    case EMovementState::Slide:             TickSlideMovement();            break;
+    case EMovementState::Roll:              TickRollMovement();             break;
+    case EMovementState::WallRun:           TickWallRunMovement();          break;
+    case EMovementState::VerticalWallRun:   TickVerticalWallRunMovement();  break;
+    case EMovementState::Hang:              TickHangMovement();             break;
+    case EMovementState::Dash:              TickDashMovement();             break;
+    case EMovementState::Teleport:          TickTeleportMovement();         break;
+
+    /* Advance */
+    case EMovementState::Vault:             TickVaultMovement();            break;
+    case EMovementState::Mantle:            TickMantleMovement();           break;
+    case EMovementState::Glide:             TickGlideMovement();            break;
+    case EMovementState::Swim:              TickSwimMovement();             break;
+    case EMovementState::Dive:              TickDiveMovement();             break;
+    case EMovementState::Hover:             TickHoverMovement();            break;
+    case EMovementState::Fly:               TickFlyMovement();              break;
+    case EMovementState::Grappling:         TickGrapplingMovement();        break;
 
     default:
         #if DEV_DEBUG_MODE
-        LOG_WARNING("TickMovement: Invalid or unhandled movement type.");
+        LOG_WARNING("TickMovement: Unhandled movement state.");
         #endif
         break;
     }
@@ -1306,9 +3364,13 @@ void UAdvanceMovementComponent::SetOwnerCapsuleComponent(TObjectPtr<UCapsuleComp
         return;
     }
 
+    UnbindWaterEvents();
+
     // Assign the new capsule component
     OwnerCapsuleComponent = InComp; 
 
+    BindWaterEvents();
+
     #if DEV_DEBUG_MODE
     LOG_INFO("OwnerCapsuleComponent has been set successfully.");
     #endif
@@ -1400,334 +3462,731 @@ float UAdvanceMovementComponent::PerformWallHeightTrace()
 
     // Perform forward trace to detect wall base
     FHitResult ForwardHit;
-    if (World->LineTraceSingleByChannel(ForwardHit, TraceStart, TraceEnd, ECC_Visibility, QueryParams))
+    if (EnvironmentProbes.LineTrace(World, MakeMovementProbeKey(EMovementProbe::WallBase), ForwardHit, TraceStart, TraceEnd, ECC_Visibility, QueryParams))
     {
         const FVector WallBase = ForwardHit.ImpactPoint;
         const FVector UpTraceEnd = WallBase + FVector(0.f, 0.f, MaximumWallHeight);
 
         // Perform upward trace from wall base to measure wall height
         FHitResult UpHit;
-        if (World->LineTraceSingleByChannel(UpHit, WallBase, UpTraceEnd, ECC_Visibility, QueryParams))
+        if (EnvironmentProbes.LineTrace(World, MakeMovementProbeKey(EMovementProbe::WallHeight), UpHit, WallBase, UpTraceEnd, ECC_Visibility, QueryParams))
         {
             return (UpHit.ImpactPoint - WallBase).Size();
         }
 
-        // Return max wall height if upward trace does not hit
-        return MaximumWallHeight;
+        // Return max wall height if upward trace does not hit
+        return MaximumWallHeight;
+    }
+
+    // Return -1 if no wall is detected in front
+    return -1.f;
+}
+
+float UAdvanceMovementComponent::PerformGroundDistanceTrace()
+{
+    if (!GetOwner() || !OwnerCapsuleComponent)
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("OwnerCapsuleComponent or Owner invalid.");
+        #endif
+        return -1.0f;
+    }
+
+    const FVector CapsuleLocation = OwnerCapsuleComponent->GetComponentLocation();
+    const float CapsuleHalfHeight = OwnerCapsuleComponent->GetUnscaledCapsuleHalfHeight();
+
+    // Adjust start location slightly below capsule bottom to avoid self-collision
+    const FVector StartLocation = CapsuleLocation - FVector(0.0f, 0.0f, CapsuleHalfHeight + 2.10f);
+    const FVector EndLocation   = StartLocation - FVector(0.0f, 0.0f, 10000.0f);
+
+
+    FHitResult GroundHit;
+    FCollisionQueryParams QueryParams(FName(TEXT("GroundDistanceTrace")), false, GetOwner());
+    QueryParams.AddIgnoredActor(GetOwner());
+    QueryParams.AddIgnoredComponent(OwnerCapsuleComponent);
+
+    const bool bHit = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::GroundDistance), GroundHit, StartLocation, EndLocation, ECC_Visibility, QueryParams);
+
+
+    #if DEV_DEBUG_MODE
+    if (bActivateDebug)
+    {
+        DrawDebugLine(GetWorld(), StartLocation, EndLocation, bHit ? FColor::Green : FColor::Red, false, 1.0f, 0, 2.0f);
+    }
+    #endif
+
+    return bHit ? GroundHit.Distance : -1.0f;
+}
+
+bool UAdvanceMovementComponent::IsFrontWallDetected(float InTraceDistance)
+{
+    // Early out if essential components are missing
+    if (!OwnerCapsuleComponent || !GetWorld())
+    {
+        return false;
+    }
+
+    // Get capsule location and forward direction
+    const FVector CapsuleLocation   = OwnerCapsuleComponent->GetComponentLocation();
+    const FVector ForwardVector     = OwnerCapsuleComponent->GetForwardVector();
+
+    // Capsule dimensions
+    const float CapsuleHalfHeight   = OwnerCapsuleComponent->GetScaledCapsuleHalfHeight();
+    const float CapsuleRadius       = OwnerCapsuleComponent->GetScaledCapsuleRadius();
+
+    // Trace parameters
+    const float TraceDistance = InTraceDistance;
+    FCollisionQueryParams TraceParams(FName(TEXT("FrontWallTrace")), false, GetOwner());
+    TraceParams.AddIgnoredActor(GetOwner());
+    TraceParams.AddIgnoredComponent(OwnerCapsuleComponent);
+    TraceParams.bIgnoreTouches = true;
+
+    // Collision channel: only detect static geometry
+    const ECollisionChannel CollisionChannel = ECC_WorldStatic;
+
+    // Define three trace start positions (mid, top, bottom)
+    const FVector TraceStartMid     = CapsuleLocation + ForwardVector * CapsuleRadius;
+    const FVector TraceStartTop     = TraceStartMid + FVector(0.0f, 0.0f, CapsuleHalfHeight * 0.9f);
+    const FVector TraceStartBottom  = TraceStartMid - FVector(0.0f, 0.0f, CapsuleHalfHeight * 0.9f);
+
+    // Define end points
+    const FVector TraceEndMid       = TraceStartMid + ForwardVector * TraceDistance;
+    const FVector TraceEndTop       = TraceStartTop + ForwardVector * TraceDistance;
+    const FVector TraceEndBottom    = TraceStartBottom + ForwardVector * TraceDistance;
+
+    // Perform traces
+    FHitResult HitResultMid, HitResultTop, HitResultBottom;
+
+    const bool bHitMid      = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::FrontWallMid), HitResultMid, TraceStartMid, TraceEndMid, CollisionChannel, TraceParams);
+    const bool bHitTop      = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::FrontWallTop), HitResultTop, TraceStartTop, TraceEndTop, CollisionChannel, TraceParams);
+    const bool bHitBottom   = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::FrontWallBottom), HitResultBottom, TraceStartBottom, TraceEndBottom, CollisionChannel, TraceParams);
+
+    #if DEV_DEBUG_MODE
+    const bool bDebug = bActivateDebug;
+    if (bDebug)
+    {
+        DrawDebugLine(GetWorld(), TraceStartMid, TraceEndMid, FColor::Red, false, 1.0f);
+        DrawDebugLine(GetWorld(), TraceStartTop, TraceEndTop, FColor::Green, false, 1.0f);
+        DrawDebugLine(GetWorld(), TraceStartBottom, TraceEndBottom, FColor::Blue, false, 1.0f);
+    }
+    #endif
+
+    // Return true if any trace detects a static mesh (wall)
+    return bHitMid || bHitTop || bHitBottom;
+}
+
+bool UAdvanceMovementComponent::DetectHang()
+{
+    if (!IsDetectionAllowed())
+    {
+        return false;
+    }
+
+    return RunBudgetedDetection(&UAdvanceMovementComponent::PerformHangDetection);
+}
+
+bool UAdvanceMovementComponent::PerformHangDetection()
+{
+    if (!OwnerCapsuleComponent || !OwnerCharacter || !GetOwner())
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("Invalid OwnerCapsuleComponent, OwnerCharacter, or Owner detected.");
+        #endif
+        return false;
+    }
+
+    TObjectPtr<AActor> Owner = GetOwner();
+
+    if (!Owner)
+    {
+        #if DEV_DEBUG_MODE
+        LOG_ERROR("Owner returned nullptr.");
+        #endif
+        return false;
+    }
+
+    const FVector CapsuleCenter     = OwnerCapsuleComponent->GetComponentLocation();
+    const FVector CapsuleForward    = OwnerCapsuleComponent->GetForwardVector();
+    const FVector UpVector          = OwnerCapsuleComponent->GetUpVector();
+    const FVector DownVector        = -UpVector;
+
+    const float CapsuleHalfHeight   = OwnerCapsuleComponent->GetUnscaledCapsuleHalfHeight();
+    const float CapsuleRadius       = OwnerCapsuleComponent->GetUnscaledCapsuleRadius();
+    const float TraceDistance       = 30.0f;
+
+    FCollisionQueryParams TraceParams;
+    TraceParams.AddIgnoredActor(Owner);
+    TraceParams.AddIgnoredComponent(OwnerCapsuleComponent);
+    TraceParams.bIgnoreTouches = true;
+
+    if (IsCurrentMovementState(MovementStates::Fall))
+    {
+        // A ledge between chest and head height within reach of the hands, with wall under it for the feet.
+        const FLedgeInfo& Ledge = DetectLedge();
+        const float EdgeAboveCenter = Ledge.EdgePoint.Z - CapsuleCenter.Z;
+
+        const bool bLedgeInReach = Ledge.IsValid()
+            && Ledge.WallDistance <= TraceDistance + (CapsuleRadius * 0.50f)
+            && EdgeAboveCenter >= CapsuleHalfHeight * 0.55f
+            && EdgeAboveCenter <= CapsuleHalfHeight;
+
+        if (bLedgeInReach)
+        {
+            Hang->SetImpactPoint(Ledge.EdgePoint);
+            Hang->SetImpactNormal(Ledge.WallNormal);
+            Hang->SetDirection(Ledge.WallNormal);
+            Hang->SetHangLocation(Ledge.EdgePoint);
+
+            const FVector FeetHitStart = CapsuleCenter + (DownVector * (CapsuleHalfHeight * 0.80f));
+            const FVector FeetHitEnd = FeetHitStart + (CapsuleForward * TraceDistance * 2.0f);
+
+            FHitResult FeetHit;
+            const bool bFeetHit = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::HangFeet), FeetHit, FeetHitStart, FeetHitEnd, ECC_Visibility, TraceParams);
+
+            #if DEV_DEBUG_MODE
+            if (bActivateDebug)
+            {
+                DrawDebugLine(GetWorld(), FeetHitStart, FeetHitEnd, bFeetHit ? FColor::Green : FColor::Cyan, false, 1.0f);
+                DrawDebugPoint(GetWorld(), Ledge.EdgePoint, 10.0f, FColor::Orange, false, 1.0f);
+            }
+            #endif
+
+            if (bFeetHit)
+            {
+                LOG_INFO("Hang opportunity detected successfully (FallState).");
+                return true;
+            }
+        }
+    }
+    else if (IsCurrentMovementState(MovementStates::Jump))
+    {
+        // A ledge between the center and 80% of the capsule height, with wall in front of the feet.
+        const FLedgeInfo& Ledge = DetectLedge();
+        const float EdgeAboveCenter = Ledge.EdgePoint.Z - CapsuleCenter.Z;
+
+        const bool bLedgeInReach = Ledge.IsValid()
+            && Ledge.WallDistance <= TraceDistance
+            && EdgeAboveCenter > 0.0f
+            && EdgeAboveCenter <= CapsuleHalfHeight * 0.8f;
+
+        if (!bLedgeInReach)
+        {
+            return false;
+        }
+
+        const FVector FootTraceStart = CapsuleCenter + (DownVector * (CapsuleHalfHeight * 0.8f));
+        const FVector FootTraceEnd = FootTraceStart + (CapsuleForward * TraceDistance);
+
+        FHitResult FootHit;
+        const bool bFootHit = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::HangJumpFoot), FootHit, FootTraceStart, FootTraceEnd, ECC_Visibility, TraceParams);
+
+        #if DEV_DEBUG_MODE
+        if (bActivateDebug)
+        {
+            DrawDebugLine(GetWorld(), FootTraceStart, FootTraceEnd, bFootHit ? FColor::Green : FColor::Red, false, 1.0f, 0, 2.0f);
+            DrawDebugPoint(GetWorld(), Ledge.EdgePoint, 10.0f, FColor::Orange, false, 1.0f);
+        }
+        #endif
+
+        if (bFootHit)
+        {
+            Hang->SetImpactPoint(Ledge.EdgePoint);
+            Hang->SetHangLocation(Ledge.EdgePoint);
+            Hang->SetImpactNormal(Ledge.WallNormal);
+            Hang->SetDirection((-Ledge.WallNormal).GetSafeNormal());
+        }
+
+        return bFootHit;
+    }
+    else if (IsCurrentMovementState(MovementStates::VerticalWallRun))
+    {
+        const FVector HangTraceStart = CapsuleCenter + (UpVector * (CapsuleHalfHeight * 0.80f));
+        const FVector HangTraceEnd = HangTraceStart + (CapsuleForward * 75.0f);
+
+        FHitResult HangHit;
+        const bool bDidHitHangSurface = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::HangWallRun), HangHit, HangTraceStart, HangTraceEnd, ECC_Visibility, TraceParams);
+
+        if (!bDidHitHangSurface)
+        {
+            LOG_INFO("Hang opportunity detected successfully (VerticalWallRunState).");
+            return true;
+        }
+    }
+
+    #if DEV_DEBUG_MODE
+    LOG_ERROR("No valid hang opportunity detected in current movement state.");
+    #endif
+
+    return false;
+}
+
+bool UAdvanceMovementComponent::DetectWater()
+{
+    return IsInWaterBody();
+}
+
+#pragma endregion
+
+#pragma region Ledge
+
+const FLedgeInfo& UAdvanceMovementComponent::DetectLedge()
+{
+    if (LedgeInfo.Frame == GFrameCounter)
+    {
+        return LedgeInfo;
+    }
+
+    LedgeInfo = FLedgeInfo();
+    LedgeInfo.Frame = GFrameCounter;
+
+    UWorld* World = GetWorld();
+    if (!World || !OwnerCapsuleComponent)
+    {
+        return LedgeInfo;
+    }
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_LedgeDetections);
+
+    const float CapsuleHalfHeight = OwnerCapsuleComponent->GetScaledCapsuleHalfHeight();
+    const float CapsuleRadius     = OwnerCapsuleComponent->GetScaledCapsuleRadius();
+    const FVector CapsuleCenter   = OwnerCapsuleComponent->GetComponentLocation();
+
+    FVector Forward = OwnerCapsuleComponent->GetForwardVector().GetSafeNormal2D();
+    if (Forward.IsNearlyZero())
+    {
+        return LedgeInfo;
+    }
+
+    // Keeps the wall sweep off the floor the character stands on.
+    const float StepClearance = 5.0f;
+
+    // Covers the hang and vault reach above the capsule and the full height a mantle may climb from the floor.
+    const float BottomZ = CapsuleCenter.Z - CapsuleHalfHeight;
+    const float TopZ    = BottomZ + FMath::Max((CapsuleHalfHeight * 2.0f) + GAdvanceMovementLedgeMaxAbove, Mantle ? Mantle->GetMaximumHeight() : 0.0f);
+
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(GetOwner());
+    QueryParams.AddIgnoredComponent(OwnerCapsuleComponent);
+    QueryParams.bIgnoreTouches = true;
+
+    // Shape cast 1: a thin slab spanning the feet to above the head, swept forward to find the wall face.
+    const float SlabHalfHeight = (TopZ - (BottomZ + StepClearance)) * 0.5f;
+    const FVector SlabStart(CapsuleCenter.X, CapsuleCenter.Y, BottomZ + StepClearance + SlabHalfHeight);
+    const FVector SlabEnd = SlabStart + (Forward * GAdvanceMovementLedgeReach);
+    const FCollisionShape Slab = FCollisionShape::MakeBox(FVector(1.0f, CapsuleRadius * 0.5f, SlabHalfHeight));
+
+    // Static geometry: answered from the precomputed annotations. Movable objects are not in them, so the same slab is
+    // swept against dynamic objects only; one in front of the annotated edge (or anywhere, where the index is trusted to
+    // be complete) sends the detection down the full trace path.
+    if (const UTraversalAnnotationData* Annotations = GetTraversalAnnotations())
+    {
+        const FTraversalAnnotation* Annotation = Annotations->FindEdge(CapsuleCenter, Forward, GAdvanceMovementLedgeReach,
+            BottomZ + StepClearance, TopZ, ETraversalAnnotationFlags::Ledge);
+
+        const bool bTrustMiss = !Annotation && GAdvanceMovementTraversalTrustStaticIndex && Annotations->IsCovered(CapsuleCenter);
+
+        if (Annotation || bTrustMiss)
+        {
+            FCollisionObjectQueryParams DynamicObjects;
+            DynamicObjects.AddObjectTypesToQuery(ECC_WorldDynamic);
+            DynamicObjects.AddObjectTypesToQuery(ECC_PhysicsBody);
+
+            FHitResult DynamicHit;
+            const bool bDynamicHit = EnvironmentProbes.SweepByObjectType(World, MakeMovementProbeKey(EMovementProbe::LedgeDynamic), DynamicHit, SlabStart, SlabEnd,
+                Forward.ToOrientationQuat(), DynamicObjects, Slab, QueryParams);
+
+            const float AnnotatedDistance = Annotation ? FVector::DistXY(CapsuleCenter, Annotation->GetEdgePoint()) : GAdvanceMovementLedgeReach;
+            const bool bDynamicInFront    = bDynamicHit && FVector::DistXY(CapsuleCenter, DynamicHit.ImpactPoint) < AnnotatedDistance;
+
+            if (Annotation && !bDynamicInFront)
+            {
+                INC_DWORD_STAT(STAT_AdvanceMovement_AnnotationHits);
+
+                const FVector AnnotatedNormal = Annotation->GetWallNormal();
+                const FVector AnnotatedEdge   = Annotation->GetEdgePoint();
+
+                LedgeInfo.WallPoint    = FVector(AnnotatedEdge.X, AnnotatedEdge.Y, CapsuleCenter.Z);
+                LedgeInfo.WallNormal   = AnnotatedNormal;
+                LedgeInfo.WallDistance = AnnotatedDistance;
+                LedgeInfo.EdgePoint    = AnnotatedEdge;
+                LedgeInfo.Height       = AnnotatedEdge.Z - BottomZ;
+                LedgeInfo.Clearance    = FMath::Min(Annotation->GetClearance(), CapsuleHalfHeight * 2.0f);
+                LedgeInfo.Width        = Annotation->GetWidth();
+
+                if (Annotation->HasFarEdge())
+                {
+                    LedgeInfo.FarEdgePoint = AnnotatedEdge - (AnnotatedNormal * Annotation->GetWidth());
+                    LedgeInfo.bHasFarEdge  = true;
+                }
+
+                LedgeInfo.bValid = true;
+                return LedgeInfo;
+            }
+
+            if (bTrustMiss && !bDynamicInFront)
+            {
+                INC_DWORD_STAT(STAT_AdvanceMovement_AnnotationMisses);
+                return LedgeInfo;
+            }
+        }
+
+        INC_DWORD_STAT(STAT_AdvanceMovement_AnnotationMisses);
+    }
+
+    FHitResult WallHit;
+    const bool bWallHit = EnvironmentProbes.Sweep(World, MakeMovementProbeKey(EMovementProbe::LedgeWall), WallHit, SlabStart, SlabEnd,
+        Forward.ToOrientationQuat(), ECC_Visibility, Slab, QueryParams);
+
+    if (!bWallHit || WallHit.bStartPenetrating)
+    {
+        return LedgeInfo;
+    }
+
+    FVector WallNormal = WallHit.ImpactNormal.GetSafeNormal2D();
+    if (WallNormal.IsNearlyZero())
+    {
+        WallNormal = -Forward;
     }
 
-    // Return -1 if no wall is detected in front
-    return -1.f;
-}
+    const FVector Inward = -WallNormal;
 
-float UAdvanceMovementComponent::PerformGroundDistanceTrace()
-{
-    if (!GetOwner() || !OwnerCapsuleComponent)
+    // Shape cast 2: a small sphere dropped just behind the wall face lands on its top surface.
+    const float TopProbeRadius = 4.0f;
+    const FVector TopStart = FVector(WallHit.ImpactPoint.X, WallHit.ImpactPoint.Y, TopZ) + (Inward * (TopProbeRadius + 2.0f));
+    const FVector TopEnd   = FVector(TopStart.X, TopStart.Y, BottomZ + StepClearance);
+
+    FHitResult TopHit;
+    const bool bTopHit = EnvironmentProbes.Sweep(World, MakeMovementProbeKey(EMovementProbe::LedgeTop), TopHit, TopStart, TopEnd,
+        FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(TopProbeRadius), QueryParams);
+
+    // Starting inside geometry means the wall runs above the search range; a steep top is not something to stand on.
+    if (!bTopHit || TopHit.bStartPenetrating || TopHit.ImpactNormal.Z < GetWalkableFloorZ())
     {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("OwnerCapsuleComponent or Owner invalid.");
-        #endif
-        return -1.0f;
+        return LedgeInfo;
     }
 
-    const FVector CapsuleLocation = OwnerCapsuleComponent->GetComponentLocation();
-    const float CapsuleHalfHeight = OwnerCapsuleComponent->GetUnscaledCapsuleHalfHeight();
+    const float EdgeZ = TopHit.ImpactPoint.Z;
 
-    // Adjust start location slightly below capsule bottom to avoid self-collision
-    const FVector StartLocation = CapsuleLocation - FVector(0.0f, 0.0f, CapsuleHalfHeight + 2.10f);
-    const FVector EndLocation   = StartLocation - FVector(0.0f, 0.0f, 10000.0f);
+    LedgeInfo.WallPoint    = WallHit.ImpactPoint;
+    LedgeInfo.WallNormal   = WallNormal;
+    LedgeInfo.WallDistance = FVector::DistXY(CapsuleCenter, WallHit.ImpactPoint);
+    LedgeInfo.EdgePoint    = FVector(WallHit.ImpactPoint.X, WallHit.ImpactPoint.Y, EdgeZ);
+    LedgeInfo.Height       = EdgeZ - BottomZ;
 
+    // Refinement: free height above the top surface.
+    const float FullClearance   = CapsuleHalfHeight * 2.0f;
+    const FVector ClearanceStart = LedgeInfo.EdgePoint + (Inward * (CapsuleRadius * 0.5f)) + FVector(0.0f, 0.0f, 1.0f);
+    const FVector ClearanceEnd   = ClearanceStart + FVector(0.0f, 0.0f, FullClearance);
 
-    FHitResult GroundHit;
-    FCollisionQueryParams QueryParams(FName(TEXT("GroundDistanceTrace")), false, GetOwner());
-    QueryParams.AddIgnoredActor(GetOwner());
-    QueryParams.AddIgnoredComponent(OwnerCapsuleComponent);
+    FHitResult ClearanceHit;
+    LedgeInfo.Clearance = EnvironmentProbes.LineTrace(World, MakeMovementProbeKey(EMovementProbe::LedgeClearance), ClearanceHit, ClearanceStart, ClearanceEnd, ECC_Visibility, QueryParams)
+        ? ClearanceHit.Distance
+        : FullClearance;
+
+    // Refinement: depth of the top surface, from where the top probe landed, with the same search as the vault width.
+    const float MaximumWidth = 200.0f;
+    const float TopInset     = TopProbeRadius + 2.0f;
+    int32 WidthIndex = 0;
+
+    auto TraceTopAt = [&](float Depth, FHitResult& OutHit) -> bool
+    {
+        const FVector Start = LedgeInfo.EdgePoint + (Inward * (TopInset + Depth)) + FVector(0.0f, 0.0f, 5.0f);
+        const FVector End   = Start - FVector(0.0f, 0.0f, 15.0f);
+        return EnvironmentProbes.LineTrace(World, MakeMovementProbeKey(EMovementProbe::LedgeWidth, WidthIndex++), OutHit, Start, End, ECC_Visibility, QueryParams);
+    };
+
+    float FarDepth = 0.0f;
+    FVector FarEdgePoint = LedgeInfo.EdgePoint;
 
-    const bool bHit = GetWorld()->LineTraceSingleByChannel(GroundHit, StartLocation, EndLocation, ECC_Visibility, QueryParams);
+    if (FindTopFarEdge(TraceTopAt, MaximumWidth - TopInset, FarDepth, FarEdgePoint))
+    {
+        LedgeInfo.Width        = TopInset + FarDepth;
+        LedgeInfo.FarEdgePoint = FarEdgePoint;
+        LedgeInfo.bHasFarEdge  = true;
+    }
+    else
+    {
+        LedgeInfo.Width = MaximumWidth;
+    }
 
+    LedgeInfo.bValid = true;
 
     #if DEV_DEBUG_MODE
     if (bActivateDebug)
     {
-        DrawDebugLine(GetWorld(), StartLocation, EndLocation, bHit ? FColor::Green : FColor::Red, false, 1.0f, 0, 2.0f);
+        DrawDebugLine(World, LedgeInfo.WallPoint, LedgeInfo.EdgePoint, FColor::Yellow, false, 1.0f);
+        DrawDebugPoint(World, LedgeInfo.EdgePoint, 8.0f, FColor::Orange, false, 1.0f);
     }
     #endif
 
-    return bHit ? GroundHit.Distance : -1.0f;
+    return LedgeInfo;
 }
 
-bool UAdvanceMovementComponent::IsFrontWallDetected(float InTraceDistance)
+const UTraversalAnnotationData* UAdvanceMovementComponent::GetTraversalAnnotations() const
 {
-    // Early out if essential components are missing
-    if (!OwnerCapsuleComponent || !GetWorld())
+    if (!GAdvanceMovementTraversalUseAnnotations)
     {
-        return false;
+        return nullptr;
     }
 
-    // Get capsule location and forward direction
-    const FVector CapsuleLocation   = OwnerCapsuleComponent->GetComponentLocation();
-    const FVector ForwardVector     = OwnerCapsuleComponent->GetForwardVector();
-
-    // Capsule dimensions
-    const float CapsuleHalfHeight   = OwnerCapsuleComponent->GetScaledCapsuleHalfHeight();
-    const float CapsuleRadius       = OwnerCapsuleComponent->GetScaledCapsuleRadius();
-
-    // Trace parameters
-    const float TraceDistance = InTraceDistance;
-    FCollisionQueryParams TraceParams(FName(TEXT("FrontWallTrace")), false, GetOwner());
-    TraceParams.AddIgnoredActor(GetOwner());
-    TraceParams.AddIgnoredComponent(OwnerCapsuleComponent);
-    TraceParams.bIgnoreTouches = true;
+    const UWorld* World = GetWorld();
+    const UAdvanceMovementSubsystem* Subsystem = World ? World->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr;
+    return Subsystem ? Subsystem->GetTraversalAnnotations() : nullptr;
+}
 
-    // Collision channel: only detect static geometry
-    const ECollisionChannel CollisionChannel = ECC_WorldStatic;
+#pragma endregion
 
-    // Define three trace start positions (mid, top, bottom)
-    const FVector TraceStartMid     = CapsuleLocation + ForwardVector * CapsuleRadius;
-    const FVector TraceStartTop     = TraceStartMid + FVector(0.0f, 0.0f, CapsuleHalfHeight * 0.9f);
-    const FVector TraceStartBottom  = TraceStartMid - FVector(0.0f, 0.0f, CapsuleHalfHeight * 0.9f);
+#pragma region GroundTracking
 
-    // Define end points
-    const FVector TraceEndMid       = TraceStartMid + ForwardVector * TraceDistance;
-    const FVector TraceEndTop       = TraceStartTop + ForwardVector * TraceDistance;
-    const FVector TraceEndBottom    = TraceStartBottom + ForwardVector * TraceDistance;
+// PerformGroundDistanceTrace starts this far below the capsule bottom to avoid hitting the capsule itself.
+static constexpr float GroundProbeOffset = 2.10f;
 
-    // Perform traces
-    FHitResult HitResultMid, HitResultTop, HitResultBottom;
+float UAdvanceMovementComponent::GroundProbeOriginZ() const
+{
+    return OwnerCapsuleComponent->GetComponentLocation().Z - OwnerCapsuleComponent->GetUnscaledCapsuleHalfHeight() - GroundProbeOffset;
+}
 
-    const bool bHitMid      = GetWorld()->LineTraceSingleByChannel(HitResultMid, TraceStartMid, TraceEndMid, CollisionChannel, TraceParams);
-    const bool bHitTop      = GetWorld()->LineTraceSingleByChannel(HitResultTop, TraceStartTop, TraceEndTop, CollisionChannel, TraceParams);
-    const bool bHitBottom   = GetWorld()->LineTraceSingleByChannel(HitResultBottom, TraceStartBottom, TraceEndBottom, CollisionChannel, TraceParams);
+bool UAdvanceMovementComponent::IsGroundTrackValid(const FVector& Location, float WorldTime) const
+{
+    if (GroundTrack.TraceTime < 0.0f || WorldTime - GroundTrack.TraceTime > GAdvanceMovementGroundMaxAge)
+    {
+        return false;
+    }
 
-    #if DEV_DEBUG_MODE
-    const bool bDebug = bActivateDebug;
-    if (bDebug)
+    if (FVector::DistSquared2D(Location, GroundTrack.TraceLocation) > FMath::Square(GAdvanceMovementGroundHorizontalTolerance))
     {
-        DrawDebugLine(GetWorld(), TraceStartMid, TraceEndMid, FColor::Red, false, 1.0f);
-        DrawDebugLine(GetWorld(), TraceStartTop, TraceEndTop, FColor::Green, false, 1.0f);
-        DrawDebugLine(GetWorld(), TraceStartBottom, TraceEndBottom, FColor::Blue, false, 1.0f);
+        return false;
     }
-    #endif
 
-    // Return true if any trace detects a static mesh (wall)
-    return bHitMid || bHitTop || bHitBottom;
+    // Below the traced ground means the character went through it or it moved; either way the answer is wrong.
+    return !GroundTrack.bHasGround || GroundProbeOriginZ() >= GroundTrack.GroundZ - KINDA_SMALL_NUMBER;
 }
 
-bool UAdvanceMovementComponent::DetectHang()
+float UAdvanceMovementComponent::PredictTimeToImpact(float Height) const
 {
-    if (!OwnerCapsuleComponent || !OwnerCharacter || !GetOwner())
+    const float VerticalSpeed = Velocity.Z;
+    const float Gravity       = GetGravityZ();
+
+    // Height = -(VerticalSpeed * t + 0.5 * Gravity * t^2), solved for the first positive t.
+    if (FMath::IsNearlyZero(Gravity))
     {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("Invalid OwnerCapsuleComponent, OwnerCharacter, or Owner detected.");
-        #endif
-        return false;
+        return VerticalSpeed < 0.0f ? Height / -VerticalSpeed : -1.0f;
     }
 
-    TObjectPtr<AActor> Owner = GetOwner();
+    const float Discriminant = (VerticalSpeed * VerticalSpeed) - (2.0f * Gravity * Height);
+    if (Discriminant < 0.0f)
+    {
+        return -1.0f;
+    }
 
-    if (!Owner)
+    const float Time = (-VerticalSpeed - FMath::Sqrt(Discriminant)) / Gravity;
+    return Time >= 0.0f ? Time : -1.0f;
+}
+
+float UAdvanceMovementComponent::GroundDistance()
+{
+    if (GroundTrack.Frame == GFrameCounter)
     {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("Owner returned nullptr.");
-        #endif
-        return false;
+        return GroundTrack.Distance;
     }
 
-    const FVector CapsuleCenter     = OwnerCapsuleComponent->GetComponentLocation();
-    const FVector CapsuleForward    = OwnerCapsuleComponent->GetForwardVector();
-    const FVector UpVector          = OwnerCapsuleComponent->GetUpVector();
-    const FVector DownVector        = -UpVector;
+    if (!OwnerCapsuleComponent || !GetWorld())
+    {
+        return PerformGroundDistanceTrace();
+    }
 
-    const float CapsuleHalfHeight   = OwnerCapsuleComponent->GetUnscaledCapsuleHalfHeight();
-    const float CapsuleRadius       = OwnerCapsuleComponent->GetUnscaledCapsuleRadius();
-    const float TraceDistance       = 30.0f;
+    GroundTrack.Frame = GFrameCounter;
 
-    if (IsCurrentMovementState(MovementStates::Fall))
+    // Grounded: the character movement already swept for the floor this frame.
+    if (IsMovingOnGround() && CurrentFloor.IsWalkableFloor())
     {
-        const FVector HeadStart = CapsuleCenter + (UpVector * CapsuleHalfHeight);
-        const FVector HeadEnd = HeadStart + (CapsuleForward * TraceDistance * 2.0f);
+        INC_DWORD_STAT(STAT_AdvanceMovement_GroundFromFloor);
 
-        #if DEV_DEBUG_MODE
-        if (bActivateDebug)
-        {
-            DrawDebugLine(GetWorld(), HeadStart, HeadEnd, FColor::Red, true);
-        }
-        #endif
+        GroundTrack.Distance     = FMath::Max(CurrentFloor.GetDistanceToFloor() - GroundProbeOffset, 0.0f);
+        GroundTrack.TimeToImpact = -1.0f;
+        GroundTrack.TraceTime    = -1.0f;
+        return GroundTrack.Distance;
+    }
 
-        FHitResult TopHit;
-        FCollisionQueryParams TopQueryParams;
-        TopQueryParams.AddIgnoredActor(Owner);
-        TopQueryParams.AddIgnoredComponent(OwnerCapsuleComponent);
-        TopQueryParams.bIgnoreTouches = true;
+    const FVector Location = OwnerCapsuleComponent->GetComponentLocation();
+    const float WorldTime  = GetWorld()->GetTimeSeconds();
+    const float OriginZ    = GroundProbeOriginZ();
 
+    if (IsGroundTrackValid(Location, WorldTime))
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_GroundPredicted);
+    }
+    else
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_GroundTraces);
 
-        const bool bTopHit = GetWorld()->LineTraceSingleByChannel(TopHit, HeadStart, HeadEnd, ECC_Visibility, TopQueryParams);
+        const float TracedDistance = PerformGroundDistanceTrace();
 
-        if (!bTopHit)
-        {
-            const FVector CapsuleHitStart = CapsuleCenter + (UpVector * (CapsuleHalfHeight * 0.80f));
-            const FVector CapsuleHitEnd = CapsuleHitStart + (CapsuleForward * TraceDistance);
+        GroundTrack.bHasGround    = TracedDistance >= 0.0f;
+        GroundTrack.GroundZ       = OriginZ - TracedDistance;
+        GroundTrack.TraceLocation = Location;
+        GroundTrack.TraceTime     = WorldTime;
+    }
 
-            #if DEV_DEBUG_MODE
-            if (bActivateDebug)
-            {
-                DrawDebugCapsule(GetWorld(), CapsuleHitEnd, CapsuleHalfHeight * 0.25f, CapsuleRadius * 0.50f, FQuat::Identity, FColor::Green, true);
-            }
-            #endif
+    if (!GroundTrack.bHasGround)
+    {
+        GroundTrack.Distance     = -1.0f;
+        GroundTrack.TimeToImpact = -1.0f;
+        return GroundTrack.Distance;
+    }
 
-            FHitResult CapsuleHit;
-            FCollisionQueryParams CapsuleQueryParams;
-            CapsuleQueryParams.AddIgnoredActor(Owner);
-            CapsuleQueryParams.AddIgnoredComponent(OwnerCapsuleComponent);
-            CapsuleQueryParams.bIgnoreTouches = true;
-
-            const bool bCapsuleSweepHit = GetWorld()->SweepSingleByChannel(
-                CapsuleHit,
-                CapsuleHitStart,
-                CapsuleHitEnd,
-                FQuat::Identity,
-                ECC_Visibility,
-                FCollisionShape::MakeCapsule(CapsuleRadius * 0.50f, CapsuleHalfHeight * 0.25f),
-                CapsuleQueryParams
-            );
+    GroundTrack.Distance     = FMath::Max(OriginZ - GroundTrack.GroundZ, 0.0f);
+    GroundTrack.TimeToImpact = PredictTimeToImpact(GroundTrack.Distance);
+    return GroundTrack.Distance;
+}
 
-            if (bCapsuleSweepHit)
-            {
-                Hang->SetImpactPoint(CapsuleHit.ImpactPoint);
-                Hang->SetImpactNormal(CapsuleHit.ImpactNormal);
-                Hang->SetDirection(CapsuleHit.ImpactNormal);
-                Hang->SetHangLocation(CapsuleHit.ImpactPoint);
+#pragma endregion
 
-                const FVector FeetHitStart = CapsuleCenter + (DownVector * (CapsuleHalfHeight * 0.80f));
-                const FVector FeetHitEnd = FeetHitStart + (CapsuleForward * TraceDistance * 2.0f);
+#pragma region Water
 
-                #if DEV_DEBUG_MODE
-                if (bActivateDebug)
-                {
-                    DrawDebugLine(GetWorld(), FeetHitStart, FeetHitEnd, FColor::Cyan, true);
-                    DrawDebugPoint(GetWorld(), CapsuleHit.ImpactPoint, 10.0f, FColor::Orange, true);
-                }
-                #endif
+const FName UAdvanceMovementComponent::WaterTag(TEXT("Water"));
+
+void UAdvanceMovementComponent::BindWaterEvents()
+{
+    if (!OwnerCapsuleComponent)
+    {
+        return;
+    }
 
-                FHitResult FeetHit;
-                FCollisionQueryParams FeetQueryParams;
-                FeetQueryParams.AddIgnoredActor(Owner);
-                FeetQueryParams.AddIgnoredComponent(OwnerCapsuleComponent);
-                FeetQueryParams.bIgnoreTouches = true;
+    OwnerCapsuleComponent->OnComponentBeginOverlap.AddUniqueDynamic(this, &UAdvanceMovementComponent::OnWaterBeginOverlap);
+    OwnerCapsuleComponent->OnComponentEndOverlap.AddUniqueDynamic(this, &UAdvanceMovementComponent::OnWaterEndOverlap);
 
+    // Overlaps that began before binding never raise a begin event.
+    OverlappedWaterBodies.Reset();
 
-                const bool bFeetHit = GetWorld()->LineTraceSingleByChannel(FeetHit, FeetHitStart, FeetHitEnd, ECC_Visibility, FeetQueryParams);
+    TArray<UPrimitiveComponent*> OverlappingComponents;
+    OwnerCapsuleComponent->GetOverlappingComponents(OverlappingComponents);
 
-                if (bFeetHit)
-                {
-                    LOG_INFO("Hang opportunity detected successfully (FallState).");
-                    return true;
-                }
-            }
+    for (UPrimitiveComponent* Component : OverlappingComponents)
+    {
+        if (IsWaterBody(Component))
+        {
+            OverlappedWaterBodies.AddUnique(Component);
         }
     }
-    else if (IsCurrentMovementState(MovementStates::Jump))
+
+    const APhysicsVolume* Volume = GetPhysicsVolume();
+    bInWaterVolume = Volume && Volume->bWaterVolume;
+
+    RefreshWaterState();
+}
+
+void UAdvanceMovementComponent::UnbindWaterEvents()
+{
+    if (!OwnerCapsuleComponent)
     {
-        const FVector HeadHeightOffset = UpVector * (CapsuleHalfHeight * 0.8f);
-        const FVector HeadTraceStart = CapsuleCenter + HeadHeightOffset;
-        const FVector HeadTraceEnd = HeadTraceStart + (CapsuleForward * TraceDistance);
+        return;
+    }
 
-        const FVector CenterTraceStart = CapsuleCenter;
-        const FVector CenterTraceEnd = CenterTraceStart + (CapsuleForward * TraceDistance);
+    OwnerCapsuleComponent->OnComponentBeginOverlap.RemoveDynamic(this, &UAdvanceMovementComponent::OnWaterBeginOverlap);
+    OwnerCapsuleComponent->OnComponentEndOverlap.RemoveDynamic(this, &UAdvanceMovementComponent::OnWaterEndOverlap);
 
-        const FVector FootHeightOffset = DownVector * (CapsuleHalfHeight * 0.8f);
-        const FVector FootTraceStart = CapsuleCenter + FootHeightOffset;
-        const FVector FootTraceEnd = FootTraceStart + (CapsuleForward * TraceDistance);
+    OverlappedWaterBodies.Reset();
+}
 
-        #if DEV_DEBUG_MODE
-        if (bActivateDebug)
-        {
-            DrawDebugLine(GetWorld(), HeadTraceStart, HeadTraceEnd, FColor::Green, true, 1.0f, 0, 2.0f);
-            DrawDebugLine(GetWorld(), CenterTraceStart, CenterTraceEnd, FColor::Green, true, 1.0f, 0, 2.0f);
-            DrawDebugLine(GetWorld(), FootTraceStart, FootTraceEnd, FColor::Green, true, 1.0f, 0, 2.0f);
-        }
-        #endif
+bool UAdvanceMovementComponent::IsWaterBody(const UPrimitiveComponent* Component)
+{
+    const AActor* Actor = Component ? Component->GetOwner() : nullptr;
+    return Actor && Actor->ActorHasTag(WaterTag);
+}
 
-        FCollisionQueryParams TraceParams;
-        TraceParams.AddIgnoredActor(Owner);
-        TraceParams.AddIgnoredComponent(OwnerCapsuleComponent);
-        TraceParams.bIgnoreTouches = true;
+void UAdvanceMovementComponent::OnWaterBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    if (!IsWaterBody(OtherComp))
+    {
+        return;
+    }
 
-        FHitResult HeadHit, CenterHit, FootHit;
+    OverlappedWaterBodies.AddUnique(OtherComp);
+    RefreshWaterState();
+}
 
-        const bool bHeadHit = GetWorld()->LineTraceSingleByChannel(HeadHit, HeadTraceStart, HeadTraceEnd, ECC_Visibility, TraceParams);
-        const bool bCenterHit = GetWorld()->LineTraceSingleByChannel(CenterHit, CenterTraceStart, CenterTraceEnd, ECC_Visibility, TraceParams);
-        const bool bFootHit = GetWorld()->LineTraceSingleByChannel(FootHit, FootTraceStart, FootTraceEnd, ECC_Visibility, TraceParams);
+void UAdvanceMovementComponent::OnWaterEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    if (OverlappedWaterBodies.Remove(OtherComp) > 0)
+    {
+        RefreshWaterState();
+    }
+}
 
-        if (bHeadHit)
-        {
-            Hang->SetImpactPoint(HeadHit.ImpactPoint);
-            Hang->SetHangLocation(HeadHit.ImpactPoint);
-            Hang->SetImpactNormal(HeadHit.ImpactNormal);
-            Hang->SetDirection((-HeadHit.ImpactNormal).GetSafeNormal());
-        }
+void UAdvanceMovementComponent::PhysicsVolumeChanged(APhysicsVolume* NewVolume)
+{
+    Super::PhysicsVolumeChanged(NewVolume);
 
-        return !bHeadHit && bCenterHit && bFootHit;
+    const bool bWaterVolume = NewVolume && NewVolume->bWaterVolume;
+    if (bWaterVolume != bInWaterVolume)
+    {
+        bInWaterVolume = bWaterVolume;
+        RefreshWaterState();
     }
-    else if (IsCurrentMovementState(MovementStates::VerticalWallRun))
+}
+
+void UAdvanceMovementComponent::RefreshWaterState()
+{
+    bool bHasBounds = false;
+    float SurfaceZ  = 0.0f;
+    float FloorZ    = 0.0f;
+
+    auto AccumulateBounds = [&](const FBox& Bounds)
     {
-        const FVector HangTraceStart = CapsuleCenter + (UpVector * (CapsuleHalfHeight * 0.80f));
-        const FVector HangTraceEnd = HangTraceStart + (CapsuleForward * 75.0f);
+        SurfaceZ   = bHasBounds ? FMath::Max(SurfaceZ, static_cast<float>(Bounds.Max.Z)) : static_cast<float>(Bounds.Max.Z);
+        FloorZ     = bHasBounds ? FMath::Min(FloorZ, static_cast<float>(Bounds.Min.Z)) : static_cast<float>(Bounds.Min.Z);
+        bHasBounds = true;
+    };
 
-        FHitResult HangHit;
-        FCollisionQueryParams HangTraceParams;
-        HangTraceParams.AddIgnoredActor(Owner);
-        HangTraceParams.AddIgnoredComponent(OwnerCapsuleComponent);
-        HangTraceParams.bIgnoreTouches = true;
+    for (int32 Index = OverlappedWaterBodies.Num() - 1; Index >= 0; --Index)
+    {
+        const UPrimitiveComponent* Body = OverlappedWaterBodies[Index].Get();
+        if (!Body)
+        {
+            OverlappedWaterBodies.RemoveAtSwap(Index);
+            continue;
+        }
 
-        const bool bDidHitHangSurface = GetWorld()->LineTraceSingleByChannel(HangHit, HangTraceStart, HangTraceEnd, ECC_Visibility, HangTraceParams);
+        AccumulateBounds(Body->Bounds.GetBox());
+    }
 
-        if (!bDidHitHangSurface)
+    if (bInWaterVolume)
+    {
+        if (const APhysicsVolume* Volume = GetPhysicsVolume())
         {
-            LOG_INFO("Hang opportunity detected successfully (VerticalWallRunState).");
-            return true;
+            AccumulateBounds(Volume->GetComponentsBoundingBox());
         }
     }
 
-    #if DEV_DEBUG_MODE
-    LOG_ERROR("No valid hang opportunity detected in current movement state.");
-    #endif
+    WaterSurfaceZ = SurfaceZ;
+    WaterFloorZ   = FloorZ;
 
-    return false;
+    NotifyMovementSignal(EMovementSignal::Water);
 }
 
-bool UAdvanceMovementComponent::DetectWater()
+float UAdvanceMovementComponent::GetWaterImmersionDepth() const
 {
-    if (!GetOwner() || !OwnerCapsuleComponent)
+    if (!IsInWaterBody() || !OwnerCapsuleComponent)
     {
-        #if DEV_DEBUG_MODE
-        LOG_ERROR("CheckForSwimming failed: Owner or CapsuleComponent is invalid.");
-        #endif
-
-        return false;
+        return 0.0f;
     }
 
-    // Perform a simple capsule overlap check for any actors
-    TArray<AActor*> OverlappingActors;
-    OwnerCapsuleComponent->GetOverlappingActors(OverlappingActors);
-
+    const float CapsuleBottomZ = OwnerCapsuleComponent->GetComponentLocation().Z - OwnerCapsuleComponent->GetScaledCapsuleHalfHeight();
+    return FMath::Max(WaterSurfaceZ - CapsuleBottomZ, 0.0f);
+}
 
-    // Check for any actor with the "Water" tag
-    for (AActor* Actor : OverlappingActors)
+float UAdvanceMovementComponent::GetWaterDepthBelow() const
+{
+    if (!IsInWaterBody() || !OwnerCapsuleComponent)
     {
-        if (Actor && Actor->ActorHasTag("Water"))
-        {
-#if DEV_DEBUG_MODE
-            LOG_INFO("Swimming detected via Actor Tag: Water.");
-#endif
-            return true;
-        }
+        return 0.0f;
     }
 
-    return false;
+    const float CapsuleBottomZ = OwnerCapsuleComponent->GetComponentLocation().Z - OwnerCapsuleComponent->GetScaledCapsuleHalfHeight();
+    return FMath::Max(CapsuleBottomZ - WaterFloorZ, 0.0f);
 }
 
-
 #pragma endregion
 
 #pragma region BasicMovementState
@@ -1770,7 +4229,7 @@ void UAdvanceMovementComponent::SwitchBasicMovement(EBasicMovementState InBasicM
 
     case EBasicMovementState::Null:
         #if DEV_DEBUG_MODE
-        UE_LOG(LogTemp, Error, TEXT("BasicMovementState state set to Null. No movement logic will be executed. Verify if this is intentional."));
+        UE_LOG(LogAdvanceMovement, Error, TEXT("BasicMovementState state set to Null. No movement logic will be executed. Verify if this is intentional."));
         #endif
         break;
 
@@ -1808,7 +4267,7 @@ void UAdvanceMovementComponent::SwitchBasicMovement(EBasicMovementState InBasicM
 
     default:
         #if DEV_DEBUG_MODE
-        UE_LOG(LogTemp, Error, TEXT("Unhandled BasicMovementState state: %s"), *UEnum::GetValueAsString(InBasicMobility));
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Unhandled BasicMovementState state: %s"), *UEnum::GetValueAsString(InBasicMobility));
         #endif
         break;
     }
@@ -1855,32 +4314,7 @@ void UAdvanceMovementComponent::TickIdleMovement()
         UpdateIdleDuration();
         UpdateIdleStamina();
 
-
-        if (DetectWater())
-        {
-            IdleToSwim();
-        }
-
-        if (IsMovingOnGround())
-        {
-            /* Basic Mobility */
-            IdleToWalk();
-            IdleToRun();
-            IdleToCrouch();
-            IdleToProne();
-            IdleToCrawl();
-
-            /* Special Mobility */
-            IdleToJump();
-            IdleToRoll();
-            IdleToDash();
-        }
-        else
-        {
-            IdleToFall();
-        }
-
-        IdleToSwim();
+        EvaluateTransitions(EMovementType::Idle);
 
         if (IsPlayer())
         {
@@ -1935,13 +4369,13 @@ void UAdvanceMovementComponent::IdleToWalk()
 {
     if (IsPlayer())
     {  
-        if (SystemCore->GetPlayerMovementConfiguration().WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+        if (SystemCore->GetPlayerMovementConfiguration().WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitIdle();
                 SetBasicMovement(WalkMovement);
-                UE_LOG(LogTemp, Error, TEXT("IDLE TO WALK"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO WALK"));
                 return;
             }
         }
@@ -1952,13 +4386,13 @@ void UAdvanceMovementComponent::IdleToRun()
 {
     if (IsPlayer())
     {
-        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitIdle();
                 SetBasicMovement(RunMovement);
-                UE_LOG(LogTemp, Error, TEXT("IDLE TO RUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO RUN"));
                 return;
             }
         }
@@ -1970,7 +4404,7 @@ void UAdvanceMovementComponent::IdleToCrouch()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed())
+        if (MovementInput.InputCrouchPressed())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -1980,7 +4414,7 @@ void UAdvanceMovementComponent::IdleToCrouch()
                 {
                     ExitIdle();
                     SetBasicMovement(CrouchMovement);
-                    UE_LOG(LogTemp, Error, TEXT("IDLE TO CROUCH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO CROUCH"));
                     return;
                 }
                 else
@@ -1996,7 +4430,7 @@ void UAdvanceMovementComponent::IdleToProne()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed() || PlayerInputCache->InputProneHeld())
+        if (MovementInput.InputPronePressed() || MovementInput.InputProneHeld())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -2007,7 +4441,7 @@ void UAdvanceMovementComponent::IdleToProne()
                 {
                     ExitIdle();
                     SetBasicMovement(ProneMovement);
-                    UE_LOG(LogTemp, Error, TEXT("IDLE TO PRONE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO PRONE"));
                     return;
                 }
                 else
@@ -2025,7 +4459,7 @@ void UAdvanceMovementComponent::IdleToCrawl()
     {
         ExitIdle();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("IDLE TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO CRAWL"));
         return;
     }
 }
@@ -2036,7 +4470,7 @@ void UAdvanceMovementComponent::IdleToFall()
     {
         ExitIdle();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("IDLE TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO FALL"));
         return;
     }
 }
@@ -2045,7 +4479,7 @@ void UAdvanceMovementComponent::IdleToJump()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed())
+        if (MovementInput.InputJumpPressed())
         {            
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -2056,7 +4490,7 @@ void UAdvanceMovementComponent::IdleToJump()
                 {
                     ExitIdle();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("IDLE TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO JUMP"));
                     return;
                 }
                 else
@@ -2072,7 +4506,7 @@ void UAdvanceMovementComponent::IdleToRoll()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed())
+        if (MovementInput.InputRollPressed())
         {
             if (CharacterData->CharacterAbility.RollAbilityUnlocked())
             {
@@ -2083,7 +4517,7 @@ void UAdvanceMovementComponent::IdleToRoll()
                 {
                     ExitIdle();
                     SetSpecialMobility(RollMobility);
-                    UE_LOG(LogTemp, Error, TEXT("IDLE TO ROLL"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO ROLL"));
                     return;
                 }
                 else
@@ -2099,7 +4533,7 @@ void UAdvanceMovementComponent::IdleToDash()
 {
     if (CharacterData->IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed())
+        if (MovementInput.InputDashPressed())
         {
             if (CharacterData->CharacterAbility.DashAbilityUnlocked() && ValidDashRange(Dash->GetMaximumDistance()))
             {
@@ -2110,7 +4544,7 @@ void UAdvanceMovementComponent::IdleToDash()
                 {
                     ExitIdle();
                     SetSpecialMobility(DashMobility);
-                    UE_LOG(LogTemp, Error, TEXT("IDLE TO DASH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO DASH"));
                     return;
                 }
                 else
@@ -2159,7 +4593,7 @@ void UAdvanceMovementComponent::EnterWalk()
         SetLocomotionMode(ELocomotionMode::Ground);
         SetMovementAnimationState(EMovementAnimationState::Movement);
     }
-    UE_LOG(LogTemp, Error, TEXT("Enter Walk"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Walk"));
 
 
 }
@@ -2207,28 +4641,9 @@ void UAdvanceMovementComponent::TickWalkMovement()
                     SetMovementCameraShakeState(EMovementCameraShakeState::Walk);
                 }
             }
-
-            /*Basic Mobility */
-            WalkToIdle();
-            WalkToRun();
-            WalkToSprint();
-            WalkToCrouch();
-            WalkToProne();
-            WalkToCrawl();
-
-            /* Special Mobility */
-            WalkToJump();
-            WalkToRoll();
-            WalkToDash();
-
-            /* Advanced Mobility */
-            WalkToVault();
-            WalkToSwim();
-        }
-        else
-        {
-            WalkToFall();
         }
+
+        EvaluateTransitions(EMovementType::Walk);
     }
 }
 
@@ -2302,11 +4717,11 @@ void UAdvanceMovementComponent::WalkToIdle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             ExitWalk();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("WALK TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO IDLE"));
             return;
         }
     }
@@ -2321,13 +4736,13 @@ void UAdvanceMovementComponent::WalkToRun()
 
     if (IsPlayer())
     {
-		if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+		if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
 		{         
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitWalk();
                 SetBasicMovement(RunMovement);
-                UE_LOG(LogTemp, Error, TEXT("WALK TO RUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO RUN"));
                 return;
             }
 		}
@@ -2343,9 +4758,9 @@ void UAdvanceMovementComponent::WalkToSprint()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSprintPressed() || PlayerInputCache->InputSprintHeld())
+        if (MovementInput.InputSprintPressed() || MovementInput.InputSprintHeld())
         {   
-            if (PlayerInputCache->InputMoveForwardPressed() || PlayerInputCache->InputMoveForwardHeld())
+            if (MovementInput.InputMoveForwardPressed() || MovementInput.InputMoveForwardHeld())
             {
                 if (CharacterData->CharacterAbility.SprintAbilityUnlocked())
                 {
@@ -2353,7 +4768,7 @@ void UAdvanceMovementComponent::WalkToSprint()
                     {
                         ExitWalk();
                         SetBasicMovement(SprintMovement);
-                        UE_LOG(LogTemp, Error, TEXT("WALK TO SPRINT"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO SPRINT"));
                         return;
                     }
                 }
@@ -2371,7 +4786,7 @@ void UAdvanceMovementComponent::WalkToCrouch()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -2379,7 +4794,7 @@ void UAdvanceMovementComponent::WalkToCrouch()
                 {
                     ExitWalk();
                     SetBasicMovement(CrouchMovement);
-                    UE_LOG(LogTemp, Error, TEXT("WALK TO CROUCH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO CROUCH"));
                     return;
                 }
             }
@@ -2396,7 +4811,7 @@ void UAdvanceMovementComponent::WalkToProne()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed())
+        if (MovementInput.InputPronePressed())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -2404,7 +4819,7 @@ void UAdvanceMovementComponent::WalkToProne()
                 {
                     ExitWalk();
                     SetBasicMovement(ProneMovement);
-                    UE_LOG(LogTemp, Error, TEXT("WALK TO PRONE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO PRONE"));
                     return;
                 }
             }
@@ -2418,7 +4833,7 @@ void UAdvanceMovementComponent::WalkToCrawl()
     {
         ExitWalk();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("WALK TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO CRAWL"));
         return;
     }
 }
@@ -2427,7 +4842,7 @@ void UAdvanceMovementComponent::WalkToFall()
 {
     ExitWalk();
     SetBasicMovement(FallMovement);
-    UE_LOG(LogTemp, Error, TEXT("IDLE TO FALL"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO FALL"));
     return;
 }
 
@@ -2440,7 +4855,7 @@ void UAdvanceMovementComponent::WalkToJump()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed())
+        if (MovementInput.InputJumpPressed())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -2448,7 +4863,7 @@ void UAdvanceMovementComponent::WalkToJump()
                 {
                     ExitWalk();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("WALK TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO JUMP"));
                     return;
                 }
             }
@@ -2465,7 +4880,7 @@ void UAdvanceMovementComponent::WalkToRoll()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed())
+        if (MovementInput.InputRollPressed())
         {
             if (CharacterData->CharacterAbility.RollAbilityUnlocked())
             {
@@ -2473,7 +4888,7 @@ void UAdvanceMovementComponent::WalkToRoll()
                 {
                     ExitWalk();
                     SetSpecialMobility(RollMobility);
-                    UE_LOG(LogTemp, Error, TEXT("WALK TO ROLL"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO ROLL"));
                     return;
                 }
             }
@@ -2491,7 +4906,7 @@ void UAdvanceMovementComponent::WalkToDash()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed())
+        if (MovementInput.InputDashPressed())
         {
             if (CharacterData->CharacterAbility.DashAbilityUnlocked() && ValidDashRange(Dash->GetMaximumDistance()))
             {
@@ -2499,7 +4914,7 @@ void UAdvanceMovementComponent::WalkToDash()
                 {
                     ExitWalk();
                     SetSpecialMobility(ESpecialMovementState::Dash);
-                    UE_LOG(LogTemp, Error, TEXT("WALK TO DASH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALK TO DASH"));
                     return;
                 }
             }
@@ -2524,14 +4939,14 @@ void UAdvanceMovementComponent::WalkToVault()
                 {
                     if (VaultCheck())
                     {
-                        UE_LOG(LogTemp, Error, TEXT("Walk Vault Detected"));
+                        UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("Walk Vault Detected"));
                     }
                 }
             }
         }
         else
         {
-            if (PlayerInputCache->InputVaultPressed() || PlayerInputCache->InputVaultHeld())
+            if (MovementInput.InputVaultPressed() || MovementInput.InputVaultHeld())
             {
                 if (CharacterData->CharacterAbility.VaultAbilityUnlocked())
                 {
@@ -2539,7 +4954,7 @@ void UAdvanceMovementComponent::WalkToVault()
                     {
                         if (VaultCheck())
                         {
-                            UE_LOG(LogTemp, Error, TEXT("Walk Vault Detected"));
+                            UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("Walk Vault Detected"));
                         }
                     }
                 }
@@ -2580,7 +4995,7 @@ void UAdvanceMovementComponent::EnterRun()
         SetLocomotionMode(ELocomotionMode::Ground);
         SetMovementAnimationState(EMovementAnimationState::Movement);
     }
-    UE_LOG(LogTemp, Error, TEXT("Enter Run"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Run"));
 }
 
 void UAdvanceMovementComponent::TickRunMovement()
@@ -2636,28 +5051,9 @@ void UAdvanceMovementComponent::TickRunMovement()
             }
 
             RunSpeedControl();
-
-            /* Basic Mobility */
-            RunToIdle();
-            RunToWalk();
-            RunToSprint();
-            RunToCrouch();
-            RunToProne();
-            RunToCrawl();
-
-            /* Special Mobility */
-            RunToJump();
-            RunToSlide();
-            RunToDash();
-
-            /* Advance Mobility */
-            RunToVault();
-            RunToSwim();
-        }
-        else
-        {
-            RunToFall();
         }
+
+        EvaluateTransitions(EMovementType::Run);
     }
 }
 
@@ -2719,7 +5115,7 @@ void UAdvanceMovementComponent::UpdateRunTravelDistance()
 
 void UAdvanceMovementComponent::RunSpeedControl()
 {
-    if (PlayerInputCache->InputMoveForwardInActive())
+    if (MovementInput.InputMoveForwardInActive())
     {
         float CurrentVelocityY = GetOwner()->GetVelocity().Y; 
 
@@ -2743,11 +5139,11 @@ void UAdvanceMovementComponent::RunToIdle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {   
             ExitRun();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("RUN TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO IDLE"));
             return;           
         }
     }
@@ -2762,13 +5158,13 @@ void UAdvanceMovementComponent::RunToWalk()
 
     if (IsPlayer())
     {
-		if ((PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()) || SystemCore.PlayerMovementConfiguration.WalkEnabled())
+		if ((MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()) || SystemCore.PlayerMovementConfiguration.WalkEnabled())
 		{
-			if (PlayerInputCache->AnyMovementInputActive())
+			if (MovementInput.AnyMovementInputActive())
 			{
 				ExitRun();
 				SetBasicMovement(WalkMovement);
-				UE_LOG(LogTemp, Error, TEXT("RUN TO WALK"));
+				UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO WALK"));
 				return;
 			}
 		}
@@ -2785,9 +5181,9 @@ void UAdvanceMovementComponent::RunToSprint()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSprintPressed() || PlayerInputCache->InputSprintHeld())
+        if (MovementInput.InputSprintPressed() || MovementInput.InputSprintHeld())
         {
-            if (PlayerInputCache->InputMoveForwardPressed() || PlayerInputCache->InputMoveForwardHeld())
+            if (MovementInput.InputMoveForwardPressed() || MovementInput.InputMoveForwardHeld())
             {
                 if (CharacterData->CharacterAbility.SprintAbilityUnlocked())
                 {
@@ -2795,7 +5191,7 @@ void UAdvanceMovementComponent::RunToSprint()
                     {
                         ExitRun();
                         SetBasicMovement(SprintMovement);
-                        UE_LOG(LogTemp, Error, TEXT("RUN TO SPRINT"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO SPRINT"));
                         return;
                     }
                 }
@@ -2813,7 +5209,7 @@ void UAdvanceMovementComponent::RunToCrouch()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed())
+        if (MovementInput.InputCrouchPressed())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -2821,7 +5217,7 @@ void UAdvanceMovementComponent::RunToCrouch()
                 {
                     ExitRun();
                     SetBasicMovement(CrouchMovement);
-                    UE_LOG(LogTemp, Error, TEXT("RUN TO CROUCH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO CROUCH"));
                     return;
                 }
             }
@@ -2838,7 +5234,7 @@ void UAdvanceMovementComponent::RunToProne()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed())
+        if (MovementInput.InputPronePressed())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -2846,7 +5242,7 @@ void UAdvanceMovementComponent::RunToProne()
                 {
                     ExitRun();
                     SetBasicMovement(ProneMovement);
-                    UE_LOG(LogTemp, Error, TEXT("RUN TO PRONE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO PRONE"));
                     return;
                 }
             }
@@ -2865,7 +5261,7 @@ void UAdvanceMovementComponent::RunToCrawl()
     {
         ExitRun();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("RUN TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO CRAWL"));
         return;
     }
 }
@@ -2879,7 +5275,7 @@ void UAdvanceMovementComponent::RunToFall()
 
     ExitRun();
     SetBasicMovement(FallMovement);
-    UE_LOG(LogTemp, Error, TEXT("RUN TO FALL"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO FALL"));
     return;  
 }
 
@@ -2892,7 +5288,7 @@ void UAdvanceMovementComponent::RunToJump()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed())
+        if (MovementInput.InputJumpPressed())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -2900,7 +5296,7 @@ void UAdvanceMovementComponent::RunToJump()
                 {
                     ExitRun();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("RUN TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO JUMP"));
                     return;
                 }
             }
@@ -2917,7 +5313,7 @@ void UAdvanceMovementComponent::RunToSlide()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSlidePressed())
+        if (MovementInput.InputSlidePressed())
         {
             if (CharacterData->CharacterAbility.SlideAbilityUnlocked())
             {
@@ -2925,7 +5321,7 @@ void UAdvanceMovementComponent::RunToSlide()
                 {
                     ExitRun();
                     SetSpecialMobility(ESpecialMovementState::Slide);
-                    UE_LOG(LogTemp, Error, TEXT("RUN TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO JUMP"));
                     return;
                 }
             }
@@ -2942,7 +5338,7 @@ void UAdvanceMovementComponent::RunToDash()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed())
+        if (MovementInput.InputDashPressed())
         {
             if (CharacterData->CharacterAbility.DashAbilityUnlocked())
             {
@@ -2950,7 +5346,7 @@ void UAdvanceMovementComponent::RunToDash()
                 {
                     ExitRun();
                     SetSpecialMobility(ESpecialMovementState::Dash);
-                    UE_LOG(LogTemp, Error, TEXT("RUN TO DASH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO DASH"));
                     return;
                 }
             }
@@ -2977,7 +5373,7 @@ void UAdvanceMovementComponent::RunToVault()
                     {
                         ExitRun();
                         SetAdvanceMobility(EAdvanceMovementState::Vault);
-                        UE_LOG(LogTemp, Error, TEXT("RUN TO VAULT"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO VAULT"));
                         return;
                     }
                 }
@@ -2985,7 +5381,7 @@ void UAdvanceMovementComponent::RunToVault()
         }
         else
         {
-            if (PlayerInputCache->InputVaultPressed() || PlayerInputCache->InputVaultHeld())
+            if (MovementInput.InputVaultPressed() || MovementInput.InputVaultHeld())
             {
                 if (CharacterData->CharacterAbility.VaultAbilityUnlocked())
                 {
@@ -2995,7 +5391,7 @@ void UAdvanceMovementComponent::RunToVault()
                         {
                             ExitRun();
                             SetAdvanceMobility(EAdvanceMovementState::Vault);
-                            UE_LOG(LogTemp, Error, TEXT("RUN TO VAULT"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("RUN TO VAULT"));
                             return;
                         }
                     }
@@ -3037,7 +5433,7 @@ void UAdvanceMovementComponent::EnterSprint()
         SetMovementAnimationState(EMovementAnimationState::Movement);
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Sprint"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Sprint"));
 
 
 }
@@ -3101,32 +5497,12 @@ void UAdvanceMovementComponent::TickSprintMovement()
 
                 if (SystemCore.PlayerMovementConfiguration.IsDynamicMovementCameraShakeEnabled())
                 {
-                    SetMovementCameraShakeState(EMovementCameraShakeState::Sprint);
-                }
-            }
-
-            /* Basic Mobility */
-            SprintToIdle();
-            SprintToWalk();
-            SprintToRun();
-            SprintToProne();
-            SprintToCrawl();
-
-            /* Special Mobility */
-            SprintToJump();
-            SprintToSlide();
-            SprintToRoll();
-            SprintToDash();
-
-            /* Advance Mobility */
-            SprintToVault();
-            SprintToMantle();
-            SprintToSwim();
-        }
-        else
-        {
-            SprintToFall();
+                    SetMovementCameraShakeState(EMovementCameraShakeState::Sprint);
+                }
+            }
         }
+
+        EvaluateTransitions(EMovementType::Sprint);
     }
 }
 
@@ -3206,11 +5582,11 @@ void UAdvanceMovementComponent::SprintToIdle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             ExitSprint();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("SPRINT TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO IDLE"));
             return;
         }
     }
@@ -3227,26 +5603,26 @@ void UAdvanceMovementComponent::SprintToWalk()
     {
         if (SystemCore.PlayerMovementConfiguration.SprintToggleEnabled())
         {
-            if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+            if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
             {
-                if (PlayerInputCache->InputSprintPressed())
+                if (MovementInput.InputSprintPressed())
                 {
                     ExitSprint();
                     SetBasicMovement(WalkMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO WALK"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO WALK"));
                     return;
                 }
             }
         }
         else
         { 
-            if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+            if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
             {
-                if (PlayerInputCache->InputSprintReleased() || PlayerInputCache->InputSprintInActive())
+                if (MovementInput.InputSprintReleased() || MovementInput.InputSprintInActive())
                 {
                     ExitSprint();
                     SetBasicMovement(WalkMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO WALK"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO WALK"));
                     return;
                 }
             }       
@@ -3265,42 +5641,42 @@ void UAdvanceMovementComponent::SprintToRun()
     {
         ExitSprint();
         SetBasicMovement(RunMovement);
-        UE_LOG(LogTemp, Error, TEXT("SPRINT TO RUN (STAMINA DEPLETED)"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO RUN (STAMINA DEPLETED)"));
         return;
     }
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputMoveBackwardPressed() || PlayerInputCache->InputMoveBackwardHeld())
+        if (MovementInput.InputMoveBackwardPressed() || MovementInput.InputMoveBackwardHeld())
         {
             ExitSprint();
             SetBasicMovement(RunMovement);
-            UE_LOG(LogTemp, Error, TEXT("SPRINT TO RUN"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO RUN"));
             return;
         }
 
         if (SystemCore.PlayerMovementConfiguration.SprintToggleEnabled())
         {
-            if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+            if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
             {
-                if (PlayerInputCache->InputSprintPressed())
+                if (MovementInput.InputSprintPressed())
                 {
                     ExitSprint();
                     SetBasicMovement(RunMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO RUN"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO RUN"));
                     return;
                 }
             }
         }
         else
         {
-            if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+            if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
             {
-                if (PlayerInputCache->InputSprintReleased() || PlayerInputCache->InputSprintInActive())
+                if (MovementInput.InputSprintReleased() || MovementInput.InputSprintInActive())
                 {
                     ExitSprint();
                     SetBasicMovement(RunMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO RUN"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO RUN"));
                     return;
                 }
             }
@@ -3317,7 +5693,7 @@ void UAdvanceMovementComponent::SprintToProne()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed())
+        if (MovementInput.InputPronePressed())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -3325,7 +5701,7 @@ void UAdvanceMovementComponent::SprintToProne()
                 {
                     ExitSprint();
                     SetBasicMovement(ProneMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO PRONE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO PRONE"));
                     return;
                 }
             }
@@ -3344,7 +5720,7 @@ void UAdvanceMovementComponent::SprintToCrawl()
     {
         ExitSprint();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("SPRINT TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO CRAWL"));
         return;
     }
 }
@@ -3358,7 +5734,7 @@ void UAdvanceMovementComponent::SprintToFall()
 
     ExitSprint();
     SetBasicMovement(FallMovement);
-    UE_LOG(LogTemp, Error, TEXT("Sprint TO FALL"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Sprint TO FALL"));
     return;
 }
 
@@ -3371,7 +5747,7 @@ void UAdvanceMovementComponent::SprintToJump()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed())
+        if (MovementInput.InputJumpPressed())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -3379,7 +5755,7 @@ void UAdvanceMovementComponent::SprintToJump()
                 {
                     ExitSprint();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO JUMP"));
                     return;
                 }
             }
@@ -3397,8 +5773,8 @@ void UAdvanceMovementComponent::SprintToSlide()
     if (IsPlayer())
     {
         bool SlideInputsRequested =
-        (PlayerInputCache->InputSlidePressed() || PlayerInputCache->InputSlideHeld()) ||
-        (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld());
+        (MovementInput.InputSlidePressed() || MovementInput.InputSlideHeld()) ||
+        (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld());
 
         if (SlideInputsRequested)
         {
@@ -3411,7 +5787,7 @@ void UAdvanceMovementComponent::SprintToSlide()
                 {
                     ExitSprint();
                     SetSpecialMobility(SlideMobility);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO SLIDE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO SLIDE"));
                     return;
                 }
             }
@@ -3428,7 +5804,7 @@ void UAdvanceMovementComponent::SprintToRoll()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed())
+        if (MovementInput.InputRollPressed())
         {
             if (CharacterData->CharacterAbility.RollAbilityUnlocked())
             {
@@ -3439,7 +5815,7 @@ void UAdvanceMovementComponent::SprintToRoll()
                 {
                     ExitSprint();
                     SetSpecialMobility(RollMobility);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO ROLL"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO ROLL"));
                     return;
                 }
             }
@@ -3456,7 +5832,7 @@ void UAdvanceMovementComponent::SprintToDash()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed() || PlayerInputCache->InputDashHeld())
+        if (MovementInput.InputDashPressed() || MovementInput.InputDashHeld())
         {
             if (CharacterData->CharacterAbility.DashAbilityUnlocked() && ValidDashRange(Dash->GetMaximumDistance()))
             {
@@ -3467,7 +5843,7 @@ void UAdvanceMovementComponent::SprintToDash()
                 {
                     ExitSprint();
                     SetSpecialMobility(DashMobility);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO DASH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO DASH"));
                     return;
                 }
             }
@@ -3497,7 +5873,7 @@ void UAdvanceMovementComponent::SprintToVault()
                     {
                         ExitSprint();
                         SetAdvanceMobility(VaultMobility);
-                        UE_LOG(LogTemp, Error, TEXT("SPRINT TO VAULT"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO VAULT"));
                         return;
                     } 
                 }               
@@ -3505,7 +5881,7 @@ void UAdvanceMovementComponent::SprintToVault()
         }
         else
         {
-            if (PlayerInputCache->InputVaultPressed() || PlayerInputCache->InputVaultHeld())
+            if (MovementInput.InputVaultPressed() || MovementInput.InputVaultHeld())
             {
                 if (CharacterData->CharacterAbility.VaultAbilityUnlocked())
                 {
@@ -3518,7 +5894,7 @@ void UAdvanceMovementComponent::SprintToVault()
                         {
                             ExitSprint();
                             SetAdvanceMobility(VaultMobility);
-                            UE_LOG(LogTemp, Error, TEXT("SPRINT TO VAULT"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO VAULT"));
                             return;
                         }
                     }
@@ -3545,14 +5921,14 @@ void UAdvanceMovementComponent::SprintToMantle()
                 {
                     ExitSprint();
                     SetAdvanceMobility(EAdvanceMovementState::Mantle);
-                    UE_LOG(LogTemp, Error, TEXT("SPRINT TO MANTLE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO MANTLE"));
                     return;
                 }
             }
         }
         else
         {
-            if (PlayerInputCache->InputMantlePressed() || PlayerInputCache->InputMantleHeld())
+            if (MovementInput.InputMantlePressed() || MovementInput.InputMantleHeld())
             {
                 if (CharacterData->CharacterAbility.MantleAbilityUnlocked())
                 {
@@ -3560,7 +5936,7 @@ void UAdvanceMovementComponent::SprintToMantle()
                     {
                         ExitSprint();
                         SetAdvanceMobility(EAdvanceMovementState::Mantle);
-                        UE_LOG(LogTemp, Error, TEXT("SPRINT TO MANTLE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SPRINT TO MANTLE"));
                         return;
                     }
                 }
@@ -3602,7 +5978,7 @@ void UAdvanceMovementComponent::EnterCrawl()
         SetMovementAnimationState(EMovementAnimationState::CrawlIdle);
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Crawl"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Crawl"));
 }
 
 void UAdvanceMovementComponent::TickCrawlMovement()
@@ -3652,18 +6028,13 @@ void UAdvanceMovementComponent::TickCrawlMovement()
                 }
 
             }
-
-            if (CharacterData->CharacterAttribute.CharacterStat.GetHealth() > 0)
-            {
-                CrawlToIdle();
-                CrawlToCrouch();
-                CrawlToProne();
-            }
-        }
-        else
-        {
-            CrawlToFall();
         }
+
+        EvaluateTransitions
+        (
+            EMovementType::Crawl,
+            CharacterData->CharacterAttribute.CharacterStat.GetHealth() > 0 ? EMovementTransitionContext::Recovered : EMovementTransitionContext::None
+        );
     }
 }
 
@@ -3763,11 +6134,11 @@ void UAdvanceMovementComponent::CrawlToIdle()
 {
     if (CharacterData->IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchInActive() && PlayerInputCache->InputProneInActive() && PlayerInputCache->InputRollInActive())
+        if (MovementInput.InputCrouchInActive() && MovementInput.InputProneInActive() && MovementInput.InputRollInActive())
         {
             ExitCrawl();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("CRAWL TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("CRAWL TO IDLE"));
             return;
         }
     }
@@ -3775,7 +6146,7 @@ void UAdvanceMovementComponent::CrawlToIdle()
     {
         ExitCrawl();
         SetBasicMovement(IdleMovement);
-        UE_LOG(LogTemp, Error, TEXT("CRAWL TO IDLE"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("CRAWL TO IDLE"));
         return;
     }
 }
@@ -3784,7 +6155,7 @@ void UAdvanceMovementComponent::CrawlToCrouch()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -3792,7 +6163,7 @@ void UAdvanceMovementComponent::CrawlToCrouch()
                 {
                     ExitCrawl();
                     SetBasicMovement(CrouchMovement);
-                    UE_LOG(LogTemp, Error, TEXT("CRAWL TO CROUCH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("CRAWL TO CROUCH"));
                     return;
                 }
             }
@@ -3804,7 +6175,7 @@ void UAdvanceMovementComponent::CrawlToProne()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed() ||PlayerInputCache->InputProneHeld())
+        if (MovementInput.InputPronePressed() ||MovementInput.InputProneHeld())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -3812,7 +6183,7 @@ void UAdvanceMovementComponent::CrawlToProne()
                 {
                     ExitCrawl();
                     SetBasicMovement(ProneMovement);
-                    UE_LOG(LogTemp, Error, TEXT("CRAWL TO PRONE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("CRAWL TO PRONE"));
                     return;
                 }
             }
@@ -3824,7 +6195,7 @@ void UAdvanceMovementComponent::CrawlToFall()
 {
     ExitCrawl();
     SetBasicMovement(FallMovement);
-    UE_LOG(LogTemp, Error, TEXT("CRAWL TO FALL"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("CRAWL TO FALL"));
     return;
 }
 
@@ -3861,7 +6232,7 @@ void UAdvanceMovementComponent::EnterCrouch()
         SetMovementAnimationState(EMovementAnimationState::CrouchIdle);
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Crouch"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Crouch"));
 }
 
 void UAdvanceMovementComponent::TickCrouchMovement()
@@ -3930,14 +6301,6 @@ void UAdvanceMovementComponent::TickCrouchMovement()
                 }
             }
 
-            CrouchToIdle();
-            CrouchToWalk();
-            CrouchToRun();
-            CrouchToJump();
-            CrouchToSlide();
-            CrouchToRoll();
-            CrouchToProne();
-            CrouchToCrawl();
 
             if (HorizontalVelocitySize() > 0)
             {
@@ -3948,16 +6311,13 @@ void UAdvanceMovementComponent::TickCrouchMovement()
                 SetMovementCameraShakeState(EMovementCameraShakeState::CrouchIdle);
             }
         }
-        else
-        {
-            if (GroundDistance() >= 50.0f)
-            {
-                CrouchToFall();
-            }
-        }
-    }
-
 
+        EvaluateTransitions
+        (
+            EMovementType::Crouch,
+            !IsMovingOnGround() && GroundDistance() >= 50.0f ? EMovementTransitionContext::Drop : EMovementTransitionContext::None
+        );
+    }
 }
 
 void UAdvanceMovementComponent::ExitCrouch()
@@ -4067,15 +6427,15 @@ void UAdvanceMovementComponent::CrouchToIdle()
     {
         if (SystemCore.PlayerMovementConfiguration.CrouchToggleEnabled())
         {
-            if (PlayerInputCache->InputCrouchPressed())
+            if (MovementInput.InputCrouchPressed())
             {
-                if (PlayerInputCache->MovementInputsInActive())
+                if (MovementInput.MovementInputsInActive())
                 {
                     if (UnCrouchHeightValidation())
                     {
                         ExitCrouch();
                         SetBasicMovement(IdleMovement);
-                        UE_LOG(LogTemp, Error, TEXT("CROUCH TO IDLE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO IDLE"));
                         return;
                     }
                 }
@@ -4083,15 +6443,15 @@ void UAdvanceMovementComponent::CrouchToIdle()
         }
         else
         {
-            if (PlayerInputCache->InputCrouchReleased() || PlayerInputCache->InputCrouchInActive())
+            if (MovementInput.InputCrouchReleased() || MovementInput.InputCrouchInActive())
             {
-                if (PlayerInputCache->MovementInputsInActive())
+                if (MovementInput.MovementInputsInActive())
                 {
                     if (UnCrouchHeightValidation())
                     {
                         ExitCrouch();
                         SetBasicMovement(IdleMovement);
-                        UE_LOG(LogTemp, Error, TEXT("CROUCH TO IDLE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO IDLE"));
                         return;
                     }
                 }
@@ -4106,17 +6466,17 @@ void UAdvanceMovementComponent::CrouchToWalk()
     {
         if (SystemCore.PlayerMovementConfiguration.CrouchToggleEnabled())
         {
-            if (PlayerInputCache->InputCrouchPressed())
+            if (MovementInput.InputCrouchPressed())
             {
-                if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+                if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
                 {
-                    if (PlayerInputCache->AnyMovementInputActive())
+                    if (MovementInput.AnyMovementInputActive())
                     {
                         if (UnCrouchHeightValidation())
                         {
                             ExitCrouch();
                             SetBasicMovement(WalkMovement);
-                            UE_LOG(LogTemp, Error, TEXT("CROUCH TO WALK"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO WALK"));
                             return;
                         }
                     }
@@ -4125,17 +6485,17 @@ void UAdvanceMovementComponent::CrouchToWalk()
         }
         else
         {
-            if (PlayerInputCache->InputCrouchReleased() || PlayerInputCache->InputCrouchInActive())
+            if (MovementInput.InputCrouchReleased() || MovementInput.InputCrouchInActive())
             {
-                if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+                if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
                 {
-                    if (PlayerInputCache->AnyMovementInputActive())
+                    if (MovementInput.AnyMovementInputActive())
                     {
                         if (UnCrouchHeightValidation())
                         {
                             ExitCrouch();
                             SetBasicMovement(WalkMovement);
-                            UE_LOG(LogTemp, Error, TEXT("CROUCH TO WALK"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO WALK"));
                             return;
                         }
                     }
@@ -4152,17 +6512,17 @@ void UAdvanceMovementComponent::CrouchToRun()
     {
         if (SystemCore.PlayerMovementConfiguration.CrouchToggleEnabled())
         {
-            if (PlayerInputCache->InputCrouchPressed())
+            if (MovementInput.InputCrouchPressed())
             {
-                if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+                if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
                 {
-                    if (PlayerInputCache->AnyMovementInputActive())
+                    if (MovementInput.AnyMovementInputActive())
                     {
                         if (UnCrouchHeightValidation())
                         {
                             ExitCrouch();
                             SetBasicMovement(RunMovement);
-                            UE_LOG(LogTemp, Error, TEXT("CROUCH TO RUN"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO RUN"));
                             return;
                         }
                     }
@@ -4171,17 +6531,17 @@ void UAdvanceMovementComponent::CrouchToRun()
         }
         else
         {
-            if (PlayerInputCache->InputCrouchReleased() || PlayerInputCache->InputCrouchInActive())
+            if (MovementInput.InputCrouchReleased() || MovementInput.InputCrouchInActive())
             {
-                if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+                if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
                 {
-                    if (PlayerInputCache->AnyMovementInputActive())
+                    if (MovementInput.AnyMovementInputActive())
                     {
                         if (UnCrouchHeightValidation())
                         {
                             ExitCrouch();
                             SetBasicMovement(RunMovement);
-                            UE_LOG(LogTemp, Error, TEXT("CROUCH TO RUN"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO RUN"));
                             return;
                         }
                     }
@@ -4196,7 +6556,7 @@ void UAdvanceMovementComponent::CrouchToJump()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed())
+        if (MovementInput.InputJumpPressed())
         {
             if (SystemCore.PlayerMovementConfiguration.IsJumpWhileCrouchedEnabled())
             {
@@ -4206,7 +6566,7 @@ void UAdvanceMovementComponent::CrouchToJump()
                     {
                         ExitCrouch();
                         SetSpecialMobility(JumpMobility);
-                        UE_LOG(LogTemp, Error, TEXT("Crouch to Jump"));
+                        UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("Crouch to Jump"));
                         return;
                     }
                 }
@@ -4219,7 +6579,7 @@ void UAdvanceMovementComponent::CrouchToSlide()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSlidePressed())
+        if (MovementInput.InputSlidePressed())
         {
             if (CharacterData->CharacterAbility.SlideAbilityUnlocked())
             {
@@ -4227,7 +6587,7 @@ void UAdvanceMovementComponent::CrouchToSlide()
                 {
                     ExitCrouch();
                     SetSpecialMobility(SlideMobility);
-                    UE_LOG(LogTemp, Error, TEXT("Crouch to Jump"));
+                    UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("Crouch to Jump"));
                     return;
                 }
             }
@@ -4239,7 +6599,7 @@ void UAdvanceMovementComponent::CrouchToRoll()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed())
+        if (MovementInput.InputRollPressed())
         {
             if (CharacterData->CharacterAbility.RollAbilityUnlocked())
             {
@@ -4247,7 +6607,7 @@ void UAdvanceMovementComponent::CrouchToRoll()
                 {
                     ExitCrouch();
                     SetSpecialMobility(RollMobility);
-                    UE_LOG(LogTemp, Error, TEXT("CROUCH TO ROLL"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO ROLL"));
                     return;
                 }
             }
@@ -4260,7 +6620,7 @@ void UAdvanceMovementComponent::CrouchToProne()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputProneHeld())
+        if (MovementInput.InputProneHeld())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -4268,7 +6628,7 @@ void UAdvanceMovementComponent::CrouchToProne()
                 {
                     ExitCrouch();
                     SetBasicMovement(ProneMovement);
-                    UE_LOG(LogTemp, Error, TEXT("CROUCH TO PRONE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO PRONE"));
                     return;
                 }
             }
@@ -4282,7 +6642,7 @@ void UAdvanceMovementComponent::CrouchToCrawl()
     {
         ExitCrouch();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("CROUCH TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO CRAWL"));
         return;
     }
 }
@@ -4291,7 +6651,7 @@ void UAdvanceMovementComponent::CrouchToFall()
 {
     ExitCrouch();
     SetBasicMovement(FallMovement);
-    UE_LOG(LogTemp, Error, TEXT("CROUCH TO FALL"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("CROUCH TO FALL"));
     return;
 }
 
@@ -4319,7 +6679,7 @@ void UAdvanceMovementComponent::EnterProne()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Prone"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Prone"));
 }
 
 void UAdvanceMovementComponent::TickProneMovement()
@@ -4370,13 +6730,6 @@ void UAdvanceMovementComponent::TickProneMovement()
                 }
             }
 
-            ProneToIdle();
-            ProneToWalk();
-            ProneToRun();
-            ProneToRoll();
-            ProneToCrouch();
-            ProneToCrawl();
-            ProneToForwardThrust();
 
 
             if (SystemCore.PlayerMovementConfiguration.IsDynamicMovementCameraShakeEnabled())
@@ -4390,11 +6743,16 @@ void UAdvanceMovementComponent::TickProneMovement()
                     SetMovementCameraShakeState(EMovementCameraShakeState::ProneIdle);
                 }
             }
+
+            // The thrust launches the character but stays in Prone, so it is an action of this state rather than a graph edge.
+            // Its guard waits for a jump press, so it only needs to run when the input changed.
+            if (IsMovementSignalDirty(EMovementSignal::Input))
+            {
+                TryProneForwardThrust();
+            }
         }
-        else
-        {
-            ProneToFall();
-        }
+
+        EvaluateTransitions(EMovementType::Prone);
     }
 }
 
@@ -4489,6 +6847,26 @@ bool UAdvanceMovementComponent::CanProneThrustForward()
     return !bHit; 
 }
 
+void UAdvanceMovementComponent::TryProneForwardThrust()
+{
+    if (IsPlayer())
+    {
+        if (MovementInput.InputJumpPressed())
+        {
+            if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
+            {
+                if (CharacterData->CharacterAttribute.CharacterStat.GetStamina() >= Prone->GetStaminaCost() * 1.5f)
+                {
+                    if (CanProneThrustForward())
+                    {
+                        ProneForwardThrust();
+                    }
+                }
+            }
+        }
+    }
+}
+
 #pragma endregion
 
 #pragma region Transition
@@ -4497,13 +6875,13 @@ void UAdvanceMovementComponent::ProneToIdle()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputProneReleased() || PlayerInputCache->InputProneInActive())
+        if (MovementInput.InputProneReleased() || MovementInput.InputProneInActive())
         {
-            if (PlayerInputCache->MovementInputsInActive())
+            if (MovementInput.MovementInputsInActive())
             {
                 ExitProne();
                 SetBasicMovement(IdleMovement);
-                UE_LOG(LogTemp, Error, TEXT("PRONE TO IDLE"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("PRONE TO IDLE"));
                 return;
             }
         }
@@ -4514,15 +6892,15 @@ void UAdvanceMovementComponent::ProneToWalk()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputProneReleased() || PlayerInputCache->InputProneInActive())
+        if (MovementInput.InputProneReleased() || MovementInput.InputProneInActive())
         {
-            if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || PlayerInputCache->InputWalkHeld())
+            if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || MovementInput.InputWalkHeld())
             {
-                if (PlayerInputCache->AnyMovementInputActive())
+                if (MovementInput.AnyMovementInputActive())
                 {
                     ExitProne();
                     SetBasicMovement(WalkMovement);
-                    UE_LOG(LogTemp, Error, TEXT("PRONE TO WALK"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("PRONE TO WALK"));
                     return;
                 }
             }
@@ -4534,15 +6912,15 @@ void UAdvanceMovementComponent::ProneToRun()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputProneReleased() || PlayerInputCache->InputProneInActive())
+        if (MovementInput.InputProneReleased() || MovementInput.InputProneInActive())
         {
-            if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+            if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
             {
-                if (PlayerInputCache->AnyMovementInputActive())
+                if (MovementInput.AnyMovementInputActive())
                 {
                     ExitProne();
                     SetBasicMovement(RunMovement);
-                    UE_LOG(LogTemp, Error, TEXT("PRONE TO RUN"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("PRONE TO RUN"));
                     return;
                 }
             }
@@ -4554,7 +6932,7 @@ void UAdvanceMovementComponent::ProneToRoll()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed())
+        if (MovementInput.InputRollPressed())
         {
             if (CharacterData->CharacterAbility.RollAbilityUnlocked())
             {
@@ -4562,7 +6940,7 @@ void UAdvanceMovementComponent::ProneToRoll()
                 {
                     ExitProne();
                     SetSpecialMobility(RollMobility);
-                    UE_LOG(LogTemp, Error, TEXT("PRONE TO ROLL"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("PRONE TO ROLL"));
                     return;
                 }
             }
@@ -4574,13 +6952,13 @@ void UAdvanceMovementComponent::ProneToCrouch()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed())
+        if (MovementInput.InputCrouchPressed())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
                 ExitProne();
                 SetBasicMovement(CrouchMovement);
-                UE_LOG(LogTemp, Error, TEXT("PRONE TO CROUCH"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("PRONE TO CROUCH"));
                 return;
             }
         }
@@ -4593,7 +6971,7 @@ void UAdvanceMovementComponent::ProneToCrawl()
     {
         ExitProne();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("PRONE TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("PRONE TO CRAWL"));
         return;
     }
 }
@@ -4606,26 +6984,6 @@ void UAdvanceMovementComponent::ProneToFall()
     return;
 }
 
-void UAdvanceMovementComponent::ProneToForwardThrust()
-{
-    if (IsPlayer())
-    {
-        if (PlayerInputCache->InputJumpPressed())
-        {
-            if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
-            {
-                if (CharacterData->CharacterAttribute.CharacterStat.GetStamina() >= Prone->GetStaminaCost() * 1.5f)
-                {
-                    if (CanProneThrustForward())
-                    {
-                        ProneForwardThrust();
-                    }
-                }
-            }
-        }
-    }
-}
-
 #pragma endregion
 
 #pragma endregion
@@ -4647,7 +7005,7 @@ void UAdvanceMovementComponent::EnterFall()
         SetMovementAnimationState(EMovementAnimationState::Fall);
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Fall"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Fall"));
 }
 
 void UAdvanceMovementComponent::TickFallMovement()
@@ -4676,22 +7034,12 @@ void UAdvanceMovementComponent::TickFallMovement()
                 SetMovementCameraShakeState(EMovementCameraShakeState::Fall);
             }
         }
-        
-        FallToVerticalWallRun();
 
-        if (FMath::IsNearlyZero(GroundDistance(), 1.0f) && IsMovingOnGround())
-        {
-            FallToIdle();
-            FallToWalk();
-            FallToRun();
-            FallToCrouch();
-            FallToSlide();
-            FallToRoll();
-            FallToCrawl();
-        }
-        
-        FallToJump();
-        FallToHang();
+        EvaluateTransitions
+        (
+            EMovementType::Fall,
+            IsMovingOnGround() && FMath::IsNearlyZero(GroundDistance(), 1.0f) ? EMovementTransitionContext::Landed : EMovementTransitionContext::None
+        );
     }
 }
 
@@ -4764,11 +7112,11 @@ void UAdvanceMovementComponent::FallToIdle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive() || HorizontalVelocitySize() <= 0)
+        if (MovementInput.MovementInputsInActive() || HorizontalVelocitySize() <= 0)
         {
             ExitFall();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("FALL TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO IDLE"));
             return;
         }
     }
@@ -4783,13 +7131,13 @@ void UAdvanceMovementComponent::FallToWalk()
 
     if (IsPlayer())
     {
-        if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+        if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitFall();
                 SetBasicMovement(WalkMovement);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO WALK"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO WALK"));
                 return;
             }
         }
@@ -4805,13 +7153,13 @@ void UAdvanceMovementComponent::FallToRun()
 
     if (IsPlayer())
     {
-        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitFall();
                 SetBasicMovement(RunMovement);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO RUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO RUN"));
                 return;
             }
         }
@@ -4832,7 +7180,7 @@ void UAdvanceMovementComponent::FallToCrouch()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -4840,7 +7188,7 @@ void UAdvanceMovementComponent::FallToCrouch()
                 {
                     ExitFall();
                     SetBasicMovement(CrouchMovement);
-                    UE_LOG(LogTemp, Error, TEXT("FALL TO CROUCH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO CROUCH"));
                     return;
                 }
             }
@@ -4859,7 +7207,7 @@ void UAdvanceMovementComponent::FallToCrawl()
     {
         ExitFall();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("FALL TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO CRAWL"));
         return;
     }
 }
@@ -4873,13 +7221,13 @@ void UAdvanceMovementComponent::FallToSlide()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSlidePressed() || PlayerInputCache->InputSlideHeld())
+        if (MovementInput.InputSlidePressed() || MovementInput.InputSlideHeld())
         {
             if (GroundDistance() <= 5.0f)
             {
                 ExitFall();
                 SetSpecialMobility(SlideMobility);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO SLIDE"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO SLIDE"));
                 return;
             }
         }
@@ -4895,13 +7243,13 @@ void UAdvanceMovementComponent::FallToRoll()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed() || PlayerInputCache->InputRollHeld())
+        if (MovementInput.InputRollPressed() || MovementInput.InputRollHeld())
         {
             if (GroundDistance() <= 5.0f)
             {
                 ExitFall();
                 SetSpecialMobility(RollMobility);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO ROLL"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO ROLL"));
                 return;
             }
         }
@@ -4916,7 +7264,7 @@ void UAdvanceMovementComponent::FallToWallRun()
     }
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSprintReleased() || PlayerInputCache->InputSprintInActive())
+        if (MovementInput.InputSprintReleased() || MovementInput.InputSprintInActive())
         {
             return;
         }
@@ -4927,17 +7275,17 @@ void UAdvanceMovementComponent::FallToWallRun()
             {
                 ExitFall();
                 SetSpecialMobility(WallRunMobility);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO WALLRUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO WALLRUN"));
                 return;
             }
         }
-        else if (PlayerInputCache->InputJumpHeld())
+        else if (MovementInput.InputJumpHeld())
         {
             if (DiagonalWallDetected())
             {
                 ExitFall();
                 SetSpecialMobility(WallRunMobility);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO WALLRUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO WALLRUN"));
                 return;
             }
         }
@@ -4953,7 +7301,7 @@ void UAdvanceMovementComponent::FallToVerticalWallRun()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpHeld() && PlayerInputCache->InputMoveForwardHeld())
+        if (MovementInput.InputJumpHeld() && MovementInput.InputMoveForwardHeld())
         {
             if (CharacterData->CharacterAbility.VerticalWallRunAbilityUnlocked())
             {
@@ -4965,7 +7313,7 @@ void UAdvanceMovementComponent::FallToVerticalWallRun()
                         {
                             ExitFall();
                             SetSpecialMobility(VerticalWallRunMobility);
-                            UE_LOG(LogTemp, Error, TEXT("FALL TO VERTICAL WALL RUN"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO VERTICAL WALL RUN"));
                             return;
                         }
                     }
@@ -4994,7 +7342,7 @@ void UAdvanceMovementComponent::FallToHang()
                     {
                         ExitFall();
                         SetSpecialMobility(ESpecialMovementState::Hang);
-                        UE_LOG(LogTemp, Error, TEXT("FALL TO HANG"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO HANG"));
                         return;
                     }
                 }
@@ -5002,7 +7350,7 @@ void UAdvanceMovementComponent::FallToHang()
         }
         else
         {
-            if (PlayerInputCache->InputHangPressed() || PlayerInputCache->InputHangHeld())
+            if (MovementInput.InputHangPressed() || MovementInput.InputHangHeld())
             {
                 if (CharacterData->CharacterAbility.HangAbilityUnlocked())
                 {
@@ -5012,7 +7360,7 @@ void UAdvanceMovementComponent::FallToHang()
                         {
                             ExitFall();
                             SetSpecialMobility(ESpecialMovementState::Hang);
-                            UE_LOG(LogTemp, Error, TEXT("FALL TO HANG"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO HANG"));
                             return;
                         }
                     }
@@ -5038,7 +7386,7 @@ void UAdvanceMovementComponent::FallToJump()
     {
         if (CharacterData->CharacterAbility.JumpAbilityUnlocked() && CharacterData->CharacterAbility.CoyoteJumpAbilityUnlocked())
         {
-            if (PlayerInputCache->InputJumpPressed())
+            if (MovementInput.InputJumpPressed())
             {
                 if (CharacterData->CharacterAttribute.CharacterStat.GetHealth() >= Jump->GetStaminaCost())
                 {
@@ -5046,7 +7394,7 @@ void UAdvanceMovementComponent::FallToJump()
                     {
                         ExitFall();
                         SetSpecialMobility(JumpMobility);
-                        UE_LOG(LogTemp, Error, TEXT("FALL TO JUMP"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO JUMP"));
                         return;
                     }
                 }
@@ -5074,7 +7422,7 @@ void UAdvanceMovementComponent::FallToGlide()
                     {
                         ExitFall();
                         SetAdvanceMobility(GlideMobility);
-                        UE_LOG(LogTemp, Error, TEXT("FALL TO HANG"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO HANG"));
                         return;
                     }
                 }
@@ -5082,7 +7430,7 @@ void UAdvanceMovementComponent::FallToGlide()
         }
         else
         {
-            if (PlayerInputCache->InputGlidePressed())
+            if (MovementInput.InputGlidePressed())
             {
                 if (CharacterData->CharacterAbility.GlideAbilityUnlocked())
                 {
@@ -5092,7 +7440,7 @@ void UAdvanceMovementComponent::FallToGlide()
                         {
                             ExitFall();
                             SetAdvanceMobility(GlideMobility);
-                            UE_LOG(LogTemp, Error, TEXT("FALL TO HANG"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO HANG"));
                             return;
                         }
                     }
@@ -5116,15 +7464,18 @@ void UAdvanceMovementComponent::FallToDive()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDivePressed() || PlayerInputCache->InputDiveHeld())
+        if (MovementInput.InputDivePressed() || MovementInput.InputDiveHeld())
         {
             if (CharacterData->CharacterAbility.DiveAbilityUnlocked())
             {
-                if (Fall->GetDuration() >= 3.0f && GroundDistance() >= Dive->GetMinimumDistance())
+                // Over water the dive needs enough depth below the capsule; elsewhere enough height above the ground.
+                const float DiveClearance = IsInWaterBody() ? GetWaterDepthBelow() : GroundDistance();
+
+                if (Fall->GetDuration() >= 3.0f && DiveClearance >= Dive->GetMinimumDistance())
                 {
                     ExitFall();
                     SetAdvanceMobility(DiveMobility);
-                    UE_LOG(LogTemp, Error, TEXT("FALL TO DIVE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO DIVE"));
                     return;
                 }
             }
@@ -5163,7 +7514,7 @@ void UAdvanceMovementComponent::FallToFly()
             {
                 ExitFall();
                 SetAdvanceMobility(FlyMobility);
-                UE_LOG(LogTemp, Error, TEXT("FALL TO FLY"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("FALL TO FLY"));
                 return;
             }
         }
@@ -5190,7 +7541,7 @@ void UAdvanceMovementComponent::SetSpecialMobility(ESpecialMovementState NewSpec
     {
 #if DEV_DEBUG_MODE
         // Log a warning for attempting to set the same SpecialMobilityState state.
-        UE_LOG(LogTemp, Error, TEXT("Attempted to set the same SpecialMobilityState state."));
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Attempted to set the same SpecialMobilityState state."));
 #endif
         return;
     }
@@ -5215,7 +7566,7 @@ void UAdvanceMovementComponent::SwitchSpecialMobilityState(ESpecialMovementState
     {
     case ESpecialMovementState::Null:
 #if DEV_DEBUG_MODE
-        UE_LOG(LogTemp, Warning, TEXT("SpecialMobilityState state set to Null. No special mobility actions will be executed. Ensure this is expected."));
+        UE_LOG(LogAdvanceMovement, Warning, TEXT("SpecialMobilityState state set to Null. No special mobility actions will be executed. Ensure this is expected."));
 #endif
         break;
     case ESpecialMovementState::Jump:
@@ -5273,7 +7624,7 @@ void UAdvanceMovementComponent::EnterJump()
                 SetMovementCameraShakeState(EMovementCameraShakeState::JumpEnter);
             }
         }
-        UE_LOG(LogTemp, Error, TEXT("Enter Jump"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Jump"));
 
         SetLocomotionMode(ELocomotionMode::Aerial);
         SetMovementAnimationState(EMovementAnimationState::JumpStart);
@@ -5341,25 +7692,20 @@ void UAdvanceMovementComponent::TickJumpMovement()
 
         float DeltaSecond = GetWorld()->GetDeltaSeconds();
         GroundCheckTimer += DeltaSecond;
-        if (FMath::IsNearlyZero(GroundDistance(), 1.0f) && GroundCheckTimer >= 1.0f)
-        {
-            JumpToIdle();
-            JumpToWalk();
-            JumpToRun();
-        }
 
-        JumpToVerticalWallRun();
-        JumpToMantle();
+        EMovementTransitionContext Context = EMovementTransitionContext::None;
 
-        if (Velocity.Z <= Fall->GetTransitionThreshold())
+        if (GroundCheckTimer >= 1.0f && FMath::IsNearlyZero(GroundDistance(), 1.0f))
         {
-            JumpToFall();
+            Context |= EMovementTransitionContext::Landed;
         }
-        else
+
+        if (Velocity.Z <= Fall->GetTransitionThreshold())
         {
-            JumpToHang();
-            JumpToWallRun();
+            Context |= EMovementTransitionContext::Descending;
         }
+
+        EvaluateTransitions(EMovementType::Jump, Context);
     }
 }
 
@@ -5770,11 +8116,11 @@ void UAdvanceMovementComponent::JumpToIdle()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             ExitJump();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("JUMP TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO IDLE"));
             return;
         }
     }
@@ -5784,13 +8130,13 @@ void UAdvanceMovementComponent::JumpToWalk()
 {
     if (IsPlayer())
     {
-        if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()))
+        if (SystemCore.PlayerMovementConfiguration.WalkEnabled() || (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()))
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitJump();
                 SetBasicMovement(WalkMovement);
-                UE_LOG(LogTemp, Error, TEXT("JUMP TO WALK"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO WALK"));
                 return;
             }
         }
@@ -5801,13 +8147,13 @@ void UAdvanceMovementComponent::JumpToRun()
 {
     if (IsPlayer())
     {
-        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitJump();
                 SetBasicMovement(RunMovement);
-                UE_LOG(LogTemp, Error, TEXT("JUMP TO RUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO RUN"));
                 return;
             }
         }
@@ -5828,15 +8174,15 @@ void UAdvanceMovementComponent::JumpToMantle()
                     {
                         ExitJump();
                         SetAdvanceMobility(EAdvanceMovementState::Mantle);
-                        UE_LOG(LogTemp, Error, TEXT("JUMP TO MANTLE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO MANTLE"));
                         return;
                     }
                 }
             }
         }
-        else if (PlayerInputCache->InputJumpPressed() || PlayerInputCache->InputJumpHeld())
+        else if (MovementInput.InputJumpPressed() || MovementInput.InputJumpHeld())
         {
-            if (PlayerInputCache->InputMoveForwardPressed() || PlayerInputCache->InputMoveForwardHeld())
+            if (MovementInput.InputMoveForwardPressed() || MovementInput.InputMoveForwardHeld())
             {
                 if (CharacterData->CharacterAbility.MantleAbilityUnlocked())
                 {
@@ -5846,7 +8192,7 @@ void UAdvanceMovementComponent::JumpToMantle()
                         {
                             ExitJump();
                             SetAdvanceMobility(EAdvanceMovementState::Mantle);
-                            UE_LOG(LogTemp, Error, TEXT("JUMP TO MANTLE"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO MANTLE"));
                             return;
                         }
                     }
@@ -5865,7 +8211,7 @@ void UAdvanceMovementComponent::JumpToWallRun()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputMoveBackwardPressed() || PlayerInputCache->InputMoveBackwardHeld())
+        if (MovementInput.InputMoveBackwardPressed() || MovementInput.InputMoveBackwardHeld())
         {
             return;
         }
@@ -5880,7 +8226,7 @@ void UAdvanceMovementComponent::JumpToWallRun()
                     {
                         ExitJump();
                         SetSpecialMobility(WallRunMobility);
-                        UE_LOG(LogTemp, Error, TEXT("JUMP TO WALL RUN"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO WALL RUN"));
                         return;
                     }
                 }
@@ -5888,7 +8234,7 @@ void UAdvanceMovementComponent::JumpToWallRun()
         }
         else
         {
-            if (PlayerInputCache->InputJumpHeld() && (PlayerInputCache->InputSprintHeld() || PlayerInputCache->InputSprintPressed()))
+            if (MovementInput.InputJumpHeld() && (MovementInput.InputSprintHeld() || MovementInput.InputSprintPressed()))
             {
                 if (CharacterData->CharacterAbility.WallRunAbilityUnlocked())
                 {
@@ -5898,7 +8244,7 @@ void UAdvanceMovementComponent::JumpToWallRun()
                         {
                             ExitJump();
                             SetSpecialMobility(WallRunMobility);
-                            UE_LOG(LogTemp, Error, TEXT("JUMP TO WALL RUN"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO WALL RUN"));
                             return;
                         }           
                     }
@@ -5917,7 +8263,7 @@ void UAdvanceMovementComponent::JumpToVerticalWallRun()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpHeld() && PlayerInputCache->InputMoveForwardHeld())
+        if (MovementInput.InputJumpHeld() && MovementInput.InputMoveForwardHeld())
         {
             if (CharacterData->CharacterAbility.VerticalWallRunAbilityUnlocked())
             {
@@ -5929,7 +8275,7 @@ void UAdvanceMovementComponent::JumpToVerticalWallRun()
                         {
                             ExitJump();
                             SetSpecialMobility(VerticalWallRunMobility);
-                            UE_LOG(LogTemp, Error, TEXT("JUMP TO VERTICAL WALL RUN"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO VERTICAL WALL RUN"));
                             return;
                         }
                     }
@@ -5948,7 +8294,7 @@ void UAdvanceMovementComponent::JumpToHang()
 
     if (CharacterData->IsPlayer())
     {
-        if (PlayerInputCache->InputHangPressed() || PlayerInputCache->InputHangHeld())
+        if (MovementInput.InputHangPressed() || MovementInput.InputHangHeld())
         {
             if (CharacterData->CharacterAbility.HangAbilityUnlocked())
             {
@@ -5958,7 +8304,7 @@ void UAdvanceMovementComponent::JumpToHang()
                     {
                         ExitJump();
                         SetSpecialMobility(HangMobility);
-                        UE_LOG(LogTemp, Error, TEXT("JUMP TO HANG"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO HANG"));
                         return;
                     }
                 }
@@ -5976,7 +8322,7 @@ void UAdvanceMovementComponent::JumpToDash()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed())
+        if (MovementInput.InputDashPressed())
         {
             if (CharacterData->CharacterAbility.DashAbilityUnlocked())
             {
@@ -5984,7 +8330,7 @@ void UAdvanceMovementComponent::JumpToDash()
                 {
                     ExitJump();
                     SetSpecialMobility(SlideMobility);
-                    UE_LOG(LogTemp, Error, TEXT("JUMP TO DASH"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO DASH"));
                     return;
                 }
             }
@@ -6018,7 +8364,7 @@ void UAdvanceMovementComponent::JumpToGlide()
                     {
                         ExitJump();
                         SetAdvanceMobility(GlideMobility);
-                        UE_LOG(LogTemp, Error, TEXT("JUMP TO GLIDE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO GLIDE"));
                         return;
                     }
                 }
@@ -6026,7 +8372,7 @@ void UAdvanceMovementComponent::JumpToGlide()
         }
         else
         {
-            if (PlayerInputCache->InputGlideHeld())
+            if (MovementInput.InputGlideHeld())
             {
                 if (CharacterData->CharacterAbility.GlideAbilityUnlocked())
                 {
@@ -6039,7 +8385,7 @@ void UAdvanceMovementComponent::JumpToGlide()
                         {
                             ExitJump();
                             SetAdvanceMobility(GlideMobility);
-                            UE_LOG(LogTemp, Error, TEXT("JUMP TO GLIDE"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO GLIDE"));
                             return;
                         }
                     }
@@ -6058,7 +8404,7 @@ void UAdvanceMovementComponent::JumpToDive()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDivePressed())
+        if (MovementInput.InputDivePressed())
         {
             if (CharacterData->CharacterAbility.DiveAbilityUnlocked())
             {
@@ -6068,7 +8414,7 @@ void UAdvanceMovementComponent::JumpToDive()
                 {
                     ExitJump();
                     SetAdvanceMobility(DiveMobility);
-                    UE_LOG(LogTemp, Error, TEXT("JUMP TO DIVE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO DIVE"));
                     return;
                 }         
             }
@@ -6085,7 +8431,7 @@ void UAdvanceMovementComponent::JumpToFall()
 
     ExitJump();
     SetBasicMovement(FallMovement);
-    UE_LOG(LogTemp, Error, TEXT("JUMP TO FALL"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("JUMP TO FALL"));
     return;
 }
 
@@ -6112,7 +8458,7 @@ void UAdvanceMovementComponent::EnterSlide()
             }
         }
     }
-    UE_LOG(LogTemp, Error, TEXT("Enter Slide"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Slide"));
 }
 
 void UAdvanceMovementComponent::TickSlideMovement()
@@ -6146,22 +8492,24 @@ void UAdvanceMovementComponent::TickSlideMovement()
         UpdateSlideStamina();
         PerformSlideMovement();
 
+        EMovementTransitionContext Context = EMovementTransitionContext::None;
+
         if (CharacterData->CharacterAttribute.CharacterStat.GetStamina() <= 0)
         {
-            if (IsFalling() && GroundDistance() > 50.0f)
-            {
-                SlideToFall();
-            }
-            else
-            {
-                SlideToIdle();
-            }
+            Context |= EMovementTransitionContext::Exhausted;
+        }
+
+        if (IsFalling() && GroundDistance() > 50.0f)
+        {
+            Context |= EMovementTransitionContext::Drop;
         }
-        else if (Slide->IsSlideCompleted())
+
+        if (Slide->IsSlideCompleted())
         {
-            SlideToCrouch();
+            Context |= EMovementTransitionContext::Completed;
         }
 
+        EvaluateTransitions(EMovementType::Slide, Context);
 
         //if (Slide->IsSlideCompleted() || )
         //{
@@ -6333,21 +8681,21 @@ void UAdvanceMovementComponent::SlideToIdle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             return;
         }
 
-        if (PlayerInputCache->InputSlidePressed() || PlayerInputCache->InputSlideHeld())
+        if (MovementInput.InputSlidePressed() || MovementInput.InputSlideHeld())
         {
             return;
         }
 
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             ExitSlide();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("SLIDE TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO IDLE"));
             return;
         }
     }
@@ -6362,15 +8710,15 @@ void UAdvanceMovementComponent::SlideToWalk()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld())
+        if (MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld())
         {
             if (CharacterData->CharacterAttribute.CharacterStat.GetStamina() <= 0 || Slide->IsSlideCompleted())
             {
-                if (PlayerInputCache->AnyMovementInputActive())
+                if (MovementInput.AnyMovementInputActive())
                 {
                     ExitSlide();
                     SetBasicMovement(WalkMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SLIDE TO WALK"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO WALK"));
                     return;
                 }
             }
@@ -6387,15 +8735,15 @@ void UAdvanceMovementComponent::SlideToRun()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputWalkInActive() && SystemCore.PlayerMovementConfiguration.WalkDisabled())
+        if (MovementInput.InputWalkInActive() && SystemCore.PlayerMovementConfiguration.WalkDisabled())
         {
             if (CharacterData->CharacterAttribute.CharacterStat.GetStamina() <= 0 || Slide->IsSlideCompleted())
             {
-                if (PlayerInputCache->AnyMovementInputActive())
+                if (MovementInput.AnyMovementInputActive())
                 {
                     ExitSlide();
                     SetBasicMovement(RunMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SLIDE TO RUN"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO RUN"));
                     return;
                 }
             }
@@ -6412,7 +8760,7 @@ void UAdvanceMovementComponent::SlideToCrouch()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -6420,7 +8768,7 @@ void UAdvanceMovementComponent::SlideToCrouch()
                 {
                     ExitSlide();
                     SetBasicMovement(CrouchMovement);
-                    UE_LOG(LogTemp, Error, TEXT("SLIDE TO Crouch"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO Crouch"));
                     return;
                 }
             }
@@ -6437,7 +8785,7 @@ void UAdvanceMovementComponent::SlideToProne()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed() || PlayerInputCache->InputPronePressed())
+        if (MovementInput.InputPronePressed() || MovementInput.InputPronePressed())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -6447,7 +8795,7 @@ void UAdvanceMovementComponent::SlideToProne()
                     {
                         ExitSlide();
                         SetBasicMovement(ProneMovement);
-                        UE_LOG(LogTemp, Error, TEXT("SLIDE TO PRONE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO PRONE"));
                         return;
                     }
                 }
@@ -6467,7 +8815,7 @@ void UAdvanceMovementComponent::SlideToCrawl()
     {
         ExitSlide();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("SLIDE TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO CRAWL"));
         return;
     }
 }
@@ -6483,7 +8831,7 @@ void UAdvanceMovementComponent::SlideToFall()
     {
         ExitSlide();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("SLIDE TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO FALL"));
         return;
     }
 }
@@ -6492,7 +8840,7 @@ void UAdvanceMovementComponent::SlideToJump()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed() || PlayerInputCache->InputJumpHeld())
+        if (MovementInput.InputJumpPressed() || MovementInput.InputJumpHeld())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -6500,7 +8848,7 @@ void UAdvanceMovementComponent::SlideToJump()
                 {
                     ExitSlide();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("SLIDE TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO JUMP"));
                     return;
                 }
             }
@@ -6512,7 +8860,7 @@ void UAdvanceMovementComponent::SlideToRoll()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputRollPressed() || PlayerInputCache->InputRollHeld())
+        if (MovementInput.InputRollPressed() || MovementInput.InputRollHeld())
         {
             if (CharacterData->CharacterAbility.RollAbilityUnlocked())
             {
@@ -6520,7 +8868,7 @@ void UAdvanceMovementComponent::SlideToRoll()
                 {
                     ExitSlide();
                     SetSpecialMobility(RollMobility);
-                    UE_LOG(LogTemp, Error, TEXT("SLIDE TO ROLL"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO ROLL"));
                     return;
                 }
             }
@@ -6532,7 +8880,7 @@ void UAdvanceMovementComponent::SlideToDash()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed() || PlayerInputCache->InputDashHeld())
+        if (MovementInput.InputDashPressed() || MovementInput.InputDashHeld())
         {          
             if (CharacterData->CharacterAbility.DashAbilityUnlocked() && ValidDashRange(Dash->GetMaximumDistance()))
             {
@@ -6542,7 +8890,7 @@ void UAdvanceMovementComponent::SlideToDash()
                     {
                         ExitSlide();
                         SetSpecialMobility(DashMobility);
-                        UE_LOG(LogTemp, Error, TEXT("SLIDE TO DASH"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("SLIDE TO DASH"));
                         return;
                     }
                 } 
@@ -6590,7 +8938,7 @@ void UAdvanceMovementComponent::EnterRoll()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Roll"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Roll"));
 }
 
 void UAdvanceMovementComponent::TickRollMovement()
@@ -6684,13 +9032,13 @@ void UAdvanceMovementComponent::RollToIdle()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             if (Roll->IsRollCompleted())
             {
                 ExitRoll();
                 SetBasicMovement(IdleMovement);
-                UE_LOG(LogTemp, Error, TEXT("ROLL TO IDLE"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO IDLE"));
                 return;
             }
         }
@@ -6701,15 +9049,15 @@ void UAdvanceMovementComponent::RollToWalk()
 {
     if (IsPlayer())
     {
-        if ((PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()) || SystemCore.PlayerMovementConfiguration.WalkEnabled())
+        if ((MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()) || SystemCore.PlayerMovementConfiguration.WalkEnabled())
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 if (Roll->IsRollCompleted())
                 {
                     ExitRoll();
                     SetBasicMovement(WalkMovement);
-                    UE_LOG(LogTemp, Error, TEXT("ROLL TO WALK"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO WALK"));
                     return;
                 }
             }
@@ -6721,15 +9069,15 @@ void UAdvanceMovementComponent::RollToRun()
 {
     if (IsPlayer())
     {
-        if ((SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive()))
+        if ((SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive()))
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 if (Roll->IsRollCompleted())
                 {
                     ExitRoll();
                     SetBasicMovement(RunMovement);
-                    UE_LOG(LogTemp, Error, TEXT("ROLL TO RUN"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO RUN"));
                     return;
                 }
             }
@@ -6741,7 +9089,7 @@ void UAdvanceMovementComponent::RollToCrouch()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             if (CharacterData->CharacterAbility.CrouchAbilityUnlocked())
             {
@@ -6751,7 +9099,7 @@ void UAdvanceMovementComponent::RollToCrouch()
                     {
                         ExitRoll();
                         SetBasicMovement(CrouchMovement);
-                        UE_LOG(LogTemp, Error, TEXT("ROLL TO CROUCH"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO CROUCH"));
                         return;
                     }
                 }
@@ -6764,7 +9112,7 @@ void UAdvanceMovementComponent::RollToProne()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputPronePressed() || PlayerInputCache->InputProneHeld())
+        if (MovementInput.InputPronePressed() || MovementInput.InputProneHeld())
         {
             if (CharacterData->CharacterAbility.ProneAbilityUnlocked())
             {
@@ -6774,7 +9122,7 @@ void UAdvanceMovementComponent::RollToProne()
                     {
                         ExitRoll();
                         SetBasicMovement(ProneMovement);
-                        UE_LOG(LogTemp, Error, TEXT("ROLL TO PRONE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO PRONE"));
                         return;
                     }
                 }
@@ -6789,7 +9137,7 @@ void UAdvanceMovementComponent::RollToCrawl()
     {
         ExitRoll();
         SetBasicMovement(CrawlMovement);
-        UE_LOG(LogTemp, Error, TEXT("IDLE TO CRAWL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO CRAWL"));
         return;
     }
 }
@@ -6800,7 +9148,7 @@ void UAdvanceMovementComponent::RollToFall()
     {
         ExitIdle();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("IDLE TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("IDLE TO FALL"));
         return;
     }
 }
@@ -6809,7 +9157,7 @@ void UAdvanceMovementComponent::RollToJump()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed() || PlayerInputCache->InputJumpHeld())
+        if (MovementInput.InputJumpPressed() || MovementInput.InputJumpHeld())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -6819,7 +9167,7 @@ void UAdvanceMovementComponent::RollToJump()
                     {
                         ExitRoll();
                         SetSpecialMobility(JumpMobility);
-                        UE_LOG(LogTemp, Error, TEXT("ROLL TO JUMP"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO JUMP"));
                         return;
                     }  
                 }
@@ -6832,7 +9180,7 @@ void UAdvanceMovementComponent::RollToSlide()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputSlidePressed() || PlayerInputCache->InputSlideHeld())
+        if (MovementInput.InputSlidePressed() || MovementInput.InputSlideHeld())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -6842,7 +9190,7 @@ void UAdvanceMovementComponent::RollToSlide()
                     {
                         ExitRoll();
                         SetSpecialMobility(JumpMobility);
-                        UE_LOG(LogTemp, Error, TEXT("ROLL TO SLIDE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("ROLL TO SLIDE"));
                         return;
                     }
                 }
@@ -6855,7 +9203,7 @@ void UAdvanceMovementComponent::RollToDash()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputDashPressed() || PlayerInputCache->InputDashHeld())
+        if (MovementInput.InputDashPressed() || MovementInput.InputDashHeld())
         {
             if (CharacterData->CharacterAbility.DashAbilityUnlocked() && ValidDashRange(Dash->GetMaximumDistance()))
             {
@@ -6907,7 +9255,7 @@ void UAdvanceMovementComponent::EnterWallRun()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter WallRun"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter WallRun"));
 }
 
 void UAdvanceMovementComponent::TickWallRunMovement()
@@ -6929,22 +9277,23 @@ void UAdvanceMovementComponent::TickWallRunMovement()
 
         PerformWallRunMovement();
 
-        WallRunToJump();
-        WallRunToMantle();
-
-        if (WallRun->TickDisabled())
+        // Jump and mantle (priority 0-1) first. Either may disable the wall run tick without leaving the state,
+        // in which case the ground and fall exits must not run this tick.
+        if (EvaluateTransitions(EMovementType::WallRun, EMovementTransitionContext::None, 0, 1))
         {
             return;
         }
-        if (IsMovingOnGround())
+
+        if (WallRun->TickDisabled())
         {
-            WallRunToIdle();
-            WallRunToWalk();
-            WallRunToRun();
+            return;
         }
-        else
+
+        EvaluateTransitions(EMovementType::WallRun, EMovementTransitionContext::None, 2);
+
+        if (WallRun->TickDisabled())
         {
-            WallRunToFall();
+            return;
         }
 
         if (IsPlayer())
@@ -7025,11 +9374,11 @@ void UAdvanceMovementComponent::WallRunToIdle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             ExitWallRun();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("WALLRUN TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALLRUN TO IDLE"));
             return;
         }
     }
@@ -7044,13 +9393,13 @@ void UAdvanceMovementComponent::WallRunToWalk()
 
     if (IsPlayer())
     {
-        if ((PlayerInputCache->InputWalkPressed() || PlayerInputCache->InputWalkHeld()) || SystemCore.PlayerMovementConfiguration.WalkEnabled())
+        if ((MovementInput.InputWalkPressed() || MovementInput.InputWalkHeld()) || SystemCore.PlayerMovementConfiguration.WalkEnabled())
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitWallRun();
                 SetBasicMovement(WalkMovement);
-                UE_LOG(LogTemp, Error, TEXT("WALLRUN TO WALK"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALLRUN TO WALK"));
                 return;
             }
         }
@@ -7066,13 +9415,13 @@ void UAdvanceMovementComponent::WallRunToRun()
 
     if (IsPlayer())
     {
-        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && PlayerInputCache->InputWalkInActive())
+        if (SystemCore.PlayerMovementConfiguration.WalkDisabled() && MovementInput.InputWalkInActive())
         {
-            if (PlayerInputCache->AnyMovementInputActive())
+            if (MovementInput.AnyMovementInputActive())
             {
                 ExitWallRun();
                 SetBasicMovement(RunMovement);
-                UE_LOG(LogTemp, Error, TEXT("WALLRUN TO RUN"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALLRUN TO RUN"));
                 return;
             }
         }
@@ -7089,15 +9438,15 @@ void UAdvanceMovementComponent::WallRunToFall()
     if (IsPlayer())
     {
         bool FallInputRequest =
-        (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld()) ||
-        (PlayerInputCache->InputPronePressed() || PlayerInputCache->InputProneHeld()) ||
-        (PlayerInputCache->InputMoveBackwardPressed() || PlayerInputCache->InputMoveBackwardHeld());
+        (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld()) ||
+        (MovementInput.InputPronePressed() || MovementInput.InputProneHeld()) ||
+        (MovementInput.InputMoveBackwardPressed() || MovementInput.InputMoveBackwardHeld());
 
         if (FallInputRequest)
         {
             ExitWallRun();
             SetBasicMovement(FallMovement);
-            UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO FALL"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO FALL"));
             return;
         }
     }
@@ -7106,7 +9455,7 @@ void UAdvanceMovementComponent::WallRunToFall()
     {
         ExitWallRun();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO FALL(Stamina is depleted)"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO FALL(Stamina is depleted)"));
         return;
     }
 
@@ -7116,7 +9465,7 @@ void UAdvanceMovementComponent::WallRunToFall()
         {
             ExitWallRun();
             SetBasicMovement(FallMovement);
-            UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO FALL(Health is depleted)"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO FALL(Health is depleted)"));
             return;
         }
     }
@@ -7125,7 +9474,7 @@ void UAdvanceMovementComponent::WallRunToFall()
     {
         ExitWallRun();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("IsWallRunEdgeReached"));
+        UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("IsWallRunEdgeReached"));
         return;
     }
 
@@ -7133,7 +9482,7 @@ void UAdvanceMovementComponent::WallRunToFall()
     {
         ExitWallRun();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("IsWallRunCompleted"));
+        UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("IsWallRunCompleted"));
         return;
     }
 }
@@ -7149,16 +9498,16 @@ void UAdvanceMovementComponent::WallRunToJump()
     {
         if (SystemCore.PlayerMovementConfiguration.AutoWallRunEnable())
         {
-            if (PlayerInputCache->InputJumpPressed())
+            if (MovementInput.InputJumpPressed())
             {
-                UE_LOG(LogTemp, Error, TEXT("InputJumpPressed"));
+                UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("InputJumpPressed"));
                 if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
                 {
                     if (CharacterData->CharacterAttribute.CharacterStat.GetStamina() >= Jump->GetStaminaCost())
                     {
                         ExitWallRun();
                         SetSpecialMobility(JumpMobility);
-                        UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO JUMP"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO JUMP"));
                         return;
                     }
                 }
@@ -7166,7 +9515,7 @@ void UAdvanceMovementComponent::WallRunToJump()
         }
         else
         {
-            if (PlayerInputCache->InputJumpReleased())
+            if (MovementInput.InputJumpReleased())
             {
                 if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
                 {
@@ -7174,7 +9523,7 @@ void UAdvanceMovementComponent::WallRunToJump()
                     {
                         ExitWallRun();
                         SetSpecialMobility(JumpMobility);
-                        UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO JUMP"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO JUMP"));
                         return;
                     }
                 }
@@ -7231,7 +9580,7 @@ void UAdvanceMovementComponent::WallRunToMantle()
                     {
                         ExitWallRun();
                         SetAdvanceMobility(MantleMobility);
-                        UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO MANTLE"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO MANTLE"));
                         return;
                     }
                 }
@@ -7239,7 +9588,7 @@ void UAdvanceMovementComponent::WallRunToMantle()
         }
         else
         {
-            if (PlayerInputCache->InputSprintPressed() || PlayerInputCache->InputSprintHeld())
+            if (MovementInput.InputSprintPressed() || MovementInput.InputSprintHeld())
             {
                 if (CharacterData->CharacterAbility.MantleAbilityUnlocked())
                 {
@@ -7249,7 +9598,7 @@ void UAdvanceMovementComponent::WallRunToMantle()
                         {
                             ExitWallRun();
                             SetAdvanceMobility(MantleMobility);
-                            UE_LOG(LogTemp, Error, TEXT("WALL-RUN TO JUMP"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("WALL-RUN TO JUMP"));
                             return;
                         }
                     }
@@ -7344,7 +9693,7 @@ void UAdvanceMovementComponent::PerformWallRunMovement()
     float SpeedBoost = 10.0f;
 
     float AdjustedTargetSpeed;
-    if (PlayerInputCache->InputSprintHeld() && WallRun->GetDuration() >= 0.25f)
+    if (MovementInput.InputSprintHeld() && WallRun->GetDuration() >= 0.25f)
     {
         AdjustedTargetSpeed = FMath::Clamp((InitialSpeed + SpeedScalingFactor) + SpeedBoost, MinimumSpeed, MaximumSpeed);
     }
@@ -7640,7 +9989,7 @@ void UAdvanceMovementComponent::EnterVerticalWallRun()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Vertical WallRun"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Vertical WallRun"));
 }
 
 void UAdvanceMovementComponent::TickVerticalWallRunMovement()
@@ -7666,10 +10015,7 @@ void UAdvanceMovementComponent::TickVerticalWallRunMovement()
         UpdateVerticalWallRunStamina();
         PerformVerticalWallRunMovement();
 
-        VerticalWallRunToHang();
-        VerticalWallRunToMantle();
-        VerticalWallRunToFall();
-        VerticalWallRunToJump();
+        EvaluateTransitions(EMovementType::VerticalWallRun);
 
         if (IsPlayer())
         {
@@ -7728,7 +10074,7 @@ void UAdvanceMovementComponent::PerformVerticalWallRunMovement()
     float ClimbSpeed = VerticalWallRun->GetClimbSpeed();
     float ClimbBoost = 1; 
 
-    bool InputBoostRequest = PlayerInputCache->InputSprintPressed() || PlayerInputCache->InputSprintHeld();
+    bool InputBoostRequest = MovementInput.InputSprintPressed() || MovementInput.InputSprintHeld();
     if (InputBoostRequest)
     {
         ClimbBoost += VerticalWallRun->GetClimbBoost();
@@ -7746,7 +10092,7 @@ void UAdvanceMovementComponent::PerformVerticalWallRunMovement()
 
 void UAdvanceMovementComponent::VerticalWallRunReadyToAttemptTimerCompleted()
 {
-    UE_LOG(LogTemp, Error, TEXT("VerticalWallRunReadyToAttemptTimerCompleted"));
+    UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("VerticalWallRunReadyToAttemptTimerCompleted"));
     VerticalWallRun->SetCanVerticalWallRun(true);
 }
 
@@ -7825,7 +10171,7 @@ bool UAdvanceMovementComponent::VerticalWallRunDetection()
 void UAdvanceMovementComponent::UpdateVerticalWallRunStamina()
 {
     float StaminaMultiplier = 1.0f;
-    if (PlayerInputCache->InputSprintPressed() || PlayerInputCache->InputSprintHeld())
+    if (MovementInput.InputSprintPressed() || MovementInput.InputSprintHeld())
     {
         StaminaMultiplier = 1.5f;
     }
@@ -7882,7 +10228,7 @@ void UAdvanceMovementComponent::VerticalWallRunToIdle()
     {
         ExitVerticalWallRun();
         SetBasicMovement(IdleMovement);
-        UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO IDLE"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO IDLE"));
         return;
     }
 }
@@ -7896,7 +10242,7 @@ void UAdvanceMovementComponent::VerticalWallRunToJump()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpReleased() || PlayerInputCache->InputJumpInActive())
+        if (MovementInput.InputJumpReleased() || MovementInput.InputJumpInActive())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -7904,7 +10250,7 @@ void UAdvanceMovementComponent::VerticalWallRunToJump()
                 {
                     ExitVerticalWallRun();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO JUMP"));
                     return;
                 }
             }
@@ -7948,7 +10294,7 @@ void UAdvanceMovementComponent::VerticalWallRunToFall()
     {
         ExitVerticalWallRun();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Warning, TEXT("NO WALL DETECTED — VERTICAL WALL-RUN TO FALL"));
+        UE_LOG(LogAdvanceMovement, Warning, TEXT("NO WALL DETECTED — VERTICAL WALL-RUN TO FALL"));
         return;
     }
 
@@ -7957,30 +10303,30 @@ void UAdvanceMovementComponent::VerticalWallRunToFall()
     {
         ExitVerticalWallRun();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO FALL"));
         return;
     }
 
     if (IsPlayer())
     {
         bool FallInputRequest =
-            PlayerInputCache->InputCrouchPressed() ||
-            PlayerInputCache->InputCrouchHeld() ||
-            PlayerInputCache->InputSlidePressed() ||
-            PlayerInputCache->InputSlideHeld() ||
-            PlayerInputCache->InputMoveBackwardPressed() ||
-            PlayerInputCache->InputMoveBackwardHeld() ||
-
-            (PlayerInputCache->InputMoveForwardReleased() || PlayerInputCache->InputMoveForwardInActive())
+            MovementInput.InputCrouchPressed() ||
+            MovementInput.InputCrouchHeld() ||
+            MovementInput.InputSlidePressed() ||
+            MovementInput.InputSlideHeld() ||
+            MovementInput.InputMoveBackwardPressed() ||
+            MovementInput.InputMoveBackwardHeld() ||
+
+            (MovementInput.InputMoveForwardReleased() || MovementInput.InputMoveForwardInActive())
             &&
-            (PlayerInputCache->InputJumpReleased() || PlayerInputCache->InputJumpInActive());
+            (MovementInput.InputJumpReleased() || MovementInput.InputJumpInActive());
             
 
         if (FallInputRequest)
         {
             ExitVerticalWallRun();
             SetSpecialMobility(JumpMobility);
-            UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO JUMP"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO JUMP"));
             return;
         }
     }
@@ -8005,7 +10351,7 @@ void UAdvanceMovementComponent::VerticalWallRunToHang()
                     {
                         ExitVerticalWallRun();
                         SetSpecialMobility(HangMobility);
-                        UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO HANG"));
+                        UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO HANG"));
                         return;
                     }                   
                 }
@@ -8013,7 +10359,7 @@ void UAdvanceMovementComponent::VerticalWallRunToHang()
         }
         else
         {
-            if (PlayerInputCache->InputHangPressed() || PlayerInputCache->InputHangHeld())
+            if (MovementInput.InputHangPressed() || MovementInput.InputHangHeld())
             {
                 if (DetectHang())
                 {
@@ -8023,7 +10369,7 @@ void UAdvanceMovementComponent::VerticalWallRunToHang()
                         {
                             ExitVerticalWallRun();
                             SetSpecialMobility(HangMobility);
-                            UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO HANG"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO HANG"));
                             return;
                         }
                     }
@@ -8042,7 +10388,7 @@ void UAdvanceMovementComponent::VerticalWallRunToMantle()
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputHangPressed() || PlayerInputCache->InputHangHeld())
+        if (MovementInput.InputHangPressed() || MovementInput.InputHangHeld())
         {
             return;
         }
@@ -8054,7 +10400,7 @@ void UAdvanceMovementComponent::VerticalWallRunToMantle()
 
         if (SystemCore.PlayerMovementConfiguration.AutoMantlingEnabled())
         {
-            if (PlayerInputCache->InputSprintHeld() || PlayerInputCache->InputJumpHeld())
+            if (MovementInput.InputSprintHeld() || MovementInput.InputJumpHeld())
             {
                 if (MantleDetection())
                 {
@@ -8064,7 +10410,7 @@ void UAdvanceMovementComponent::VerticalWallRunToMantle()
                         {
                             ExitVerticalWallRun();
                             SetAdvanceMobility(MantleMobility);
-                            UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO MANTLE"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO MANTLE"));
                             return;
                         }
                     }
@@ -8073,7 +10419,7 @@ void UAdvanceMovementComponent::VerticalWallRunToMantle()
         }
         else
         {
-            if (PlayerInputCache->InputSprintHeld() || PlayerInputCache->InputJumpHeld())
+            if (MovementInput.InputSprintHeld() || MovementInput.InputJumpHeld())
             {
                 if (MantleDetection())
                 {
@@ -8083,7 +10429,7 @@ void UAdvanceMovementComponent::VerticalWallRunToMantle()
                         {
                             ExitVerticalWallRun();
                             SetAdvanceMobility(MantleMobility);
-                            UE_LOG(LogTemp, Error, TEXT("VERTICAL WALL-RUN TO MANTLE"));
+                            UE_LOG(LogAdvanceMovement, Verbose, TEXT("VERTICAL WALL-RUN TO MANTLE"));
                             return;
                         }
                     }
@@ -8122,7 +10468,7 @@ void UAdvanceMovementComponent::EnterHang()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Hang"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Hang"));
 }
 
 void UAdvanceMovementComponent::TickHangMovement()
@@ -8153,10 +10499,7 @@ void UAdvanceMovementComponent::TickHangMovement()
         PerformHangMovement();
 
         /* Transitions */
-        HangToJump();
-        HangToMantle();
-        HangToFall();
-
+        EvaluateTransitions(EMovementType::Hang);
 
         AdjustCapsuleHangLocation();
     }
@@ -8217,8 +10560,8 @@ void UAdvanceMovementComponent::PerformHangMovement()
 
     if (IsPlayer())
     {
-        bool PlayerInputRequestLeft = PlayerInputCache->InputMoveLeftPressed() || PlayerInputCache->InputMoveLeftHeld();
-        bool PlayerInputRequestRight = PlayerInputCache->InputMoveRightPressed() || PlayerInputCache->InputMoveRightHeld();
+        bool PlayerInputRequestLeft = MovementInput.InputMoveLeftPressed() || MovementInput.InputMoveLeftHeld();
+        bool PlayerInputRequestRight = MovementInput.InputMoveRightPressed() || MovementInput.InputMoveRightHeld();
 
         if (PlayerInputRequestLeft)
         {
@@ -8283,11 +10626,11 @@ void UAdvanceMovementComponent::PerformHangMovement()
   //  // --- Step 3: Handle movement input only left/right along the wall ---
   //  FVector MovementOffset = FVector::ZeroVector;
 
-  //  if (PlayerInputCache->InputMoveLeftPressed() || PlayerInputCache->InputMoveLeftHeld())
+  //  if (MovementInput.InputMoveLeftPressed() || MovementInput.InputMoveLeftHeld())
   //  {
   //      MovementOffset = -WallRightVector * HorizontalSpeed * DeltaTime;
   //  }
-  //  else if (PlayerInputCache->InputMoveRightPressed() || PlayerInputCache->InputMoveRightHeld())
+  //  else if (MovementInput.InputMoveRightPressed() || MovementInput.InputMoveRightHeld())
   //  {
   //      MovementOffset = WallRightVector * HorizontalSpeed * DeltaTime;
   //  }
@@ -8359,7 +10702,7 @@ void UAdvanceMovementComponent::HangToJump()
 {
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputJumpPressed())
+        if (MovementInput.InputJumpPressed())
         {
             if (CharacterData->CharacterAbility.JumpAbilityUnlocked())
             {
@@ -8367,7 +10710,7 @@ void UAdvanceMovementComponent::HangToJump()
                 {
                     ExitHang();
                     SetSpecialMobility(JumpMobility);
-                    UE_LOG(LogTemp, Error, TEXT("HANG TO JUMP"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO JUMP"));
                     return;
                 }
             }
@@ -8375,7 +10718,7 @@ void UAdvanceMovementComponent::HangToJump()
             {
                 ExitHang();
                 SetBasicMovement(FallMovement);
-                UE_LOG(LogTemp, Error, TEXT("HANG TO FALL"));
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO FALL"));
                 return;
             }
         }
@@ -8386,7 +10729,7 @@ void UAdvanceMovementComponent::HangToMantle()
 {
 	if (IsPlayer())
 	{
-		if (PlayerInputCache->InputHangReleased() || PlayerInputCache->InputJumpReleased())
+		if (MovementInput.InputHangReleased() || MovementInput.InputJumpReleased())
 		{
             if (CharacterData->CharacterAbility.MantleAbilityUnlocked())
             {
@@ -8394,7 +10737,7 @@ void UAdvanceMovementComponent::HangToMantle()
                 {
                     ExitHang();
                     SetAdvanceMobility(MantleMobility);
-                    UE_LOG(LogTemp, Error, TEXT("HANG TO MANTLE"));
+                    UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO MANTLE"));
                     return;
                 }
             }
@@ -8408,7 +10751,7 @@ void UAdvanceMovementComponent::HangToFall()
     {
         ExitHang();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("HANG TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO FALL"));
         return;
     }
 
@@ -8416,33 +10759,33 @@ void UAdvanceMovementComponent::HangToFall()
     {
         ExitHang();
         SetBasicMovement(FallMovement);
-        UE_LOG(LogTemp, Error, TEXT("HANG TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO FALL"));
         return;
     }
 
     if (IsPlayer())
     {
-        if (PlayerInputCache->InputCrouchPressed() || PlayerInputCache->InputCrouchHeld())
+        if (MovementInput.InputCrouchPressed() || MovementInput.InputCrouchHeld())
         {
             ExitHang();
             SetBasicMovement(FallMovement);
-            UE_LOG(LogTemp, Error, TEXT("HANG TO FALL"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO FALL"));
             return;
         }
 
-        if (PlayerInputCache->InputPronePressed() || PlayerInputCache->InputProneHeld())
+        if (MovementInput.InputPronePressed() || MovementInput.InputProneHeld())
         {
             ExitHang();
             SetBasicMovement(FallMovement);
-            UE_LOG(LogTemp, Error, TEXT("HANG TO FALL"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO FALL"));
             return;
         }
 
-		if (PlayerInputCache->InputMoveBackwardPressed() || PlayerInputCache->InputMoveBackwardHeld())
+		if (MovementInput.InputMoveBackwardPressed() || MovementInput.InputMoveBackwardHeld())
 		{
 			ExitHang();
 			SetBasicMovement(FallMovement);
-			UE_LOG(LogTemp, Error, TEXT("HANG TO FALL"));
+			UE_LOG(LogAdvanceMovement, Verbose, TEXT("HANG TO FALL"));
 			return;
 		}
     }
@@ -8471,7 +10814,7 @@ void UAdvanceMovementComponent::EnterDash()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Dash"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Dash"));
 }
 
 void UAdvanceMovementComponent::TickDashMovement()
@@ -8678,7 +11021,7 @@ void UAdvanceMovementComponent::EnterTeleport()
         Teleport->SetReachedTargetLocation(false);
 	}
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Teleport"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Teleport"));
 }
 
 void UAdvanceMovementComponent::TickTeleportMovement()
@@ -8706,19 +11049,20 @@ void UAdvanceMovementComponent::TickTeleportMovement()
         UpdateTeleportEnergy();
 		UpdateTeleportDuration();
 		PerformTeleportMovement();
-        TeleportToCrawl();
 
-		if (Teleport->IsReachedTargetLocation())
-		{
-			if (GroundDistance() >= 10.0f)
-            {
-                TeleportToFall();
-			}
-            else
+        EMovementTransitionContext Context = EMovementTransitionContext::None;
+
+        if (Teleport->IsReachedTargetLocation())
+        {
+            Context |= EMovementTransitionContext::Completed;
+
+            if (GroundDistance() >= 10.0f)
             {
-                TeleportToIdle();
+                Context |= EMovementTransitionContext::Drop;
             }
-		}
+        }
+
+        EvaluateTransitions(EMovementType::Teleport, Context);
 
         if (IsPlayer())
         {
@@ -8753,6 +11097,11 @@ void UAdvanceMovementComponent::ExitTeleport()
 #pragma region Utility
 
 bool UAdvanceMovementComponent::TeleportDetection()
+{
+    return RunBudgetedDetection(&UAdvanceMovementComponent::PerformTeleportDetection);
+}
+
+bool UAdvanceMovementComponent::PerformTeleportDetection()
 {
     bool bDebug = false;
 
@@ -8767,8 +11116,10 @@ bool UAdvanceMovementComponent::TeleportDetection()
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(CharacterOwner);
 	FHitResult HitResult;
-	bool bHit = GetWorld()->SweepSingleByChannel
+	bool bHit = EnvironmentProbes.Sweep
 	(
+		GetWorld(),
+		MakeMovementProbeKey(EMovementProbe::TeleportSweep),
 		HitResult,
 		TraceStart,
 		TraceEnd,
@@ -8899,11 +11250,11 @@ void UAdvanceMovementComponent::TeleportToIdle()
 
 	if (IsPlayer())
 	{
-        if (PlayerInputCache->MovementInputsInActive())
+        if (MovementInput.MovementInputsInActive())
         {
             ExitTeleport();
             SetBasicMovement(IdleMovement);
-            UE_LOG(LogTemp, Error, TEXT("TELEPORT TO IDLE"));
+            UE_LOG(LogAdvanceMovement, Verbose, TEXT("TELEPORT TO IDLE"));
             return;
         }
 	}
@@ -8920,7 +11271,7 @@ void UAdvanceMovementComponent::TeleportToFall()
 	{
 		ExitTeleport();
 		SetBasicMovement(FallMovement);
-		UE_LOG(LogTemp, Error, TEXT("TELEPORT TO FALL"));
+		UE_LOG(LogAdvanceMovement, Verbose, TEXT("TELEPORT TO FALL"));
 		return;
 	}
 }
@@ -8936,7 +11287,7 @@ void UAdvanceMovementComponent::TeleportToCrawl()
     {
 		ExitTeleport();
 		SetBasicMovement(CrawlMovement);
-		UE_LOG(LogTemp, Error, TEXT("TELEPORT TO FALL"));
+		UE_LOG(LogAdvanceMovement, Verbose, TEXT("TELEPORT TO FALL"));
 		return;
     }
 }
@@ -8965,7 +11316,7 @@ void UAdvanceMovementComponent::SetAdvanceMobility(EAdvanceMovementState NewAdva
     {
 #if DEV_DEBUG_MODE
         // Log a warning for attempting to set the same AdvanceMobilityState state.
-        UE_LOG(LogTemp, Error, TEXT("Attempted to set the same AdvanceMobilityState state."));
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Attempted to set the same AdvanceMobilityState state."));
 #endif
         return;
     }
@@ -8990,7 +11341,7 @@ void UAdvanceMovementComponent::SwitchAdvanceMobilityState(EAdvanceMovementState
     {
     case EAdvanceMovementState::Null:
 #if DEV_DEBUG_MODE
-        UE_LOG(LogTemp, Warning, TEXT("AdvanceMobilityState state set to Null. No advanced mobility actions will be executed. Ensure this is intentional."));
+        UE_LOG(LogAdvanceMovement, Warning, TEXT("AdvanceMobilityState state set to Null. No advanced mobility actions will be executed. Ensure this is intentional."));
 #endif
         break;
     case EAdvanceMovementState::Vault:
@@ -9044,7 +11395,7 @@ void UAdvanceMovementComponent::EnterVault()
         Vault->SetStartLocation(CharacterOwner->GetActorLocation());
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Vault"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Vault"));
 }
 
 void UAdvanceMovementComponent::TickVaultMovement()
@@ -9153,115 +11504,425 @@ void UAdvanceMovementComponent::UpdateVaultTravelDistance()
 
 #pragma region Utility 
 
-bool UAdvanceMovementComponent::VaultCheck()
-{
-    if (VaultHeightDetection())
+bool UAdvanceMovementComponent::VaultCheck()
+{
+    if (!IsDetectionAllowed())
+    {
+        return false;
+    }
+
+    return RunBudgetedDetection(&UAdvanceMovementComponent::PerformVaultCheck);
+}
+
+bool UAdvanceMovementComponent::PerformVaultCheck()
+{
+    if (VaultHeightDetection())
+    {
+        if (VaultWitdhDetection())
+        {
+            if (VaultCapsuleSizeHeightValidation())
+            {
+                UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("ValidVault Check"));
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool UAdvanceMovementComponent::VaultHeightDetection()
+{
+    float CapsuleHeight = CharacterCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+    FVector CapsuleLocation = CharacterCapsuleComponent()->GetComponentLocation();
+    FVector CapsuleUpward = CharacterCapsuleComponent()->GetUpVector();
+
+    FVector CapsuleFloor = CapsuleLocation - (CapsuleUpward * CapsuleHeight);
+    FVector CapsuleCeil = CapsuleFloor + (CapsuleUpward * ((CapsuleHeight * 2.0f) + 40.0f));
+
+    if (GAdvanceMovementLedgeShared && !GAdvanceMovementVaultLegacyScan)
+    {
+        const FLedgeInfo& Ledge = DetectLedge();
+
+        if (!Ledge.IsValid() || Ledge.WallDistance > Vault->GetHeightForwardTraceDistance())
+        {
+            return false;
+        }
+
+        return ApplyVaultHeight(Ledge.EdgePoint, CapsuleFloor);
+    }
+
+    FVaultLedgeProbe Probe = GAdvanceMovementVaultLegacyScan
+        ? ScanVaultLedge(CapsuleFloor.Z, CapsuleCeil.Z)
+        : RefineVaultLedge(CapsuleFloor.Z, CapsuleCeil.Z);
+
+    INC_DWORD_STAT_BY(STAT_AdvanceMovement_VaultHeightTraces, Probe.TraceCount);
+
+#if !UE_BUILD_SHIPPING
+    if (GAdvanceMovementVaultValidate && !GAdvanceMovementVaultLegacyScan)
+    {
+        const FVaultLedgeProbe Reference = ScanVaultLedge(CapsuleFloor.Z, CapsuleCeil.Z);
+
+        const float Height          = FMath::Abs(Probe.LastHitLocation.Z - CapsuleFloor.Z);
+        const float ReferenceHeight = FMath::Abs(Reference.LastHitLocation.Z - CapsuleFloor.Z);
+
+        if (Probe.bFound != Reference.bFound
+            || (Probe.bFound && ClassifyVaultHeight(Height) != ClassifyVaultHeight(ReferenceHeight))
+            || (Probe.bFound && FMath::Abs(Height - ReferenceHeight) > GAdvanceMovementVaultCoarseStep))
+        {
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("VaultHeightDetection: refined %s %.1f (%d traces), scan %s %.1f (%d traces)"),
+                Probe.bFound ? TEXT("hit") : TEXT("miss"), Height, Probe.TraceCount,
+                Reference.bFound ? TEXT("hit") : TEXT("miss"), ReferenceHeight, Reference.TraceCount);
+        }
+    }
+#endif
+
+    if (!Probe.bFound)
+    {
+        return false;
+    }
+
+    return ApplyVaultHeight(Probe.LastHitLocation, CapsuleFloor);
+}
+
+bool UAdvanceMovementComponent::ApplyVaultHeight(FVector LastHitLocation, const FVector& CapsuleFloor)
+{
+    FVector UpdatedCapsuleFloor = CapsuleFloor;
+    UpdatedCapsuleFloor.X = LastHitLocation.X;
+
+    float Height = FMath::Abs(LastHitLocation.Z - UpdatedCapsuleFloor.Z);
+
+    Vault->SetHeightDistance(Height);
+    LastHitLocation.Z += 3.0f;
+    Vault->SetHeightLastImpactPoint(LastHitLocation);
+
+    float MaximumHeight = Vault->GetMaximumHeight();
+    if (Height <= MaximumHeight)
+    {
+        Vault->SetVaultHeightType(ClassifyVaultHeight(Height));
+        return true;
+    }
+
+    return false;
+}
+
+EVaultHeightType UAdvanceMovementComponent::ClassifyVaultHeight(float Height)
+{
+    if (Height > 200.0f)
+    {
+        return EVaultHeightType::Climbable;
+    }
+    else if (Height > 160.0f)
+    {
+        return EVaultHeightType::High;
+    }
+    else if (Height > 100.0f)
+    {
+        return EVaultHeightType::Medium;
+    }
+    else if (Height > 50.0f)
+    {
+        return EVaultHeightType::Low;
+    }
+    else if (Height > 0.0f)
+    {
+        return EVaultHeightType::StepUp;
+    }
+
+    return EVaultHeightType::None;
+}
+
+UAdvanceMovementComponent::FVaultLedgeProbe UAdvanceMovementComponent::MakeVaultLedgeProbe()
+{
+    FVaultLedgeProbe Probe;
+
+    Probe.Origin = CharacterCapsuleComponent()->GetComponentLocation();
+    Probe.Reach  = CharacterCapsuleComponent()->GetForwardVector() * Vault->GetHeightForwardTraceDistance();
+
+    Probe.QueryParams.AddIgnoredActor(CharacterOwner);
+    Probe.QueryParams.AddIgnoredComponent(CharacterCapsuleComponent());
+
+    return Probe;
+}
+
+bool UAdvanceMovementComponent::TraceVaultLedgeAt(float Z, FVaultLedgeProbe& Probe)
+{
+    FVector Start = FVector(Probe.Origin.X, Probe.Origin.Y, Z);
+    FVector End = Start + Probe.Reach;
+
+    FHitResult ForwardHit;
+
+    ++Probe.TraceCount;
+
+    bool bHit = EnvironmentProbes.LineTrace
+    (
+        GetWorld(),
+        MakeMovementProbeKey(EMovementProbe::VaultLedge, Probe.TraceCount),
+        ForwardHit,
+        Start,
+        End,
+        ECC_Visibility,
+        Probe.QueryParams
+    );
+
+    if (bHit)
+    {
+        Probe.LastHitLocation = ForwardHit.ImpactPoint;
+    }
+
+    return bHit;
+}
+
+UAdvanceMovementComponent::FVaultLedgeProbe UAdvanceMovementComponent::ScanVaultLedge(float FloorZ, float CeilZ)
+{
+    FVaultLedgeProbe Probe = MakeVaultLedgeProbe();
+
+    bool LastHit = false;
+
+    for (float Z = FloorZ; Z < CeilZ; Z += 1.0f)
+    {
+        if (TraceVaultLedgeAt(Z, Probe))
+        {
+            LastHit = true;
+        }
+        else if (LastHit)
+        {
+            Probe.bFound = true;
+            break;
+        }
+    }
+
+    return Probe;
+}
+
+UAdvanceMovementComponent::FVaultLedgeProbe UAdvanceMovementComponent::RefineVaultLedge(float FloorZ, float CeilZ)
+{
+    FVaultLedgeProbe Probe = MakeVaultLedgeProbe();
+
+    const float CoarseStep = FMath::Max(GAdvanceMovementVaultCoarseStep, 1.0f);
+
+    // Coarse pass: walk up in CoarseStep increments until a hit is followed by a miss.
+    // CeilZ is always the last sample, so an edge in the partial step below it is not skipped.
+    bool LastHit = false;
+    float HitZ = FloorZ;
+    float MissZ = CeilZ;
+
+    for (float Z = FloorZ; ; Z = FMath::Min(Z + CoarseStep, CeilZ))
+    {
+        if (TraceVaultLedgeAt(Z, Probe))
+        {
+            LastHit = true;
+            HitZ = Z;
+        }
+        else if (LastHit)
+        {
+            MissZ = Z;
+            Probe.bFound = true;
+            break;
+        }
+
+        if (Z >= CeilZ)
+        {
+            break;
+        }
+    }
+
+    if (!Probe.bFound)
+    {
+        return Probe;
+    }
+
+    // Fine pass: bisect between the highest hit and the lowest miss down to the 1 unit resolution of the scan.
+    FVector HighestHit = Probe.LastHitLocation;
+
+    while (MissZ - HitZ > 1.0f)
     {
-        if (VaultWitdhDetection())
+        const float MidZ = FMath::FloorToFloat((HitZ + MissZ) * 0.5f);
+        if (MidZ <= HitZ)
         {
-            if (VaultCapsuleSizeHeightValidation())
-            {
-                UE_LOG(LogTemp, Error, TEXT("ValidVault Check"));
-                return true;
-            }
+            break;
+        }
+
+        if (TraceVaultLedgeAt(MidZ, Probe))
+        {
+            HitZ = MidZ;
+            HighestHit = Probe.LastHitLocation;
+        }
+        else
+        {
+            MissZ = MidZ;
         }
     }
-    return false;
+
+    Probe.LastHitLocation = HighestHit;
+    return Probe;
 }
 
-bool UAdvanceMovementComponent::VaultHeightDetection()
+bool UAdvanceMovementComponent::VaultWitdhDetection()
 {
-    float CapsuleHeight = CharacterCapsuleComponent()->GetScaledCapsuleHalfHeight();
+    if (GAdvanceMovementVaultLegacyScan)
+    {
+        return ScanVaultWidth();
+    }
+
+    if (GAdvanceMovementLedgeShared)
+    {
+        const FLedgeInfo& Ledge = DetectLedge();
+
+        // No ledge or a top deeper than the probe: nothing to measure, as with the scan.
+        if (!Ledge.IsValid() || !Ledge.bHasFarEdge)
+        {
+            return true;
+        }
+
+        return ApplyVaultWidth(Ledge.FarEdgePoint);
+    }
 
-    FVector CapsuleLocation = CharacterCapsuleComponent()->GetComponentLocation();
-    FVector CapsuleForward = CharacterCapsuleComponent()->GetForwardVector();
     FVector CapsuleUpward = CharacterCapsuleComponent()->GetUpVector();
+    FVector CapsuleForward = CharacterCapsuleComponent()->GetForwardVector();
 
-    FVector CapsuleFloor = CapsuleLocation - (CapsuleUpward * CapsuleHeight);
-    FVector CapsuleCeil = CapsuleFloor + (CapsuleUpward * ((CapsuleHeight * 2.0f) + 40.0f));
-    FVector ForwardTarget = CapsuleCeil + (CapsuleForward * Vault->GetHeightForwardTraceDistance());
+    FVector StartLocation = Vault->GetHeightLastImpactPoint();
 
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(CharacterOwner);
     QueryParams.AddIgnoredComponent(CharacterCapsuleComponent());
 
-    bool LastHit = false;
-    FVector LastHitLocation = FVector::ZeroVector;
+    int32 TraceCount = 0;
 
-    for (float FloorZ = CapsuleFloor.Z; FloorZ < CapsuleCeil.Z; FloorZ += 1.0f)
+    // Short downward trace at the given distance past the ledge; hits while still on top of the obstacle.
+    auto TraceTopAt = [&](float Step, FHitResult& OutHit) -> bool
     {
-        float ForwardTraceDistance = Vault->GetHeightForwardTraceDistance();
+        FVector CurrentStartLocation = StartLocation + (CapsuleForward * Step);
+        FVector DownwardEndLocation = CurrentStartLocation - (CapsuleUpward * 10.0f);
 
-        FVector Start = FVector(CapsuleLocation.X, CapsuleLocation.Y, FloorZ);
-        FVector End = Start + (CapsuleForward * ForwardTraceDistance);
-        FHitResult ForwardHit;
+        ++TraceCount;
+        return EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::VaultWidth, TraceCount), OutHit, CurrentStartLocation, DownwardEndLocation, ECC_Visibility, QueryParams);
+    };
 
-        bool bHit = GetWorld()->LineTraceSingleByChannel
-        (
-            ForwardHit,
-            Start,
-            End,
-            ECC_Visibility,
-            QueryParams
-        );
+    float FarEdgeStep = 0.0f;
+    FVector FarEdgeLocation = StartLocation;
 
-        if (bHit)
+    // Nothing under the ledge point, or the top runs past the far side: there is no far edge to measure.
+    if (!FindTopFarEdge(TraceTopAt, 200.0f, FarEdgeStep, FarEdgeLocation))
+    {
+        INC_DWORD_STAT_BY(STAT_AdvanceMovement_VaultWidthTraces, TraceCount);
+        return true;
+    }
+
+    INC_DWORD_STAT_BY(STAT_AdvanceMovement_VaultWidthTraces, TraceCount);
+
+    return ApplyVaultWidth(FarEdgeLocation);
+}
+
+bool UAdvanceMovementComponent::FindTopFarEdge(TFunctionRef<bool(float, FHitResult&)> TraceTopAt, float MaximumDepth, float& OutDepth, FVector& OutFarEdgePoint)
+{
+    const float CoarseStep = FMath::Max(GAdvanceMovementVaultCoarseStep, 1.0f);
+
+    FHitResult Hit;
+    if (!TraceTopAt(0.0f, Hit))
+    {
+        return false;
+    }
+
+    // Coarse pass: walk away from the edge until the first miss, so a gap in the top is found before anything past it.
+    // MaximumDepth is always the last sample.
+    float NearDepth = 0.0f;
+    float FarDepth  = -1.0f;
+    FVector FarEdgePoint = Hit.ImpactPoint;
+
+    for (float Depth = FMath::Min(CoarseStep, MaximumDepth); ; Depth = FMath::Min(Depth + CoarseStep, MaximumDepth))
+    {
+        if (!TraceTopAt(Depth, Hit))
         {
-            LastHitLocation = ForwardHit.ImpactPoint;
-            LastHit = true;
+            FarDepth = Depth;
+            break;
+        }
+
+        NearDepth    = Depth;
+        FarEdgePoint = Hit.ImpactPoint;
+
+        if (Depth >= MaximumDepth)
+        {
+            break;
+        }
+    }
+
+    // The top runs past MaximumDepth.
+    if (FarDepth < 0.0f)
+    {
+        return false;
+    }
+
+    // Fine pass: bisect the step holding the first miss down to 1 unit. A gap narrower than the coarse step may still
+    // be bisected past, but only to a hit inside that one step.
+    while (FarDepth - NearDepth > 1.0f)
+    {
+        const float MidDepth = FMath::FloorToFloat((NearDepth + FarDepth) * 0.5f);
+        if (MidDepth <= NearDepth)
+        {
+            break;
+        }
+
+        if (TraceTopAt(MidDepth, Hit))
+        {
+            NearDepth    = MidDepth;
+            FarEdgePoint = Hit.ImpactPoint;
         }
         else
         {
-            if (LastHit)
-            {
-                FVector UpdatedCapsuleFloor = CapsuleFloor;
-                UpdatedCapsuleFloor.X = LastHitLocation.X;
+            FarDepth = MidDepth;
+        }
+    }
 
-                float Distance = FVector::Dist(LastHitLocation, UpdatedCapsuleFloor);
-                float Height = FMath::Abs(LastHitLocation.Z - UpdatedCapsuleFloor.Z);
+    OutDepth        = NearDepth;
+    OutFarEdgePoint = FarEdgePoint;
+    return true;
+}
 
-                Vault->SetHeightDistance(Height);
-                LastHitLocation.Z += 3.0f;
-                Vault->SetHeightLastImpactPoint(LastHitLocation);
+bool UAdvanceMovementComponent::ApplyVaultWidth(const FVector& FarEdgeLocation)
+{
+    Vault->SetWidthLastImpactPoint(FarEdgeLocation);
 
+    float Distance = FVector::Dist(Vault->GetHeightLastImpactPoint(), Vault->GetWidthLastImpactPoint());
+    Vault->SetWidthDistance(FMath::Abs(Distance));
 
-                float MaximumHeight = Vault->GetMaximumHeight();
-                if (Height <= MaximumHeight)
-                {
-                    if (Height > 200.0f)
-                    {
-                        Vault->SetVaultHeightType(EVaultHeightType::Climbable);
-                    }
-                    else if (Height > 160.0f)
-                    {
-                        Vault->SetVaultHeightType(EVaultHeightType::High);
-                    }
-                    else if (Height > 100.0f)
-                    {
-                        Vault->SetVaultHeightType(EVaultHeightType::Medium);
-                    }
-                    else if (Height > 50.0f)
-                    {
-                        Vault->SetVaultHeightType(EVaultHeightType::Low);
-                    }
-                    else if (Height > 0.0f)
-                    {
-                        Vault->SetVaultHeightType(EVaultHeightType::StepUp);
-                    }
-                    else
-                    {
-                        Vault->SetVaultHeightType(EVaultHeightType::None);
-                    }
-                    return true;
-                }
-                break;
-            }
-        }
+    float MinimumDistance = Vault->GetMinimumDistance();
+    float MaximumDistance = Vault->GetMaximumDistance();
+
+    if (Distance <= MinimumDistance)
+    {
+        return false;
     }
-    return false;
+
+    if (Distance >= MaximumDistance)
+    {
+        Vault->SetVaultWidthType(EVaultWidthType::Unreachable);
+    }
+    else if (Distance > 180.0f)
+    {
+        Vault->SetVaultWidthType(EVaultWidthType::Extended);
+    }
+    else if (Distance > 120.0f)
+    {
+        Vault->SetVaultWidthType(EVaultWidthType::Long);
+    }
+    else if (Distance > 50.0f)
+    {
+        Vault->SetVaultWidthType(EVaultWidthType::Medium);
+    }
+    else if (Distance > 0.0f)
+    {
+        Vault->SetVaultWidthType(EVaultWidthType::Short);
+    }
+    else
+    {
+        Vault->SetVaultWidthType(EVaultWidthType::Unreachable);
+    }
+
+    return true;
 }
 
-bool UAdvanceMovementComponent::VaultWitdhDetection()
+bool UAdvanceMovementComponent::ScanVaultWidth()
 {
     FVector CapsuleUpward = CharacterCapsuleComponent()->GetUpVector();
     FVector CapsuleForward = CharacterCapsuleComponent()->GetForwardVector();
@@ -9282,6 +11943,8 @@ bool UAdvanceMovementComponent::VaultWitdhDetection()
         FVector CurrentStartLocation = StartLocation + (CapsuleForward * Step);
         FVector DownwardEndLocation = CurrentStartLocation - (CapsuleUpward * 10.0f);
 
+        INC_DWORD_STAT(STAT_AdvanceMovement_VaultWidthTraces);
+
         bool bDistanceHit =
             GetWorld()->LineTraceSingleByChannel
             (
@@ -9415,6 +12078,8 @@ bool UAdvanceMovementComponent::VaultCapsuleSizeHeightValidation()
     bool MidHit = false;    //  Crouch
     bool HighHit = false;    //  Full
 
+    int32 ClearanceIndex = 0;
+
     for (const FCapsuleInformation& CapsuleInformation : CapsuleInformations)
     {
         FVector StartLocation = AdjustedHeightImpactPoint;
@@ -9434,7 +12099,7 @@ bool UAdvanceMovementComponent::VaultCapsuleSizeHeightValidation()
             );
         }
 
-        bool bHit = GetWorld()->LineTraceSingleByChannel(HeightHit, StartLocation, EndLocation, ECC_Visibility, CollisionParams);
+        bool bHit = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::VaultClearance, ClearanceIndex++), HeightHit, StartLocation, EndLocation, ECC_Visibility, CollisionParams);
 
         if (bHit)
         {
@@ -9453,17 +12118,17 @@ bool UAdvanceMovementComponent::VaultCapsuleSizeHeightValidation()
 
             if (CapsuleInformation.Name == "Prone")
             {
-                UE_LOG(LogTemp, Error, TEXT("LowHit"));
+                UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("LowHit"));
                 LowHit = true;
             }
             else if (CapsuleInformation.Name == "Crouch")
             {
-                UE_LOG(LogTemp, Error, TEXT("MidHit"));
+                UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("MidHit"));
                 MidHit = true;
             }
             else if (CapsuleInformation.Name == "Full")
             {
-                UE_LOG(LogTemp, Error, TEXT("FullHit"));
+                UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("FullHit"));
                 HighHit = true;
             }
             break;
@@ -9500,7 +12165,7 @@ void UAdvanceMovementComponent::EnterMantle()
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Mantle"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Mantle"));
 }
 
 void UAdvanceMovementComponent::TickMantleMovement()
@@ -9624,12 +12289,12 @@ void UAdvanceMovementComponent::PerformMantleMovement()
         float DurationPhase1 = 0;
 		float DurationPhase2 = 0;
 
-        UE_LOG(LogTemp, Error, TEXT("PerformWallHeightTrace: %f"), PerformWallHeightTrace);
+        UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("PerformWallHeightTrace: %f"), PerformWallHeightTrace);
 
         if (PerformWallHeightTrace < MaxHeight / 4)
         {
-            UE_LOG(LogTemp, Error, TEXT("1"));
-            UE_LOG(LogTemp, Error, TEXT("GroundDistance: %f"), GroundDistance());
+            UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("1"));
+            UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("GroundDistance: %f"), GroundDistance());
             VelocityZ = 400.0f;
             DurationPhase1 = 0.15f;
             DurationPhase2 = 0.30f;
@@ -9643,21 +12308,21 @@ void UAdvanceMovementComponent::PerformMantleMovement()
         }
         else if (PerformWallHeightTrace < MaxHeight / 3)
         {
-            UE_LOG(LogTemp, Error, TEXT("2"));
+            UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("2"));
 			VelocityZ = 500.f;
 			DurationPhase1 = 0.20f;
 			DurationPhase2 = 0.35f;
         }
 		else if (PerformWallHeightTrace < MaxHeight / 2)
 		{
-            UE_LOG(LogTemp, Error, TEXT("3"));
+            UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("3"));
 			VelocityZ = 800.f;
 			DurationPhase1 = 0.25f;
 			DurationPhase2 = 0.35f;
 		}
 		else if (PerformWallHeightTrace <= MaxHeight )
 		{
-            UE_LOG(LogTemp, Error, TEXT("4"));
+            UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("4"));
 			VelocityZ = 1000.f;
 			DurationPhase1 = 0.30f;
 			DurationPhase2 = 0.45f;
@@ -9683,7 +12348,7 @@ void UAdvanceMovementComponent::PerformMantleMovement()
     {
         ExitMantle();
         SetBasicMovement(EBasicMovementState::Fall);
-        UE_LOG(LogTemp, Error, TEXT("MANTLE TO FALL"));
+        UE_LOG(LogAdvanceMovement, Verbose, TEXT("MANTLE TO FALL"));
         return;
     }
 }
@@ -9735,6 +12400,16 @@ void UAdvanceMovementComponent::UpdateMantleTravelDistance()
 #pragma region Utility
 
 bool UAdvanceMovementComponent::MantleDetection()
+{
+    if (!IsDetectionAllowed())
+    {
+        return false;
+    }
+
+    return RunBudgetedDetection(&UAdvanceMovementComponent::PerformMantleDetection);
+}
+
+bool UAdvanceMovementComponent::PerformMantleDetection()
 {
 
 
@@ -9768,8 +12443,10 @@ bool UAdvanceMovementComponent::MantleDetection()
         FVector ForwardCapsuleStart = StartLocation;
         FVector ForwardCapsuleEnd   = ForwardCapsuleStart + (ForwardVector * TraceDistance);
 
-        bool bCapsuleForwardHit = World->SweepSingleByChannel
+        bool bCapsuleForwardHit = EnvironmentProbes.Sweep
         (
+            World,
+            MakeMovementProbeKey(EMovementProbe::MantleVerticalSweep),
             ForwardHit,
             ForwardCapsuleStart,
             ForwardCapsuleEnd,
@@ -9784,8 +12461,10 @@ bool UAdvanceMovementComponent::MantleDetection()
         const FVector CapsuleCenter = StartLocation;
         const FVector CenterLineEnd = CapsuleCenter + (ForwardVector * TraceDistance);
 
-        bool bCenterHit = World->LineTraceSingleByChannel
+        bool bCenterHit = EnvironmentProbes.LineTrace
         (
+            World,
+            MakeMovementProbeKey(EMovementProbe::MantleVerticalCenter),
             CenterLineHit,
             CapsuleCenter,
             CenterLineEnd,
@@ -9798,8 +12477,10 @@ bool UAdvanceMovementComponent::MantleDetection()
         const FVector HeadLocation  = StartLocation + FVector(0.0f, 0.0f, CapsuleHalfHeight);
         const FVector HeadLineEnd   = HeadLocation + (ForwardVector * TraceDistance);
 
-        bool bHeadHit = World->LineTraceSingleByChannel
+        bool bHeadHit = EnvironmentProbes.LineTrace
         (
+            World,
+            MakeMovementProbeKey(EMovementProbe::MantleVerticalHead),
             HeadLineHit,
             HeadLocation,
             HeadLineEnd,
@@ -9820,7 +12501,7 @@ bool UAdvanceMovementComponent::MantleDetection()
         {
             if (bDebug)
             {
-                UE_LOG(LogTemp, Error, TEXT("VerticalWallRun -> Mantle Detection Done!"));
+                UE_LOG(LogAdvanceMovement, VeryVerbose, TEXT("VerticalWallRun -> Mantle Detection Done!"));
             }
 
             // Reset TraceHit for next.
@@ -9845,8 +12526,10 @@ bool UAdvanceMovementComponent::MantleDetection()
 
         FHitResult JumpForwardHitResult;
 
-        bool bJumpCapsuleForwardHit = World->LineTraceSingleByChannel
+        bool bJumpCapsuleForwardHit = EnvironmentProbes.LineTrace
         (
+            World,
+            MakeMovementProbeKey(EMovementProbe::MantleJumpForward),
             JumpForwardHitResult,
             JumpForwardStart,
             JumpForwardEnd,
@@ -9872,8 +12555,10 @@ bool UAdvanceMovementComponent::MantleDetection()
             FVector JumpHeadForwardEnd      = JumpHeadForwardStart + (ForwardVector * TraceDistance * 1.5f);
 
             FHitResult JumpHeadHitResult;
-            bool bJumpHeadHit = World->LineTraceSingleByChannel
+            bool bJumpHeadHit = EnvironmentProbes.LineTrace
             (
+                World,
+                MakeMovementProbeKey(EMovementProbe::MantleJumpHead),
                 JumpHeadHitResult,
                 JumpHeadForwardStart,
                 JumpHeadForwardEnd,
@@ -9896,8 +12581,10 @@ bool UAdvanceMovementComponent::MantleDetection()
 
 
         FHitResult WallRunMantleHitResult;
-        bool bWallRunMantleHit = GetWorld()->SweepSingleByChannel
+        bool bWallRunMantleHit = EnvironmentProbes.Sweep
         (
+            GetWorld(),
+            MakeMovementProbeKey(EMovementProbe::MantleWallRunSweep),
             WallRunMantleHitResult,
             WallRunCapsuleStart,
             WallRunCapsuleEnd,
@@ -9913,8 +12600,10 @@ bool UAdvanceMovementComponent::MantleDetection()
             FVector WallRunTopEnd = WallRunTopStart + (ForwardVector * TraceDistance);
 
             FHitResult WallRunLineTraceHitResult;
-            bool bWallRunLineTraceHit = GetWorld()->LineTraceSingleByChannel
+            bool bWallRunLineTraceHit = EnvironmentProbes.LineTrace
             (
+                GetWorld(),
+                MakeMovementProbeKey(EMovementProbe::MantleWallRunTop),
                 WallRunLineTraceHitResult,
                 WallRunTopStart,
                 WallRunTopEnd,
@@ -9931,125 +12620,24 @@ bool UAdvanceMovementComponent::MantleDetection()
         }
     }
 
-    CapsuleHalfHeight   = CharacterCapsuleComponent()->GetScaledCapsuleHalfHeight() * 0.9f;
-    CapsuleRadius       = CharacterCapsuleComponent()->GetScaledCapsuleRadius() * 0.5f;
-
-    float ForwardDistance     = 15.0f;
-    float MaxMantleHeight     = Mantle->GetMaximumHeight();
-
-    ForwardStart            = CapsuleLocation + (ForwardVector * CapsuleRadius);
-    ForwardEnd              = ForwardStart + (ForwardVector * ForwardDistance);
-
-    FHitResult WallHit;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(CharacterOwner);
+    // Any other state: a wall just in front whose top is the mantle ledge, no higher than the mantle may climb.
+    const FLedgeInfo& Ledge = DetectLedge();
 
-    if (bDebug)
+    if (!Ledge.IsValid() || Ledge.WallDistance > CapsuleRadius + 15.0f || Ledge.Height > Mantle->GetMaximumHeight())
     {
-        DrawDebugCapsule
-        (
-            GetWorld(),
-            ForwardEnd,
-            CapsuleHalfHeight,
-            CapsuleRadius,
-            FQuat::Identity,
-            FColor::Cyan,
-            false, 1.0f
-        );
-
-        DrawDebugLine
-        (
-            GetWorld(),
-            ForwardStart, 
-            ForwardEnd,
-            FColor::Red,
-            false, 
-            1.0f,
-            0,
-            1.5f
-        );
+        return false;
     }
 
-    // Step 1: Forward check for wall
-    if (GetWorld()->SweepSingleByChannel(WallHit, ForwardStart, ForwardEnd, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight), QueryParams))
-    {
-        FVector WallImpact = WallHit.ImpactPoint;
-        FVector WallNormal = WallHit.ImpactNormal;
-
-        if (bDebug)
-        {
-            DrawDebugPoint(GetWorld(), WallImpact, 12.0f, FColor::Red, false, 2.0f);
-            DrawDebugDirectionalArrow(GetWorld(), WallImpact, WallImpact + WallNormal * 50.0f, 10.0f, FColor::Red, false, 2.0f);
-        }
-
-        // Step 2: Find floor at base of wall
-        FVector FloorStart = WallImpact - ForwardVector * 10.0f + UpVector * 10.0f;
-        FVector FloorEnd = FloorStart - UpVector * 300.0f;
-
-        FHitResult FloorHit;
-        if (!GetWorld()->LineTraceSingleByChannel(FloorHit, FloorStart, FloorEnd, ECC_Visibility, QueryParams))
-        {
-            if (bDebug)
-            {
-                DrawDebugLine(GetWorld(), FloorStart, FloorEnd, FColor::Yellow, false, 2.0f);
-            }
-            return false;
-        }
-
-        float FloorZ = FloorHit.ImpactPoint.Z;
-
-        if (bDebug)
-        {
-            DrawDebugPoint(GetWorld(), FloorHit.ImpactPoint, 12.0f, FColor::Green, false, 2.0f);
-            DrawDebugLine(GetWorld(), FloorStart, FloorEnd, FColor::Green, false, 2.0f);
-        }
-
-        // Step 3: From slightly above floor, trace upward to find ledge
-        FVector VerticalTraceStart = FloorHit.ImpactPoint + ForwardVector * 10.0f + FVector(0.0f, 0.0f, 5.0f);
-        FVector VerticalTraceEnd = VerticalTraceStart + FVector(0.0f, 0.0f, MaxMantleHeight);
-
-        FHitResult VerticalHit;
-        float LedgeTopZ = VerticalTraceEnd.Z;
-
-        // Loop upward in small steps until trace no longer hits
-        const float StepSize = 2.0f;
-        FVector StepTraceStart = VerticalTraceStart;
-
-        while (StepTraceStart.Z < VerticalTraceEnd.Z)
-        {
-            FVector StepTraceEnd = StepTraceStart + ForwardVector * 10.0f;
-            FHitResult StepHit;
-            bool bHit = GetWorld()->LineTraceSingleByChannel(StepHit, StepTraceStart, StepTraceEnd, ECC_Visibility, QueryParams);
-
-            if (bDebug)
-            {
-                DrawDebugLine(GetWorld(), StepTraceStart, StepTraceEnd, bHit ? FColor::Blue : FColor::White, false, 1.0f);
-            }
-
-            if (!bHit)
-            {
-                LedgeTopZ = StepTraceStart.Z;
-                break;
-            }
-
-            StepTraceStart.Z += StepSize;
-        }
-
-        float TotalVerticalHeight = LedgeTopZ - FloorZ;
-
-        Mantle->SetWallHeight(TotalVerticalHeight);
+    Mantle->SetWallHeight(Ledge.Height);
 
-        if (bDebug)
-        {
-            FVector LedgeTopPoint = FVector(VerticalTraceStart.X, VerticalTraceStart.Y, LedgeTopZ);
-            DrawDebugLine(GetWorld(), VerticalTraceStart, LedgeTopPoint, FColor::Purple, false, 2.0f);
-            DrawDebugPoint(GetWorld(), LedgeTopPoint, 10.0f, FColor::Magenta, false, 2.0f);
-        }
-
-        return true;
+    if (bDebug)
+    {
+        DrawDebugPoint(GetWorld(), Ledge.WallPoint, 12.0f, FColor::Red, false, 2.0f);
+        DrawDebugDirectionalArrow(GetWorld(), Ledge.WallPoint, Ledge.WallPoint + Ledge.WallNormal * 50.0f, 10.0f, FColor::Red, false, 2.0f);
+        DrawDebugPoint(GetWorld(), Ledge.EdgePoint, 10.0f, FColor::Magenta, false, 2.0f);
     }
 
-    return false;
+    return true;
 }
 
 #pragma endregion
@@ -10074,7 +12662,7 @@ void UAdvanceMovementComponent::EnterGlide()
 
     Velocity = FVector::ZeroVector;
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Glide"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Glide"));
 }
 
 void UAdvanceMovementComponent::TickGlideMovement()
@@ -10198,7 +12786,7 @@ void UAdvanceMovementComponent::EnterSwim()
     Swim->EnablePhysicsUpdate(true);
     Swim->bSwimming = true;
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Swim"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Swim"));
 
 }
 
@@ -10220,7 +12808,7 @@ void UAdvanceMovementComponent::ExitSwim()
 
 void UAdvanceMovementComponent::EnterDive()
 {
-    UE_LOG(LogTemp, Error, TEXT("Enter Dive"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Dive"));
 
 }
 
@@ -10244,7 +12832,7 @@ void UAdvanceMovementComponent::EnterHover()
     Hover->EnablePhysicsUpdate(true);
     Hover->bHovering = true;
 
-    UE_LOG(LogTemp, Error, TEXT("Enter Hover"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Hover"));
 }
 
 void UAdvanceMovementComponent::TickHoverMovement()
@@ -10294,7 +12882,7 @@ void UAdvanceMovementComponent::EnterGrappling()
     }
 
     Velocity = FVector::ZeroVector;
-    UE_LOG(LogTemp, Error, TEXT("Enter Grappling"));
+    UE_LOG(LogAdvanceMovement, Verbose, TEXT("Enter Grappling"));
 }
 
 void UAdvanceMovementComponent::TickGrapplingMovement()
@@ -10337,6 +12925,97 @@ void UAdvanceMovementComponent::ExitGrappling()
 
 }
 
+bool UAdvanceMovementComponent::DetectGrappling()
+{
+    if (!CharacterOwner)
+    {
+        return false;
+    }
+
+    const FVector ViewLocation  = CharacterOwner->GetPawnViewLocation();
+    const FVector ViewDirection = CharacterOwner->GetControlRotation().Vector();
+
+    if (!FindTargetAnchor(EMovementAnchorType::Grapple, ViewLocation, ViewDirection, GAdvanceMovementGrappleRange, GAdvanceMovementGrappleConeAngle))
+    {
+        return false;
+    }
+
+    // The hash only knows positions; the line to the anchor must still be clear.
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(GetOwner());
+    QueryParams.bIgnoreTouches = true;
+
+    // Anchors are registered by a UMovementAnchorComponent or directly by an actor.
+    const UObject* AnchorOwner = TargetAnchor.Owner.Get();
+    const UActorComponent* AnchorComponent = Cast<UActorComponent>(AnchorOwner);
+
+    if (const AActor* AnchorActor = AnchorComponent ? AnchorComponent->GetOwner() : Cast<AActor>(AnchorOwner))
+    {
+        QueryParams.AddIgnoredActor(AnchorActor);
+    }
+
+    FHitResult SightHit;
+    const bool bBlocked = EnvironmentProbes.LineTrace(GetWorld(), MakeMovementProbeKey(EMovementProbe::GrappleSight), SightHit,
+        ViewLocation, TargetAnchor.Location, ECC_Visibility, QueryParams);
+
+    return !bBlocked;
+}
+
+#pragma endregion
+
+#pragma region Zipline
+
+bool UAdvanceMovementComponent::DetectZipline()
+{
+    if (!OwnerCapsuleComponent)
+    {
+        return false;
+    }
+
+    const FVector Forward = OwnerCapsuleComponent->GetForwardVector();
+
+    return FindTargetAnchor(EMovementAnchorType::Zipline, OwnerCapsuleComponent->GetComponentLocation(), Forward,
+        GAdvanceMovementZiplineRange, GAdvanceMovementZiplineConeAngle);
+}
+
+#pragma endregion
+
+#pragma region Anchor
+
+bool UAdvanceMovementComponent::FindTargetAnchor(EMovementAnchorType Type, const FVector& Origin, const FVector& Direction, float Range, float ConeHalfAngle)
+{
+    const UWorld* World = GetWorld();
+    const UAdvanceMovementSubsystem* Subsystem = World ? World->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr;
+    if (!Subsystem)
+    {
+        return false;
+    }
+
+    FMovementAnchorQuery Query;
+    Query.Origin      = Origin;
+    Query.Direction   = Direction.GetSafeNormal();
+    Query.Range       = Range;
+    Query.MinCosAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(ConeHalfAngle, 0.0f, 180.0f)));
+    Query.Types       = Type;
+
+    const FMovementAnchor* Anchor = Subsystem->FindNearestAnchor(Query);
+    if (!Anchor)
+    {
+        return false;
+    }
+
+    TargetAnchor = *Anchor;
+
+    #if DEV_DEBUG_MODE
+    if (bActivateDebug)
+    {
+        DrawDebugLine(GetWorld(), Origin, TargetAnchor.Location, FColor::Cyan, false, 1.0f);
+    }
+    #endif
+
+    return true;
+}
+
 #pragma endregion
 
 #pragma endregion
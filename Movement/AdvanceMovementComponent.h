@@ -3,12 +3,19 @@
 #include "Character/Data/CharacterData.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Network/NetworkManager.h"
+#include "Character/Component/Movement/MovementRingBuffer.h"
+#include "Character/Component/Movement/MovementProbe.h"
+#include "Character/Component/Movement/MovementAnchor.h"
+#include "Character/Component/Movement/AdvanceMovementNetwork.h"
+#include "Character/Component/Movement/MovementValidator.h"
+#include "Character/Component/Movement/MovementReplay.h"
 #include "AdvanceMovementComponent.generated.h"
 
 #pragma region ForwardDecleration
 
 class ACharacterModule;
 class UPlayerInputCache;
+class UTraversalAnnotationData;
 
 struct FSystemCore;
 
@@ -32,6 +39,9 @@ protected:
 	// Called when the game starts or when spawned
     virtual void BeginPlay() override;
 
+	// Called when the game ends or when destroyed
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Called every frame
     virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     
@@ -59,8 +69,127 @@ public:
 
 #pragma endregion
 
+#pragma region NetworkPrediction
+
+private:
+    // Persistent storage the engine serializes client moves and server responses through
+    FAdvanceNetworkMoveDataContainer NetworkMoveDataContainer;
+    FAdvanceMoveResponseDataContainer MoveResponseDataContainer;
+
+    // True while the server runs a client move whose movement type changed on the client
+    bool bClientMovementSwitched = false;
+
+    // Server-side plausibility check of this client's moves
+    FMovementValidator MovementValidator;
+
+    // Gathers the speed, target distance and cost limits of a movement type for MovementValidator.
+    FMovementValidationLimits GetValidationLimits(EMovementType Type) const;
+
+    // Server: checks a movement switch the client requested. Returns false when it must be rejected.
+    bool ValidateClientPayload(const FAdvanceMovementPayload& Payload);
+
+    // Server: responds to the anomaly score; corrects every move above the threshold and kicks above the kick threshold.
+    void EscalateAnomalies();
+
+    // Server: a kick is scheduled for the next tick; moves keep being corrected until it happens
+    bool bKickPending = false;
+
+    // Server: makes the next move response a correction, carrying the server's position and movement type.
+    void ForceClientCorrection();
+
+    /**
+     * Server: treats the movement type a client move ended in as a request. A switch the server has not made itself
+     * is attempted through the server's own transition guard for that edge; if the server still ends up elsewhere the
+     * request is refused and the client corrected to the server's type. Returns true when both agree.
+     */
+    bool ResolveClientSwitch(const FAdvanceMovementPayload& Requested);
+
+    // Server corrections received by this client since ClientCorrectionWindowStart
+    uint32 ClientCorrectionCount = 0;
+    double ClientCorrectionWindowStart = 0.0;
+
+public:
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+    // Captures the movement type of the current movement state and the direction or target it uses.
+    FAdvanceMovementPayload MakeMovementPayload() const;
+
+    // Switches the movement state to the payload's movement type if it differs from the current one.
+    void ApplyMovementPayload(const FAdvanceMovementPayload& Payload, EMovementSwitchReason Reason);
+
+    // Puts the movement state, type and phase back to a recorded payload without entering, exiting or recording anything.
+    void RestoreMovementPayload(const FAdvanceMovementPayload& Payload, EMovementPhase Phase);
+
+    // Movement type of the current movement state, or the movement data's type for types without a state.
+    EMovementType GetActiveMovementType() const;
+
+    // Phase of the active movement type's module.
+    EMovementPhase GetCurrentMovementPhase() const;
+
+    FORCEINLINE const FMovementValidator& GetMovementValidator() const
+    {
+        return MovementValidator;
+    }
+
+    FORCEINLINE bool IsClientMovementSwitched() const
+    {
+        return bClientMovementSwitched;
+    }
+
+    FORCEINLINE uint32 GetClientCorrectionCount() const
+    {
+        return ClientCorrectionCount;
+    }
+
+    // Corrections per minute since the counter was last reset.
+    float GetClientCorrectionRate() const;
+
+    void ResetClientCorrections();
+
+protected:
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+    virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+    virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
+
+#pragma endregion
+
+#pragma region ReplicatedMovementState
+
+private:
+    // Compact movement state for simulated proxies; the server refreshes it after every movement update
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedMovementState)
+    FReplicatedMovementState ReplicatedMovementState;
+
+    // World time replication of ReplicatedMovementState started, for AdvanceMovement.NetStateReport
+    double ReplicatedStateStartTime = 0.0;
+
+    // Copies the current type, phase and payload into ReplicatedMovementState. Server only.
+    void UpdateReplicatedMovementState();
+
+    // Server world time as synchronized through the game state; entry times of the replicated state are in this clock.
+    double GetServerWorldTimeSeconds() const;
+
+    UFUNCTION()
+    void OnRep_ReplicatedMovementState();
+
+public:
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    FORCEINLINE const FReplicatedMovementState& GetReplicatedMovementState() const
+    {
+        return ReplicatedMovementState;
+    }
+
+    FORCEINLINE double GetReplicatedStateStartTime() const
+    {
+        return ReplicatedStateStartTime;
+    }
+
+#pragma endregion
+
 #pragma region Utility
 private:
+    // Seconds covered by the current movement update. Larger than a frame when the update rate is reduced by TickLOD.
     float DeltaSeconds();
 
 #pragma endregion
@@ -228,17 +357,260 @@ public:
 
 
 private:
-    void SwitchMovement(EMovementType PreviousType, EMovementType CurrentType);
- 
+    void SwitchMovement(EMovementType PreviousType, EMovementType CurrentType, EMovementSwitchReason Reason = EMovementSwitchReason::Unspecified);
 
 #pragma endregion
 
-#pragma region Activate
+#pragma region History
+
+public:
+    // One movement switch captured by the switch history, from a state change or a network or forced SwitchMovement.
+    struct FMovementSwitchRecord
+    {
+        uint64                  Frame       = 0;
+        FVector3f               Location    = FVector3f::ZeroVector;
+        EMovementType           From        = EMovementType::Null;
+        EMovementType           To          = EMovementType::Null;
+        EMovementSwitchReason   Reason      = EMovementSwitchReason::Unspecified;
+    };
+
+    // Number of switches kept per character. Older entries are overwritten.
+    static constexpr uint32 MovementHistoryCapacity = 64;
+
+    // Logs the switch history of this character, oldest first.
+    void DumpMovementHistory() const;
+
+private:
+    // Most recent movement switches of this character. Always on; recording is one atomic increment and a 32-byte copy.
+    TMovementRingBuffer<FMovementSwitchRecord, MovementHistoryCapacity> MovementHistory;
+
+    // Appends a switch to MovementHistory.
+    void RecordMovementSwitch(EMovementType From, EMovementType To, EMovementSwitchReason Reason);
+
+#if !UE_BUILD_SHIPPING
+public:
+    // Records the given number of switches through RecordMovementSwitch and returns the seconds it took.
+    // The switches also land in the process-wide crash records, replacing the real ones.
+    double BenchmarkRecordMovementSwitch(int32 Iterations);
+#endif
+
+#pragma endregion
+
+#pragma region Batch
+
+private:
+    friend class UAdvanceMovementSubsystem;
+
+    // True while UAdvanceMovementSubsystem runs this component's movement logic instead of TickComponent
+    bool bMovementBatched = false;
+
+    // Time this component's own tick accumulated (dilated, zero while paused) since the batch last ran its movement logic
+    float BatchedDeltaTime = 0.0f;
+
+    // Returns BatchedDeltaTime and starts accumulating again.
+    FORCEINLINE float ConsumeBatchedDeltaTime()
+    {
+        const float DeltaTime = BatchedDeltaTime;
+        BatchedDeltaTime = 0.0f;
+        return DeltaTime;
+    }
+
+    // Runs one frame of movement logic: LOD, update-rate gating, the state machine tick and the current type's update handler.
+    void UpdateMovementLogic(float DeltaTime);
+
+public:
+    FORCEINLINE bool IsMovementBatched() const
+    {
+        return bMovementBatched;
+    }
+
+#pragma endregion
+
+#pragma region EnvironmentProbe
+
+private:
+    // Detection traces (hang, mantle, vault, teleport, walls, ground), issued async one frame ahead and shared within a frame
+    FMovementProbes EnvironmentProbes;
+
+public:
+    FORCEINLINE const FMovementProbes& GetEnvironmentProbes() const
+    {
+        return EnvironmentProbes;
+    }
+
+#pragma endregion
+
+#pragma region Replay
+
+private:
+    // Recording or playback attached to this component; null when neither runs
+    TUniquePtr<FMovementReplay> Replay;
+
+    // Subsystem registration to restore once playback ends; playback ticks the movement logic itself so it can be timed per state
+    bool bReplayWasRegistered = false;
+
+    // Records the frame or, during playback, applies the recorded frame and replaces DeltaTime with the recorded one.
+    void BeginReplayFrame(float& DeltaTime);
+
+    // Books the tick cost against the movement type the frame started in and ends playback after the last frame.
+    void EndReplayFrame(EMovementType FrameType, uint64 Cycles);
+
+public:
+    // Feeds the recorded input to the engine movement while a replay plays, and records the live one while recording.
+    virtual FVector ConsumeInputVector() override;
+
+    // Starts capturing inputs, delta times and probe answers.
+    void StartReplayRecording();
+
+    // Stops recording and writes the replay. Returns false if nothing was recorded or the file could not be written.
+    bool SaveReplayRecording(const FString& Filename);
+
+    // Loads a replay and drives this component from it, starting on the next tick.
+    bool StartReplayPlayback(const FString& Filename);
+
+    // Ends recording or playback; playback logs its report.
+    void StopReplay();
+
+    FORCEINLINE const FMovementReplay* GetReplay() const
+    {
+        return Replay.Get();
+    }
+
+#pragma endregion
+
+#pragma region TickLOD
 
 private:
-    TMap<EMovementType, TFunction<void()>> ActivateMovementHandlers;
+    // Update-rate LOD of the movement logic, re-evaluated every AdvanceMovement.LOD.RefreshInterval seconds
+    EMovementTickLOD TickLOD = EMovementTickLOD::Full;
+
+    // Time accumulated since the movement logic last ran
+    float AccumulatedMovementDelta = 0.0f;
+
+    // Time covered by the movement update in progress; returned by DeltaSeconds() and cleared once the update has run
+    float MovementDeltaSeconds = 0.0f;
+
+    // Time left until TickLOD is re-evaluated; starts at a per-component offset within the refresh interval
+    float TickLODRefreshCountdown = 0.0f;
+
+    // Number of offsets the LOD refreshes are spread over
+    static constexpr uint32 TickLODRefreshSlots = 16;
+
+    // Counts down to the next LOD evaluation and refreshes TickLOD when it expires.
+    void UpdateTickLOD(float DeltaTime);
+
+    // Picks the LOD from player control, distance to the nearest player view and recent rendering.
+    EMovementTickLOD EvaluateTickLOD() const;
+
+    // Accumulates DeltaTime and returns true when the current movement type's interval for TickLOD has elapsed.
+    bool ConsumeMovementUpdate(float DeltaTime);
+
+public:
+    FORCEINLINE EMovementTickLOD GetTickLOD() const
+    {
+        return TickLOD;
+    }
+
+    // Detection traces (hang, vault, mantle) only run for characters at full LOD.
+    FORCEINLINE bool IsDetectionAllowed() const
+    {
+        return TickLOD == EMovementTickLOD::Full;
+    }
+
+#pragma endregion
+
+#pragma region DetectionBudget
+
+private:
+    // Detection requests denied in a row; raises the priority of the next request so nobody starves
+    int32 ConsecutiveDeferrals = 0;
+
+    // Picks the budget priority from player control, being airborne, TickLOD (distance to the nearest view) and deferrals.
+    EMovementDetectionPriority EvaluateDetectionPriority() const;
+
+    /**
+     * Runs the detector when the world's detection budget grants a slot.
+     * A deferred request answers false: the outputs the detector fills (ledge, vault and mantle data) belong to the
+     * frame they were computed on, so an earlier result would send the caller into a transition on stale geometry.
+     */
+    bool RunBudgetedDetection(bool (UAdvanceMovementComponent::*Detect)());
+
+#pragma endregion
+
+#pragma region Dispatch
+
+protected:
+    // Pointer to one of the per-type Activate/Update/Deactivate handlers of this class.
+    using FMovementHandler = void (UAdvanceMovementComponent::*)();
+
+    /**
+     * Fixed-size handler table indexed by MovementTypeIndex().
+     * Tables are built once per class and shared by every instance, so dispatch is an array load and an indirect call.
+     */
+    struct FMovementHandlerTable
+    {
+        FMovementHandler Handlers[MovementTypeCount] = {};
+
+        // Returns the handler bound to the type, or nullptr if the type is outside Idle..Zipline or unbound.
+        FORCEINLINE FMovementHandler Find(EMovementType Type) const
+        {
+            const int32 Index = MovementTypeIndex(Type);
+            return IsValidMovementTypeIndex(Index) ? Handlers[Index] : nullptr;
+        }
+
+        // Binds the handler to the type. Types outside Idle..Zipline are ignored.
+        FORCEINLINE constexpr void Set(EMovementType Type, FMovementHandler Handler)
+        {
+            const int32 Index = MovementTypeIndex(Type);
+            if (IsValidMovementTypeIndex(Index))
+            {
+                Handlers[Index] = Handler;
+            }
+        }
+    };
+
+    // Activate, Update and Deactivate handlers of one class.
+    struct FMovementDispatchTable
+    {
+        FMovementHandlerTable Activate;
+        FMovementHandlerTable Update;
+        FMovementHandlerTable Deactivate;
+    };
+
+    /**
+     * Returns the immutable dispatch table shared by every instance of this class.
+     * Subclasses override this to return their own function-local static table, built once by copying
+     * Super::GetMovementDispatchTable() and replacing entries through MakeMovementHandler().
+     */
+    virtual const FMovementDispatchTable& GetMovementDispatchTable() const;
+
+    // Converts a handler declared on a subclass into an entry usable by the dispatch tables.
+    template <typename TComponent>
+    static constexpr FMovementHandler MakeMovementHandler(void (TComponent::*Handler)())
+    {
+        static_assert(TIsDerivedFrom<TComponent, UAdvanceMovementComponent>::Value, "Movement handlers must belong to a UAdvanceMovementComponent subclass.");
+        return static_cast<FMovementHandler>(Handler);
+    }
+
+private:
+    static const FMovementDispatchTable MovementDispatchTable;
+
+#if !UE_BUILD_SHIPPING
+public:
+    /**
+     * Dispatches the given number of deactivations through this class's table, and through a TMap of TFunction
+     * wrapping the same handlers (the layout the table replaced), and returns the seconds each took.
+     * Deactivate handlers only commit module time and never switch movement, so they are safe to run on any component.
+     */
+    void BenchmarkMovementDispatch(int32 Iterations, double& OutMapSeconds, double& OutTableSeconds);
+#endif
+
+#pragma endregion
+
+#pragma region Activate
 
-    void InitializeActivateMovementHandlers();
+private:
+    static constexpr FMovementHandlerTable MakeActivateMovementHandlers();
 
     void Local_ActivateMovement(EMovementType Type);
 
@@ -257,9 +629,7 @@ private:
 #pragma region Update
 
 private:
-    TMap<EMovementType, TFunction<void()>> UpdateMovementHandlers;
-
-    void InitializeUpdateMovementHandlers();
+    static constexpr FMovementHandlerTable MakeUpdateMovementHandlers();
 
     bool IsUpdateEnabled(EMovementType Type);
 
@@ -278,9 +648,7 @@ private:
 #pragma region Deactivate
 
 private:
-    TMap<EMovementType, TFunction<void()>> DeactivateMovementHandlers;
-
-    void InitializeDeactivateMovementHandlers();
+    static constexpr FMovementHandlerTable MakeDeactivateMovementHandlers();
 
     void Local_DeactivateMovement(EMovementType Type);
 
@@ -298,6 +666,143 @@ private:
 
 
 
+#pragma region Signal
+
+private:
+    // Values read by transition guards, captured once per tick to detect which signals changed.
+    struct FMovementSignalSnapshot
+    {
+        uint64  InputBits   = 0;
+        float   Stamina     = 0.0f;
+        float   Health      = 0.0f;
+        FVector Location    = FVector::ZeroVector;
+        bool    bGrounded   = false;
+        bool    bInWater    = false;
+    };
+
+    // Snapshot taken at the start of the previous movement tick
+    FMovementSignalSnapshot SignalSnapshot;
+
+    // Signals that changed since the previous tick. Everything is dirty until the first refresh.
+    EMovementSignal DirtySignals = EMovementSignal::All;
+
+    // Signals raised through NotifyMovementSignal() or a state change, folded into the next refresh
+    EMovementSignal PendingSignals = EMovementSignal::All;
+
+    // Incremented on every movement state change, so callers can tell whether a transition fired
+    uint32 TransitionSerial = 0;
+
+    // Number of transition guards run during the current tick
+    int32 TransitionChecksThisTick = 0;
+
+    // Captures a new snapshot and computes DirtySignals. Called once at the start of the movement tick.
+    void RefreshMovementSignals();
+
+    // Packs the player input cache flags into a bitfield. Returns 0 when there is no input cache.
+    uint64 CaptureInputBits() const;
+
+    // Input flags the transition guards read during this movement tick
+    FMovementInputBits MovementInput;
+
+    // True while MovementInput comes from a client move (server) or a replay frame instead of the local input cache
+    bool bExternalInput = false;
+
+public:
+    FORCEINLINE const FMovementInputBits& GetMovementInput() const
+    {
+        return MovementInput;
+    }
+
+    // Makes the guards read the given input flags, until ClearExternalInput, instead of the local input cache.
+    void SetExternalInput(uint64 InputBits);
+
+    void ClearExternalInput();
+
+private:
+
+    // Runs the transition only if one of its signals is dirty. Returns true if it changed the movement state.
+    bool EvaluateTransition(EMovementSignal Signals, FMovementHandler Transition);
+
+    // Maps the dirty signals that woke a transition guard to the reason recorded for its switch.
+    static EMovementSwitchReason GetSwitchReason(EMovementSignal Signals);
+
+public:
+    // Marks signals as changed so dependent transitions are re-evaluated next tick (e.g. when an ability unlocks).
+    void NotifyMovementSignal(EMovementSignal Signals);
+
+    // Returns true if any of the given signals changed this tick.
+    FORCEINLINE bool IsMovementSignalDirty(EMovementSignal Signals) const
+    {
+        return EnumHasAnyFlags(DirtySignals, Signals);
+    }
+
+    // Returns how many transition guards ran during the current tick.
+    FORCEINLINE int32 GetTransitionChecksThisTick() const
+    {
+        return TransitionChecksThisTick;
+    }
+
+#pragma endregion
+
+#pragma region TransitionGraph
+
+protected:
+    /**
+     * One allowed transition. Action is the existing XToY function: it runs its own guard and switches state when it passes.
+     * Edges of a source are tried in ascending Priority and evaluation stops at the first one that changes state.
+     */
+    struct FMovementTransitionEdge
+    {
+        EMovementType               Source      = EMovementType::Null;
+        EMovementType               Target      = EMovementType::Null;
+        FMovementHandler            Action      = nullptr;
+        uint8                       Priority    = 0;
+        EMovementSignal             Signals     = EMovementSignal::None;
+        EMovementTransitionContext  Required    = EMovementTransitionContext::None;
+        EMovementTransitionContext  Excluded    = EMovementTransitionContext::None;
+    };
+
+    // Transition edges compiled into a dense source-by-target matrix plus a per-source priority order.
+    struct FMovementTransitionGraph
+    {
+        // Edge for every (source, target) pair; Action is nullptr if the transition is not allowed.
+        FMovementTransitionEdge Matrix[MovementTypeCount][MovementTypeCount];
+
+        // Targets of each source, sorted by ascending priority.
+        uint8 Order[MovementTypeCount][MovementTypeCount] = {};
+
+        // Number of valid entries in Order for each source.
+        uint8 OrderCount[MovementTypeCount] = {};
+
+        // Adds or replaces the edge for its (source, target) pair. Call Finalize() once all edges are added.
+        void Add(const FMovementTransitionEdge& Edge);
+
+        // Rebuilds the per-source priority order from the matrix.
+        void Finalize();
+
+        // Returns true if the graph allows moving from Source to Target.
+        bool IsAllowed(EMovementType Source, EMovementType Target) const;
+    };
+
+    /**
+     * Returns the compiled transition graph shared by every instance of this class.
+     * Subclasses override this to copy Super's graph into a function-local static, Add() their own edges and Finalize().
+     */
+    virtual const FMovementTransitionGraph& GetMovementTransitionGraph() const;
+
+private:
+    // Declared transition edges of this class, compiled by GetMovementTransitionGraph().
+    static TConstArrayView<FMovementTransitionEdge> GetMovementTransitionEdges();
+
+    /**
+     * Tries the outgoing edges of Source in priority order and stops at the first transition that fires.
+     * Context holds the tick-computed conditions; Grounded/Airborne are added here. Returns true if the state changed.
+     * MinPriority/MaxPriority restrict the pass to a band of edges, for ticks that check their own state between bands.
+     */
+    bool EvaluateTransitions(EMovementType Source, EMovementTransitionContext Context = EMovementTransitionContext::None, uint8 MinPriority = 0, uint8 MaxPriority = MAX_uint8);
+
+#pragma endregion
+
 #pragma region CapsuleComponent
 
 private:
@@ -320,6 +825,147 @@ public:
 
 #pragma endregion
 
+#pragma region Ledge
+
+private:
+    // Ledge found this frame, shared by DetectHang, MantleDetection and the vault checks
+    FLedgeInfo LedgeInfo;
+
+    // Returns the level's traversal annotations, or nullptr when there are none or AdvanceMovement.Traversal.UseAnnotations is off.
+    const UTraversalAnnotationData* GetTraversalAnnotations() const;
+
+public:
+    /**
+     * Finds the ledge in front of the character, once per frame.
+     * Static geometry is answered from the level's traversal annotations when they have an edge in reach.
+     * Otherwise one forward slab sweep locates the wall, one downward sphere sweep finds its top, then a clearance trace and a
+     * short bisection measure the space above and the depth of the top. Callers filter by WallDistance and Height.
+     */
+    const FLedgeInfo& DetectLedge();
+
+#pragma endregion
+
+#pragma region Anchor
+
+private:
+    // Anchor picked by the last successful DetectGrappling or DetectZipline
+    FMovementAnchor TargetAnchor;
+
+    // Finds the nearest registered anchor of the given type within range and the view cone. Constant time per query.
+    bool FindTargetAnchor(EMovementAnchorType Type, const FVector& Origin, const FVector& Direction, float Range, float ConeHalfAngle);
+
+public:
+    FORCEINLINE const FMovementAnchor& GetTargetAnchor() const
+    {
+        return TargetAnchor;
+    }
+
+#pragma endregion
+
+#pragma region GroundTracking
+
+private:
+    // Ground below the character, reused between calls to GroundDistance()
+    struct FGroundTrack
+    {
+        // Frame the distance below was last resolved on
+        uint64 Frame = 0;
+
+        // Distance from the ground probe origin to the ground, or -1 when no ground was found
+        float Distance = -1.0f;
+
+        // Height of the ground under TraceLocation; valid when bHasGround
+        float GroundZ = 0.0f;
+        bool bHasGround = false;
+
+        // Where and when the last downward trace ran
+        FVector TraceLocation = FVector::ZeroVector;
+        float TraceTime = -1.0f;
+
+        // Seconds until the capsule reaches GroundZ on its current ballistic path, or -1 when not descending onto it
+        float TimeToImpact = -1.0f;
+    };
+
+    FGroundTrack GroundTrack;
+
+    // Height the ground distance is measured from: just below the capsule bottom, matching PerformGroundDistanceTrace.
+    float GroundProbeOriginZ() const;
+
+    // True while the last traced ground can still answer for the current location (AdvanceMovement.Ground.*).
+    bool IsGroundTrackValid(const FVector& Location, float WorldTime) const;
+
+    // Solves the ballistic path for the time at which the probe origin reaches GroundZ.
+    float PredictTimeToImpact(float Height) const;
+
+public:
+    /**
+     * Distance from just below the capsule to the ground, or -1 if nothing lies within 10000 units.
+     * Grounded: read from the floor result of the character movement. Airborne: derived from the last downward trace,
+     * which is repeated only once the character has moved sideways past tolerance, the trace has aged out or the
+     * character has passed below the traced ground. Resolved once per frame.
+     */
+    float GroundDistance();
+
+    // Seconds until the character lands on its current path, or -1 when grounded, rising or over no ground.
+    FORCEINLINE float GetTimeToGroundImpact() const
+    {
+        return GroundTrack.TimeToImpact;
+    }
+
+#pragma endregion
+
+#pragma region Water
+
+private:
+    // Actor tag that marks a water body for overlap-based detection
+    static const FName WaterTag;
+
+    // Water bodies the capsule overlaps, maintained from the capsule's overlap events
+    TArray<TWeakObjectPtr<UPrimitiveComponent>, TInlineAllocator<2>> OverlappedWaterBodies;
+
+    // True while the current physics volume is a water volume
+    bool bInWaterVolume = false;
+
+    // Surface and floor height of the water the character is in, refreshed when a water body or volume is entered or left
+    float WaterSurfaceZ = 0.0f;
+    float WaterFloorZ   = 0.0f;
+
+    // Binds the capsule overlap events and seeds the water state from the current overlaps.
+    void BindWaterEvents();
+
+    // Unbinds the capsule overlap events.
+    void UnbindWaterEvents();
+
+    // Recomputes the cached surface and floor heights and raises the Water signal.
+    void RefreshWaterState();
+
+    // Returns true when the component belongs to an actor tagged as water.
+    static bool IsWaterBody(const UPrimitiveComponent* Component);
+
+    UFUNCTION()
+    void OnWaterBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnWaterEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+protected:
+    virtual void PhysicsVolumeChanged(APhysicsVolume* NewVolume) override;
+
+public:
+    // True while the character overlaps a tagged water body or stands in a water physics volume.
+    FORCEINLINE bool IsInWaterBody() const
+    {
+        return bInWaterVolume || OverlappedWaterBodies.Num() > 0;
+    }
+
+    // Depth of the capsule bottom below the water surface, or 0 when out of water.
+    float GetWaterImmersionDepth() const;
+
+    // Depth of water below the capsule bottom, down to the floor of the water body, or 0 when out of water.
+    float GetWaterDepthBelow() const;
+
+#pragma endregion
+
 #pragma region Utility
 
 private:
@@ -347,21 +993,56 @@ private:
 /* Traces */
     float PerformWallHeightTrace();
     float GroundCheckTimer;
+
+    // Traces 10000 units down from just below the capsule. Prefer GroundDistance(), which only traces when its cache is stale.
     float PerformGroundDistanceTrace();
 
 /* Detection */
     /* Performs a trace check to detect a wall in front within the given distance */
     bool IsFrontWallDetected(float InTraceDistance);
 
-    /* Detects if the character can hang from a ledge */
+    /* Detects if the character can hang from a ledge, within the world's detection budget */
     bool DetectHang();
 
-    // Checks if the character is currently overlapping water actors and updates swimming state. Returns true if in water.
+    /* Runs the hang ledge search; DetectHang decides whether it runs this frame */
+    bool PerformHangDetection();
+
+    // Returns true if the character is in water. Served from the cached water state, see IsInWaterBody().
     bool DetectWater();
 
 #pragma endregion
 
 
+#pragma region MovementState
+
+private:
+    // Movement state driven by the Enter, Tick*Movement and XToY functions below
+    EMovementState CurrentMovementState = EMovementState::Idle;
+
+    // State the character left on the last SetMovementState call
+    EMovementState PreviousMovementState = EMovementState::Idle;
+
+    // Reason recorded by the next SetMovementState call; scoped by EvaluateTransition and the network and forced paths
+    EMovementSwitchReason SwitchReason = EMovementSwitchReason::Unspecified;
+
+    // Enters a new movement state and marks every outgoing transition of it for evaluation on the next tick.
+    void SetMovementState(EMovementState NewMovementState);
+
+    // Refreshes the transition signals, then runs the Tick*Movement function of the current state. Called from UpdateMovementLogic.
+    void TickMovement();
+
+public:
+    EMovementState GetCurrentMovementState() const;
+    EMovementState GetPreviousMovementState() const;
+
+    void SetCurrentMovementState(EMovementState NewState);
+    void SetPreviousMovementState(EMovementState NewState);
+
+    bool IsCurrentMovementState(EMovementState IsMovementState) const;
+    bool IsPreviousMovementState(EMovementState IsPreviousState) const;
+
+#pragma endregion
+
 #pragma region BasicMovement
 
 private:
@@ -675,6 +1356,9 @@ private:
 
     bool CanProneThrustForward();
 
+    // In-state action: launches the character forward on a jump press when unlocked, affordable and unobstructed.
+    void TryProneForwardThrust();
+
 #pragma endregion
 
 #pragma region Transition
@@ -687,8 +1371,6 @@ private:
     void ProneToCrawl();
     void ProneToFall();
 
-    void ProneToForwardThrust();
-
 #pragma endregion
 
 
@@ -1085,6 +1767,8 @@ private:
 
 	bool TeleportDetection();
 
+	bool PerformTeleportDetection();
+
 #pragma endregion
 
 #pragma region Perform
@@ -1163,10 +1847,63 @@ private:
 
     bool VaultCheck();
 
+    bool PerformVaultCheck();
+
     bool VaultHeightDetection();
 
+    // Result of a search for the top edge of the obstacle in front of the capsule.
+    struct FVaultLedgeProbe
+    {
+        // Capsule location and forward trace offset at the start of the search, shared by every trace of it
+        FVector Origin = FVector::ZeroVector;
+        FVector Reach  = FVector::ZeroVector;
+
+        FCollisionQueryParams QueryParams;
+
+        // True when a blocking trace was followed by a clear one above it
+        bool bFound = false;
+
+        // Impact point of the highest blocking trace below the edge
+        FVector LastHitLocation = FVector::ZeroVector;
+
+        // Number of line traces issued by the search
+        int32 TraceCount = 0;
+    };
+
+    // Maps a ledge height above the capsule floor to its vault height type.
+    static EVaultHeightType ClassifyVaultHeight(float Height);
+
+    // Stores the height result for the ledge face point; returns false when it is above the vault's maximum height.
+    bool ApplyVaultHeight(FVector LastHitLocation, const FVector& CapsuleFloor);
+
+    // Stores the width result for the far edge of the top; returns false when it is too narrow to vault.
+    bool ApplyVaultWidth(const FVector& FarEdgeLocation);
+
+    // Captures the capsule and builds the query parameters once for a whole ledge search.
+    FVaultLedgeProbe MakeVaultLedgeProbe();
+
+    // Forward trace at the given height; records the impact point into the probe on a hit.
+    bool TraceVaultLedgeAt(float Z, FVaultLedgeProbe& Probe);
+
+    // Legacy search: one forward trace per unit of height (AdvanceMovement.Vault.LegacyScan).
+    FVaultLedgeProbe ScanVaultLedge(float FloorZ, float CeilZ);
+
+    // Coarse scan in AdvanceMovement.Vault.CoarseStep increments ending on CeilZ, then bisection to 1 unit.
+    FVaultLedgeProbe RefineVaultLedge(float FloorZ, float CeilZ);
+
     bool VaultWitdhDetection();
 
+    /**
+     * Finds the far edge of a top surface from short downward traces at increasing depth past its near edge.
+     * Walks in AdvanceMovement.Vault.CoarseStep increments up to the first miss, then bisects that step to 1 unit,
+     * so an uneven top (gaps, steps down) yields its first far edge rather than any one of them.
+     * Returns false when there is no top at depth 0 or it runs past MaximumDepth.
+     */
+    static bool FindTopFarEdge(TFunctionRef<bool(float, FHitResult&)> TraceTopAt, float MaximumDepth, float& OutDepth, FVector& OutFarEdgePoint);
+
+    // Legacy width search: one downward trace per unit over 200 units (AdvanceMovement.Vault.LegacyScan).
+    bool ScanVaultWidth();
+
     bool VaultCapsuleSizeHeightValidation();
 
 #pragma endregion
@@ -1203,6 +1940,8 @@ private:
 
     bool MantleDetection();
 
+    bool PerformMantleDetection();
+
 #pragma endregion
 
 #pragma endregion
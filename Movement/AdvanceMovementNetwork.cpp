@@ -0,0 +1,534 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/AdvanceMovementNetwork.h"
+#include "Character/Component/Movement/AdvanceMovementComponent.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region Configuration
+
+static float GAdvanceMovementNetStateFullInterval = 1.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementNetStateFullInterval
+(
+    TEXT("AdvanceMovement.NetStateFullInterval"),
+    GAdvanceMovementNetStateFullInterval,
+    TEXT("Seconds after which the replicated movement state is sent in full again instead of as a delta, so a client that dropped a delta resyncs."),
+    ECVF_Default
+);
+
+#pragma endregion
+
+#pragma region Stats
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replicated State Bits"), STAT_AdvanceMovement_ReplicatedStateBits, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replicated State Sends"), STAT_AdvanceMovement_ReplicatedStateSends, STATGROUP_AdvanceMovement);
+
+#pragma endregion
+
+namespace AdvanceMovementNetwork
+{
+    // Writes a movement type as its dense index plus one, with 0 for types outside Idle..Zipline (such as Null).
+    static void SerializeMovementType(FArchive& Ar, EMovementType& Type)
+    {
+        const int32 Index = MovementTypeIndex(Type);
+        uint32 Value = Ar.IsSaving() && IsValidMovementTypeIndex(Index) ? static_cast<uint32>(Index + 1) : 0;
+
+        Ar.SerializeInt(Value, MovementTypeCount + 1);
+
+        if (Ar.IsLoading())
+        {
+            Type = Value > 0 ? static_cast<EMovementType>(static_cast<int32>(Value) - 1 + static_cast<int32>(EMovementType::Idle)) : EMovementType::Null;
+        }
+    }
+}
+
+#pragma region MovementPayload
+
+bool FAdvanceMovementPayload::UsesDirection(EMovementType InType)
+{
+    switch (InType)
+    {
+    case EMovementType::Dash:
+    case EMovementType::Slide:
+    case EMovementType::Roll:
+    case EMovementType::WallRun:
+    case EMovementType::VerticalWallRun:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool FAdvanceMovementPayload::UsesTarget(EMovementType InType)
+{
+    switch (InType)
+    {
+    case EMovementType::Hang:
+    case EMovementType::Vault:
+    case EMovementType::Mantle:
+    case EMovementType::Teleport:
+    case EMovementType::Grappling:
+    case EMovementType::Zipline:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void FAdvanceMovementPayload::SetDirection(const FVector& Direction)
+{
+    DirectionYaw = FRotator::CompressAxisToShort(Direction.Rotation().Yaw);
+}
+
+FVector FAdvanceMovementPayload::GetDirection() const
+{
+    return FRotator(0.0f, FRotator::DecompressAxisFromShort(DirectionYaw), 0.0f).Vector();
+}
+
+bool FAdvanceMovementPayload::Serialize(FArchive& Ar, UPackageMap* PackageMap)
+{
+    AdvanceMovementNetwork::SerializeMovementType(Ar, Type);
+
+    if (Ar.IsLoading() && !IsValidMovementTypeIndex(MovementTypeIndex(Type)))
+    {
+        Ar.SetError();
+        return false;
+    }
+
+    if (UsesDirection(Type))
+    {
+        Ar << DirectionYaw;
+    }
+
+    if (UsesTarget(Type))
+    {
+        bool bTargetSuccess = true;
+        Target.NetSerialize(Ar, PackageMap, bTargetSuccess);
+    }
+
+    return !Ar.IsError();
+}
+
+#pragma endregion
+
+#pragma region SavedMove
+
+void FSavedMove_Advance::Clear()
+{
+    Super::Clear();
+
+    StartPayload = FAdvanceMovementPayload();
+    EndPayload   = FAdvanceMovementPayload();
+    StartPhase   = EMovementPhase::ReadyToAttempt;
+    EndPhase     = EMovementPhase::ReadyToAttempt;
+    InputBits    = 0;
+}
+
+void FSavedMove_Advance::SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+    Super::SetMoveFor(Character, InDeltaTime, NewAccel, ClientData);
+
+    if (const UAdvanceMovementComponent* Movement = Cast<UAdvanceMovementComponent>(Character->GetCharacterMovement()))
+    {
+        StartPayload = Movement->MakeMovementPayload();
+        EndPayload   = StartPayload;
+        StartPhase   = Movement->GetCurrentMovementPhase();
+        EndPhase     = StartPhase;
+        InputBits    = Movement->GetMovementInput().Bits;
+    }
+}
+
+void FSavedMove_Advance::PostUpdate(ACharacter* Character, EPostUpdateMode PostUpdateMode)
+{
+    Super::PostUpdate(Character, PostUpdateMode);
+
+    UAdvanceMovementComponent* Movement = Cast<UAdvanceMovementComponent>(Character->GetCharacterMovement());
+    if (!Movement)
+    {
+        return;
+    }
+
+    if (PostUpdateMode == PostUpdate_Record)
+    {
+        EndPayload = Movement->MakeMovementPayload();
+        EndPhase   = Movement->GetCurrentMovementPhase();
+        return;
+    }
+
+    // Replays never run the state machine, so leave the move in the type it originally predicted. A Sprint to Slide
+    // switch predicted after the corrected move therefore survives the correction: the response restores Sprint, the
+    // replayed moves restore Slide, and the slide is never entered a second time.
+    if (PostUpdateMode == PostUpdate_Replay)
+    {
+        Movement->RestoreMovementPayload(EndPayload, EndPhase);
+    }
+}
+
+void FSavedMove_Advance::PrepMoveFor(ACharacter* Character)
+{
+    Super::PrepMoveFor(Character);
+
+    // Replaying after a correction: put the movement state, type and phase back to what they were when the move was
+    // first simulated, without running any Enter, Exit or switch logic a second time.
+    if (UAdvanceMovementComponent* Movement = Cast<UAdvanceMovementComponent>(Character->GetCharacterMovement()))
+    {
+        Movement->RestoreMovementPayload(StartPayload, StartPhase);
+    }
+}
+
+bool FSavedMove_Advance::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+    const FSavedMove_Advance* Other = static_cast<const FSavedMove_Advance*>(NewMove.Get());
+
+    // A combined move runs from this start to the other's end, so both must stay in one movement type throughout.
+    if (StartPayload.Type != EndPayload.Type || Other->StartPayload.Type != Other->EndPayload.Type || EndPayload.Type != Other->StartPayload.Type)
+    {
+        return false;
+    }
+
+    // The server runs its guards on one set of input flags per move; combining would drop a press.
+    if (InputBits != Other->InputBits)
+    {
+        return false;
+    }
+
+    return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+bool FSavedMove_Advance::IsImportantMove(const FSavedMovePtr& LastAckedMove) const
+{
+    if (LastAckedMove.IsValid())
+    {
+        const FSavedMove_Advance* Acked = static_cast<const FSavedMove_Advance*>(LastAckedMove.Get());
+
+        if (Acked->EndPayload.Type != EndPayload.Type)
+        {
+            return true;
+        }
+    }
+
+    return Super::IsImportantMove(LastAckedMove);
+}
+
+uint8 FSavedMove_Advance::GetCompressedFlags() const
+{
+    uint8 Flags = Super::GetCompressedFlags();
+
+    if (StartPayload.Type != EndPayload.Type)
+    {
+        Flags |= FLAG_MovementSwitched;
+    }
+
+    return Flags;
+}
+
+FNetworkPredictionData_Client_Advance::FNetworkPredictionData_Client_Advance(const UCharacterMovementComponent& ClientMovement)
+: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Advance::AllocateNewMove()
+{
+    return FSavedMovePtr(new FSavedMove_Advance());
+}
+
+#pragma endregion
+
+#pragma region NetworkMoveData
+
+void FAdvanceNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+    Super::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+    const FSavedMove_Advance& AdvanceMove = static_cast<const FSavedMove_Advance&>(ClientMove);
+
+    MovementPayload = AdvanceMove.EndPayload;
+    InputBits       = AdvanceMove.InputBits;
+}
+
+bool FAdvanceNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+    Super::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+    // Packed: a move without movement input costs a single byte.
+    Ar.SerializeIntPacked64(InputBits);
+
+    return MovementPayload.Serialize(Ar, PackageMap);
+}
+
+FAdvanceNetworkMoveDataContainer::FAdvanceNetworkMoveDataContainer()
+{
+    NewMoveData     = &MoveData[0];
+    PendingMoveData = &MoveData[1];
+    OldMoveData     = &MoveData[2];
+}
+
+void FAdvanceMoveResponseDataContainer::ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment)
+{
+    Super::ServerFillResponseData(CharacterMovement, PendingAdjustment);
+
+    const UAdvanceMovementComponent& Movement = static_cast<const UAdvanceMovementComponent&>(CharacterMovement);
+
+    // The server's own type, whatever the client asked for.
+    MovementPayload = Movement.MakeMovementPayload();
+    MovementPhase   = Movement.GetCurrentMovementPhase();
+}
+
+bool FAdvanceMoveResponseDataContainer::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+    if (!Super::Serialize(CharacterMovement, Ar, PackageMap))
+    {
+        return false;
+    }
+
+    // Acknowledgements carry no state; only corrections need the server's movement type and phase.
+    if (!IsGoodMove())
+    {
+        static_assert(static_cast<int32>(EMovementPhase::MAX) <= 8, "EMovementPhase no longer fits the 3 bits it is sent in");
+
+        uint32 PhaseValue = static_cast<uint32>(MovementPhase);
+        Ar.SerializeInt(PhaseValue, 8);
+        MovementPhase = static_cast<EMovementPhase>(PhaseValue);
+
+        return MovementPayload.Serialize(Ar, PackageMap);
+    }
+
+    return !Ar.IsError();
+}
+
+#pragma endregion
+
+#pragma region ReplicatedMovementState
+
+namespace AdvanceMovementNetwork
+{
+    // Per-connection base the server deltas the next send against.
+    struct FMovementStateDeltaBase : public INetDeltaBaseState
+    {
+        FMovementStateSnapshot Snapshot;
+
+        // When the connection last got a full state
+        double LastFullSendTime = 0.0;
+
+        virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+        {
+            const FMovementStateSnapshot& Other = static_cast<FMovementStateDeltaBase*>(OtherState)->Snapshot;
+            return Snapshot.Sequence == Other.Sequence && Snapshot.GetChangedGroups(Other) == 0;
+        }
+    };
+}
+
+uint8 FMovementStateSnapshot::GetChangedGroups(const FMovementStateSnapshot& Base) const
+{
+    uint8 Groups = 0;
+
+    if (CurrentType != Base.CurrentType || PreviousType != Base.PreviousType || EnteredAtMs != Base.EnteredAtMs)
+    {
+        Groups |= Group_Types;
+    }
+
+    if (Phase != Base.Phase)
+    {
+        Groups |= Group_Phase;
+    }
+
+    if (FAdvanceMovementPayload::UsesDirection(CurrentType) && DirectionYaw != Base.DirectionYaw)
+    {
+        Groups |= Group_Direction;
+    }
+
+    if (FAdvanceMovementPayload::UsesTarget(CurrentType) && !Target.Equals(Base.Target, 1.0f))
+    {
+        Groups |= Group_Target;
+    }
+
+    return Groups;
+}
+
+uint8 FMovementStateSnapshot::GetUsedGroups() const
+{
+    uint8 Groups = Group_Types | Group_Phase;
+
+    if (FAdvanceMovementPayload::UsesDirection(CurrentType))
+    {
+        Groups |= Group_Direction;
+    }
+
+    if (FAdvanceMovementPayload::UsesTarget(CurrentType))
+    {
+        Groups |= Group_Target;
+    }
+
+    return Groups;
+}
+
+void FMovementStateSnapshot::SerializeGroups(FArchive& Ar, UPackageMap* PackageMap, uint8 Groups)
+{
+    if (Groups & Group_Types)
+    {
+        AdvanceMovementNetwork::SerializeMovementType(Ar, CurrentType);
+        AdvanceMovementNetwork::SerializeMovementType(Ar, PreviousType);
+        Ar.SerializeIntPacked(EnteredAtMs);
+    }
+
+    if (Groups & Group_Phase)
+    {
+        static_assert(static_cast<int32>(EMovementPhase::MAX) <= 8, "EMovementPhase no longer fits the 3 bits it is sent in");
+
+        uint32 PhaseValue = static_cast<uint32>(Phase);
+        Ar.SerializeInt(PhaseValue, 8);
+        Phase = static_cast<EMovementPhase>(PhaseValue);
+    }
+
+    if (Groups & Group_Direction)
+    {
+        Ar << DirectionYaw;
+    }
+
+    if (Groups & Group_Target)
+    {
+        bool bTargetSuccess = true;
+        Target.NetSerialize(Ar, PackageMap, bTargetSuccess);
+    }
+}
+
+bool FReplicatedMovementState::SetSnapshot(const FMovementStateSnapshot& NewSnapshot)
+{
+    if (NewSnapshot.GetChangedGroups(Snapshot) == 0)
+    {
+        return false;
+    }
+
+    const uint8 NextSequence = Snapshot.Sequence + 1;
+
+    Snapshot = NewSnapshot;
+    Snapshot.Sequence = NextSequence;
+    ++ChangeCount;
+    return true;
+}
+
+void FReplicatedMovementState::RecordReceived()
+{
+    ReceivedHistory[Snapshot.Sequence % HistorySize] = Snapshot;
+    bReceivedAny = true;
+}
+
+const FMovementStateSnapshot* FReplicatedMovementState::FindReceived(uint8 InSequence) const
+{
+    const FMovementStateSnapshot& Entry = ReceivedHistory[InSequence % HistorySize];
+    return bReceivedAny && Entry.Sequence == InSequence ? &Entry : nullptr;
+}
+
+int32 FReplicatedMovementState::GetMaxFullStateBytes()
+{
+    // Sequence, delta bit, group mask, two types, packed time, phase, yaw and a packed NetQuantize10 vector.
+    const int32 Bits = 8 + 1 + FMovementStateSnapshot::GroupBits + 5 + 5 + 40 + 3 + 16 + (5 + 3 * 30);
+    return (Bits + 7) / 8;
+}
+
+bool FReplicatedMovementState::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+    using namespace AdvanceMovementNetwork;
+
+    if (FBitWriter* Writer = DeltaParms.Writer)
+    {
+        const FMovementStateDeltaBase* Base = static_cast<const FMovementStateDeltaBase*>(DeltaParms.OldState);
+
+        const double Now      = FPlatformTime::Seconds();
+        const bool bFullDue   = !Base || Now - Base->LastFullSendTime >= GAdvanceMovementNetStateFullInterval;
+
+        // Unchanged: nothing to send until a full state is due again. That resend also covers a lost full state,
+        // which the connection would otherwise never recover from while the character stays in one state.
+        if (Base && Base->Snapshot.Sequence == Snapshot.Sequence && !bFullDue)
+        {
+            return false;
+        }
+
+        // Delta only against the base this connection acknowledged and only while the client's history still holds it.
+        // Without an acknowledged base, or once the full state timer runs out, send everything.
+        const uint8 Distance = Base ? static_cast<uint8>(Snapshot.Sequence - Base->Snapshot.Sequence) : 0;
+        uint8 bDelta = Base && Distance < HistorySize && !bFullDue ? 1 : 0;
+
+        uint8 Groups = bDelta ? Snapshot.GetChangedGroups(Base->Snapshot) : Snapshot.GetUsedGroups();
+
+        const int64 StartBits = Writer->GetNumBits();
+
+        *Writer << Snapshot.Sequence;
+        Writer->SerializeBits(&bDelta, 1);
+
+        if (bDelta)
+        {
+            uint8 BaseSequence = Base->Snapshot.Sequence;
+            *Writer << BaseSequence;
+        }
+
+        Writer->SerializeBits(&Groups, FMovementStateSnapshot::GroupBits);
+        Snapshot.SerializeGroups(*Writer, DeltaParms.Map, Groups);
+
+        const int64 WrittenBits = Writer->GetNumBits() - StartBits;
+        BitsSent += WrittenBits;
+        ++SendCount;
+        INC_DWORD_STAT_BY(STAT_AdvanceMovement_ReplicatedStateBits, WrittenBits);
+        INC_DWORD_STAT(STAT_AdvanceMovement_ReplicatedStateSends);
+
+        TSharedPtr<FMovementStateDeltaBase> NewBase = MakeShared<FMovementStateDeltaBase>();
+        NewBase->Snapshot         = Snapshot;
+        NewBase->LastFullSendTime = bDelta ? Base->LastFullSendTime : Now;
+        *DeltaParms.NewState = NewBase;
+        return true;
+    }
+
+    if (FBitReader* Reader = DeltaParms.Reader)
+    {
+        uint8 Sequence = 0;
+        uint8 bDelta   = 0;
+        uint8 Groups   = 0;
+
+        *Reader << Sequence;
+        Reader->SerializeBits(&bDelta, 1);
+
+        FMovementStateSnapshot Received = Snapshot;
+
+        if (bDelta)
+        {
+            uint8 BaseSequence = 0;
+            *Reader << BaseSequence;
+
+            const FMovementStateSnapshot* Base = FindReceived(BaseSequence);
+
+            if (!Base)
+            {
+                // Nothing valid to apply it to: read past it and keep the current state until the next full one,
+                // at most AdvanceMovement.NetStateFullInterval away.
+                UE_LOG(LogAdvanceMovement, Verbose, TEXT("Replicated movement state %u: delta base %u not in history, dropped."), Sequence, BaseSequence);
+
+                FMovementStateSnapshot Discarded;
+                Reader->SerializeBits(&Groups, FMovementStateSnapshot::GroupBits);
+                Discarded.SerializeGroups(*Reader, DeltaParms.Map, Groups);
+                return !Reader->IsError();
+            }
+
+            Received = *Base;
+        }
+
+        Reader->SerializeBits(&Groups, FMovementStateSnapshot::GroupBits);
+        Received.SerializeGroups(*Reader, DeltaParms.Map, Groups);
+
+        if (Reader->IsError())
+        {
+            return false;
+        }
+
+        Received.Sequence = Sequence;
+        Snapshot = Received;
+        RecordReceived();
+        return true;
+    }
+
+    return false;
+}
+
+#pragma endregion
@@ -0,0 +1,246 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/CharacterMovementReplication.h"
+#include "Engine/NetSerialization.h"
+#include "Character/Component/Movement/MovementData.h"
+#include "AdvanceMovementNetwork.generated.h"
+
+#pragma region MovementPayload
+
+/**
+ * Custom movement state carried by every saved move and server response.
+ * Only the fields the movement type uses are serialized: the type is a few bits, a direction is a 16-bit yaw and a
+ * target is a quantized vector, so a move that stays in a locomotion type costs a handful of bits.
+ */
+struct AGEOFREVERSE_API FAdvanceMovementPayload
+{
+    EMovementType Type = EMovementType::Idle;
+
+    // Horizontal direction of the movement (dash, slide, roll, wall run), mapped from [0, 360) degrees onto [0, 65536)
+    uint16 DirectionYaw = 0;
+
+    // World point the movement heads for (ledge edge, anchor)
+    FVector_NetQuantize10 Target = FVector::ZeroVector;
+
+    // Movement types whose payload includes a direction.
+    static bool UsesDirection(EMovementType InType);
+
+    // Movement types whose payload includes a target.
+    static bool UsesTarget(EMovementType InType);
+
+    void SetDirection(const FVector& Direction);
+
+    FVector GetDirection() const;
+
+    // Reads or writes the payload. Returns false when the archive held an invalid movement type.
+    bool Serialize(FArchive& Ar, UPackageMap* PackageMap);
+
+    bool operator==(const FAdvanceMovementPayload& Other) const
+    {
+        return Type == Other.Type
+            && (!UsesDirection(Type) || DirectionYaw == Other.DirectionYaw)
+            && (!UsesTarget(Type) || Target.Equals(Other.Target, 1.0f));
+    }
+
+    bool operator!=(const FAdvanceMovementPayload& Other) const
+    {
+        return !(*this == Other);
+    }
+};
+
+#pragma endregion
+
+#pragma region SavedMove
+
+/**
+ * Client saved move that records the custom movement state the move ended in.
+ * The payload goes to the server with the move, is restored without side effects around the move when it is replayed
+ * after a correction, and keeps moves with different movement types from being combined.
+ */
+class AGEOFREVERSE_API FSavedMove_Advance : public FSavedMove_Character
+{
+    using Super = FSavedMove_Character;
+
+public:
+    // Movement state at the start and at the end of the move
+    FAdvanceMovementPayload StartPayload;
+    FAdvanceMovementPayload EndPayload;
+
+    // Module phase of StartPayload's and EndPayload's type; kept on the client only, for replays
+    EMovementPhase StartPhase = EMovementPhase::ReadyToAttempt;
+    EMovementPhase EndPhase   = EMovementPhase::ReadyToAttempt;
+
+    // FMovementInputBits the transition guards read when the move was made; the server runs its guards on them
+    uint64 InputBits = 0;
+
+    virtual void Clear() override;
+    virtual void SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+    virtual void PostUpdate(ACharacter* Character, EPostUpdateMode PostUpdateMode) override;
+    virtual void PrepMoveFor(ACharacter* Character) override;
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+    virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override;
+    virtual uint8 GetCompressedFlags() const override;
+
+    // Set in the compressed flags when the movement type changed during the move.
+    static constexpr uint8 FLAG_MovementSwitched = FSavedMove_Character::FLAG_Custom_0;
+};
+
+class AGEOFREVERSE_API FNetworkPredictionData_Client_Advance : public FNetworkPredictionData_Client_Character
+{
+    using Super = FNetworkPredictionData_Client_Character;
+
+public:
+    explicit FNetworkPredictionData_Client_Advance(const UCharacterMovementComponent& ClientMovement);
+
+    virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+#pragma endregion
+
+#pragma region NetworkMoveData
+
+// Move data sent from the client: the engine's move plus the payload of the saved move.
+struct AGEOFREVERSE_API FAdvanceNetworkMoveData : public FCharacterNetworkMoveData
+{
+    using Super = FCharacterNetworkMoveData;
+
+    FAdvanceMovementPayload MovementPayload;
+
+    // FMovementInputBits of the saved move
+    uint64 InputBits = 0;
+
+    virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+struct AGEOFREVERSE_API FAdvanceNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+    FAdvanceNetworkMoveDataContainer();
+
+private:
+    FAdvanceNetworkMoveData MoveData[3];
+};
+
+// Server response: the engine's adjustment plus the server's movement state, so a correction also corrects the movement type.
+struct AGEOFREVERSE_API FAdvanceMoveResponseDataContainer : public FCharacterMoveResponseDataContainer
+{
+    using Super = FCharacterMoveResponseDataContainer;
+
+    FAdvanceMovementPayload MovementPayload;
+    EMovementPhase MovementPhase = EMovementPhase::ReadyToAttempt;
+
+    virtual void ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap) override;
+};
+
+#pragma endregion
+
+#pragma region ReplicatedMovementState
+
+// Replicated fields of FReplicatedMovementState; also what the client keeps per received state to resolve delta bases.
+struct FMovementStateSnapshot
+{
+    // Incremented by the server on every change; identifies delta bases
+    uint8 Sequence = 0;
+
+    EMovementType CurrentType  = EMovementType::Idle;
+    EMovementType PreviousType = EMovementType::Idle;
+
+    // Phase of the current type's module
+    EMovementPhase Phase = EMovementPhase::ReadyToAttempt;
+
+    // Server time the current type was entered, in milliseconds; proxies derive the elapsed progress from it
+    uint32 EnteredAtMs = 0;
+
+    // Direction and target of the current type, sent only when FAdvanceMovementPayload says the type uses them
+    uint16 DirectionYaw = 0;
+    FVector_NetQuantize10 Target = FVector::ZeroVector;
+
+    // Groups of fields a delta can carry
+    enum EGroup : uint8
+    {
+        Group_Types     = 1 << 0,
+        Group_Phase     = 1 << 1,
+        Group_Direction = 1 << 2,
+        Group_Target    = 1 << 3,
+
+        Group_All       = Group_Types | Group_Phase | Group_Direction | Group_Target
+    };
+
+    static constexpr uint32 GroupBits = 4;
+
+    // Groups whose fields differ from Base. The sequence number is not compared.
+    uint8 GetChangedGroups(const FMovementStateSnapshot& Base) const;
+
+    // Groups a full send of this snapshot carries.
+    uint8 GetUsedGroups() const;
+
+    // Reads or writes the fields of the given groups.
+    void SerializeGroups(FArchive& Ar, UPackageMap* PackageMap, uint8 Groups);
+};
+
+/**
+ * Movement state replicated to simulated proxies in place of the whole FCharacterMovement.
+ * Sent through NetDeltaSerialize: a full state is a sequence number, two 5-bit types, a 3-bit phase, the entry time and
+ * the fields the current type uses; later sends only carry the groups that changed since the state the connection last acknowledged.
+ */
+USTRUCT()
+struct AGEOFREVERSE_API FReplicatedMovementState
+{
+    GENERATED_BODY()
+
+#pragma region DataEntry
+
+public:
+    FMovementStateSnapshot Snapshot;
+
+    // Bits and sends written by NetDeltaSerialize on the server over all connections, for AdvanceMovement.NetStateReport
+    uint64 BitsSent = 0;
+    uint32 SendCount = 0;
+
+    // Number of times the server changed the state, for AdvanceMovement.NetStateReport
+    uint32 ChangeCount = 0;
+
+private:
+    // Received states kept on the client to resolve delta bases. The server never deltas against a state more than HistorySize changes old.
+    static constexpr int32 HistorySize = 8;
+
+    FMovementStateSnapshot ReceivedHistory[HistorySize];
+    bool bReceivedAny = false;
+
+#pragma endregion
+
+#pragma region Serialization
+
+public:
+    // Stores a new snapshot on the server, bumping the sequence number if anything changed. Returns true on change.
+    bool SetSnapshot(const FMovementStateSnapshot& NewSnapshot);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+    // Upper bound, in bytes, of one full send; used for reporting.
+    static int32 GetMaxFullStateBytes();
+
+private:
+    void RecordReceived();
+
+    const FMovementStateSnapshot* FindReceived(uint8 InSequence) const;
+
+#pragma endregion
+
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedMovementState> : public TStructOpsTypeTraitsBase2<FReplicatedMovementState>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true
+    };
+};
+
+#pragma endregion
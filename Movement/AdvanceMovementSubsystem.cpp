@@ -0,0 +1,411 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/AdvanceMovementSubsystem.h"
+#include "Character/Component/Movement/AdvanceMovementComponent.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "Character/Component/Movement/TraversalAnnotation.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region Stats
+
+DECLARE_CYCLE_STAT(TEXT("Batched Tick"),  STAT_AdvanceMovement_BatchedTick,  STATGROUP_AdvanceMovement);
+DECLARE_CYCLE_STAT(TEXT("Build Batches"), STAT_AdvanceMovement_BuildBatches, STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Components"), STAT_AdvanceMovement_BatchedComponents, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batches"),            STAT_AdvanceMovement_Batches,           STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Detection Slots Granted"),  STAT_AdvanceMovement_DetectionGranted,  STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Detection Slots Deferred"), STAT_AdvanceMovement_DetectionDeferred, STATGROUP_AdvanceMovement);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Anchors"), STAT_AdvanceMovement_RegisteredAnchors, STATGROUP_AdvanceMovement);
+
+#pragma endregion
+
+#pragma region Configuration
+
+static int32 GAdvanceMovementBatched = 0;
+static FAutoConsoleVariableRef CVarAdvanceMovementBatched
+(
+    TEXT("AdvanceMovement.Batched"),
+    GAdvanceMovementBatched,
+    TEXT("Runs movement logic from UAdvanceMovementSubsystem, grouped by movement type, instead of from each component's tick.\n")
+    TEXT("May be toggled at runtime; registered components move between the batched and the per-component path on the next frame.\n")
+    TEXT("0: per-component tick (default), 1: batched"),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementDetectionSlotsPerFrame = 64;
+static FAutoConsoleVariableRef CVarAdvanceMovementDetectionSlotsPerFrame
+(
+    TEXT("AdvanceMovement.DetectionBudget.SlotsPerFrame"),
+    GAdvanceMovementDetectionSlotsPerFrame,
+    TEXT("Hang, vault, mantle and teleport detections run per frame across the world. Player-controlled characters are never limited.\n")
+    TEXT("0: unlimited, default 64"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementDetectionLowShare = 0.5f;
+static FAutoConsoleVariableRef CVarAdvanceMovementDetectionLowShare
+(
+    TEXT("AdvanceMovement.DetectionBudget.LowShare"),
+    GAdvanceMovementDetectionLowShare,
+    TEXT("Fraction of the detection budget low-priority requests may use."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementDetectionNormalShare = 0.8f;
+static FAutoConsoleVariableRef CVarAdvanceMovementDetectionNormalShare
+(
+    TEXT("AdvanceMovement.DetectionBudget.NormalShare"),
+    GAdvanceMovementDetectionNormalShare,
+    TEXT("Fraction of the detection budget normal-priority requests may use. High priority may use all of it."),
+    ECVF_Default
+);
+
+#pragma endregion
+
+#pragma region ClassCycle
+
+bool UAdvanceMovementSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAdvanceMovementSubsystem::Deinitialize()
+{
+    for (UAdvanceMovementComponent* Component : Components)
+    {
+        if (IsValid(Component))
+        {
+            SetComponentBatched(Component, false);
+        }
+    }
+
+    Components.Reset();
+    bBatchingActive = false;
+
+    if (BatchTickFunction.IsTickFunctionRegistered())
+    {
+        BatchTickFunction.UnRegisterTickFunction();
+    }
+
+    for (TArray<UAdvanceMovementComponent*>& Batch : Batches)
+    {
+        Batch.Reset();
+    }
+
+    TraversalAnnotations = nullptr;
+    Anchors.Reset();
+    Benchmark.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UAdvanceMovementSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAdvanceMovementSubsystem, STATGROUP_AdvanceMovement);
+}
+
+bool UAdvanceMovementSubsystem::IsTickable() const
+{
+    return Components.Num() > 0 || Benchmark.IsValid();
+}
+
+void UAdvanceMovementSubsystem::Tick(float DeltaTime)
+{
+    if (Benchmark.IsValid() && !Benchmark->Tick(GetWorld()))
+    {
+        Benchmark.Reset();
+    }
+
+    SyncBatching();
+}
+
+void UAdvanceMovementSubsystem::TickBatches()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_BatchedTick);
+
+    if (!bBatchingActive)
+    {
+        return;
+    }
+
+    BuildBatches();
+
+    for (int32 TypeIndex = 0; TypeIndex < MovementTypeCount; ++TypeIndex)
+    {
+        const TArray<UAdvanceMovementComponent*>& Batch = Batches[TypeIndex];
+        if (Batch.Num() == 0)
+        {
+            continue;
+        }
+
+        INC_DWORD_STAT(STAT_AdvanceMovement_Batches);
+
+        // A component may switch type inside its update; it still finishes this frame in the batch it started in.
+        for (UAdvanceMovementComponent* Component : Batch)
+        {
+            Component->UpdateMovementLogic(Component->ConsumeBatchedDeltaTime());
+        }
+    }
+}
+
+void FAdvanceMovementBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    // Each component brings its own delta (time dilation, pause); the world delta passed here is not used.
+    if (Subsystem && TickType != LEVELTICK_ViewportsOnly)
+    {
+        Subsystem->TickBatches();
+    }
+}
+
+FString FAdvanceMovementBatchTickFunction::DiagnosticMessage()
+{
+    return TEXT("UAdvanceMovementSubsystem[BatchTick]");
+}
+
+FName FAdvanceMovementBatchTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return FName(TEXT("AdvanceMovementBatchTick"));
+}
+
+#pragma endregion
+
+#pragma region Benchmark
+
+bool UAdvanceMovementSubsystem::StartBenchmark(const FMovementBenchmark::FSettings& Settings)
+{
+    if (Benchmark.IsValid())
+    {
+        return false;
+    }
+
+    Benchmark = MakeUnique<FMovementBenchmark>(Settings);
+    return true;
+}
+
+#pragma endregion
+
+#pragma region Registration
+
+bool UAdvanceMovementSubsystem::IsBatchingEnabled()
+{
+    return GAdvanceMovementBatched != 0;
+}
+
+bool UAdvanceMovementSubsystem::RegisterComponent(UAdvanceMovementComponent* Component)
+{
+    if (!IsValid(Component) || Components.Contains(Component))
+    {
+        return false;
+    }
+
+    SyncBatching();
+    Components.Add(Component);
+
+    if (bBatchingActive)
+    {
+        SetComponentBatched(Component, true);
+    }
+
+    return Component->bMovementBatched;
+}
+
+bool UAdvanceMovementSubsystem::UnregisterComponent(UAdvanceMovementComponent* Component)
+{
+    if (!Component)
+    {
+        return false;
+    }
+
+    SetComponentBatched(Component, false);
+    return Components.RemoveSingleSwap(Component) > 0;
+}
+
+void UAdvanceMovementSubsystem::SyncBatching()
+{
+    const bool bEnabled = IsBatchingEnabled();
+    if (bEnabled == bBatchingActive)
+    {
+        return;
+    }
+
+    bBatchingActive = bEnabled;
+
+    for (UAdvanceMovementComponent* Component : Components)
+    {
+        if (IsValid(Component))
+        {
+            SetComponentBatched(Component, bEnabled);
+        }
+    }
+}
+
+void UAdvanceMovementSubsystem::SetComponentBatched(UAdvanceMovementComponent* Component, bool bBatched)
+{
+    if (Component->bMovementBatched == bBatched)
+    {
+        return;
+    }
+
+    Component->bMovementBatched = bBatched;
+    Component->BatchedDeltaTime = 0.0f;
+
+    if (bBatched)
+    {
+        // The batch ticks in the group of the first component it takes over, after that component's engine movement.
+        if (!BatchTickFunction.IsTickFunctionRegistered())
+        {
+            BatchTickFunction.Subsystem                   = this;
+            BatchTickFunction.bCanEverTick                = true;
+            BatchTickFunction.bTickEvenWhenPaused         = false;
+            BatchTickFunction.bAllowTickOnDedicatedServer = true;
+            BatchTickFunction.TickGroup                   = Component->PrimaryComponentTick.TickGroup;
+            BatchTickFunction.EndTickGroup                = Component->PrimaryComponentTick.EndTickGroup;
+            BatchTickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+        }
+
+        BatchTickFunction.AddPrerequisite(Component, Component->PrimaryComponentTick);
+    }
+    else if (BatchTickFunction.IsTickFunctionRegistered())
+    {
+        BatchTickFunction.RemovePrerequisite(Component, Component->PrimaryComponentTick);
+    }
+}
+
+#pragma endregion
+
+#pragma region Batch
+
+void UAdvanceMovementSubsystem::BuildBatches()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AdvanceMovement_BuildBatches);
+
+    for (TArray<UAdvanceMovementComponent*>& Batch : Batches)
+    {
+        Batch.Reset();
+    }
+
+    for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+    {
+        UAdvanceMovementComponent* Component = Components[Index];
+
+        if (!IsValid(Component))
+        {
+            Components.RemoveAtSwap(Index);
+            continue;
+        }
+
+        // Mirrors the component tick: nothing runs while the component is disabled, paused or between tick intervals.
+        if (!Component->bMovementBatched || !Component->IsComponentTickEnabled() || Component->BatchedDeltaTime <= 0.0f)
+        {
+            continue;
+        }
+
+        const int32 TypeIndex = MovementTypeIndex(Component->MovementData.GetCurrentMovementType());
+        if (!IsValidMovementTypeIndex(TypeIndex))
+        {
+#if DEV_DEBUG_MODE
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("BuildBatches: %s has an invalid movement type, skipped."), *Component->GetName());
+#endif
+            continue;
+        }
+
+        Batches[TypeIndex].Add(Component);
+    }
+
+    INC_DWORD_STAT_BY(STAT_AdvanceMovement_BatchedComponents, Components.Num());
+}
+
+#pragma endregion
+
+#pragma region TraversalAnnotation
+
+void UAdvanceMovementSubsystem::SetTraversalAnnotations(UTraversalAnnotationData* InAnnotations)
+{
+    TraversalAnnotations = InAnnotations;
+
+#if DEV_DEBUG_MODE
+    UE_LOG(LogAdvanceMovement, Log, TEXT("Traversal annotations %s (%d edges)."),
+        InAnnotations ? *InAnnotations->GetName() : TEXT("cleared"),
+        InAnnotations ? InAnnotations->GetNumAnnotations() : 0);
+#endif
+}
+
+#pragma endregion
+
+#pragma region DetectionBudget
+
+void UAdvanceMovementSubsystem::RefreshBudgetFrame()
+{
+    if (BudgetFrame != GFrameCounter)
+    {
+        BudgetFrame = GFrameCounter;
+        SlotsUsed   = 0;
+    }
+}
+
+bool UAdvanceMovementSubsystem::RequestDetectionSlot(EMovementDetectionPriority Priority)
+{
+    RefreshBudgetFrame();
+
+    const int32 Budget = GAdvanceMovementDetectionSlotsPerFrame;
+
+    bool bGranted = true;
+
+    if (Budget > 0 && Priority != EMovementDetectionPriority::Critical)
+    {
+        float Share = 1.0f;
+
+        switch (Priority)
+        {
+        case EMovementDetectionPriority::Low:    Share = GAdvanceMovementDetectionLowShare;    break;
+        case EMovementDetectionPriority::Normal: Share = GAdvanceMovementDetectionNormalShare; break;
+        default:                                 Share = 1.0f;                                 break;
+        }
+
+        bGranted = SlotsUsed < FMath::CeilToInt32(Budget * FMath::Clamp(Share, 0.0f, 1.0f));
+    }
+
+    if (!bGranted)
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_DetectionDeferred);
+        return false;
+    }
+
+    // Player detections are outside the budget, so any number of players never starves the AI of its slots.
+    if (Priority != EMovementDetectionPriority::Critical)
+    {
+        ++SlotsUsed;
+    }
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_DetectionGranted);
+    return true;
+}
+
+#pragma endregion
+
+#pragma region Anchor
+
+int32 UAdvanceMovementSubsystem::RegisterAnchor(const FVector& Location, EMovementAnchorType Types, const UObject* Owner)
+{
+    INC_DWORD_STAT(STAT_AdvanceMovement_RegisteredAnchors);
+    return Anchors.Add(Location, Types, Owner);
+}
+
+void UAdvanceMovementSubsystem::UnregisterAnchor(int32 Handle)
+{
+    if (Anchors.Find(Handle))
+    {
+        DEC_DWORD_STAT(STAT_AdvanceMovement_RegisteredAnchors);
+        Anchors.Remove(Handle);
+    }
+}
+
+void UAdvanceMovementSubsystem::MoveAnchor(int32 Handle, const FVector& NewLocation)
+{
+    Anchors.Move(Handle, NewLocation);
+}
+
+#pragma endregion
@@ -0,0 +1,215 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Character/Component/Movement/MovementData.h"
+#include "Character/Component/Movement/MovementAnchor.h"
+#include "Character/Component/Movement/MovementBenchmark.h"
+#include "AdvanceMovementSubsystem.generated.h"
+
+#pragma region ForwardDecleration
+
+class UAdvanceMovementComponent;
+class UTraversalAnnotationData;
+
+#pragma endregion
+
+#pragma region BatchTickFunction
+
+/**
+ * Tick function of the movement batches. Registered in the tick group of the first batched component and made
+ * dependent on every batched component's own tick, so the batch runs where the per-component movement logic would.
+ */
+USTRUCT()
+struct FAdvanceMovementBatchTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UAdvanceMovementSubsystem* Subsystem = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAdvanceMovementBatchTickFunction> : public TStructOpsTypeTraitsBase2<FAdvanceMovementBatchTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+#pragma endregion
+
+/**
+ * Runs the movement logic of every registered UAdvanceMovementComponent from a single tick function.
+ * Components are grouped by their current EMovementType, so each update handler runs over all characters
+ * in that type back to back instead of being interleaved through the engine's tick graph.
+ *
+ * Opt-in through AdvanceMovement.Batched, which may be toggled at runtime. When disabled, or for components that
+ * never registered, the component keeps running its movement logic from TickComponent.
+ */
+UCLASS()
+class AGEOFREVERSE_API UAdvanceMovementSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+#pragma region ClassCycle
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override;
+
+#pragma endregion
+
+#pragma region Registration
+
+private:
+    // Every registered component; batched while AdvanceMovement.Batched is on
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UAdvanceMovementComponent>> Components;
+
+    // Value of AdvanceMovement.Batched the registered components were last set to
+    bool bBatchingActive = false;
+
+    // Moves every registered component to the batched or the per-component path when AdvanceMovement.Batched changed.
+    void SyncBatching();
+
+    // Moves one component to the batched or the per-component path and keeps the batch tick's prerequisites in step.
+    void SetComponentBatched(UAdvanceMovementComponent* Component, bool bBatched);
+
+public:
+    // Registers the component and takes over its movement logic while batching is enabled. Returns true if it is batched now.
+    bool RegisterComponent(UAdvanceMovementComponent* Component);
+
+    // Hands the movement logic back to the component's own tick for good. Returns true if the component was registered.
+    bool UnregisterComponent(UAdvanceMovementComponent* Component);
+
+    FORCEINLINE int32 GetNumComponents() const
+    {
+        return Components.Num();
+    }
+
+    // Returns true when new components should be batched (AdvanceMovement.Batched).
+    static bool IsBatchingEnabled();
+
+#pragma endregion
+
+#pragma region Batch
+
+private:
+    friend struct FAdvanceMovementBatchTickFunction;
+
+    FAdvanceMovementBatchTickFunction BatchTickFunction;
+
+    // Components grouped by current movement type, rebuilt every tick. Kept between ticks to reuse the allocations.
+    TArray<UAdvanceMovementComponent*> Batches[MovementTypeCount];
+
+    // Sorts the registered components into Batches, dropping any that were destroyed and any that did not tick this frame.
+    void BuildBatches();
+
+    // Runs the movement logic of every batch, each component with the time its own tick accumulated.
+    void TickBatches();
+
+#pragma endregion
+
+#pragma region TraversalAnnotation
+
+private:
+    // Precomputed edges of the level's static geometry, queried before detection traces
+    UPROPERTY(Transient)
+    TObjectPtr<UTraversalAnnotationData> TraversalAnnotations;
+
+public:
+    // Sets the annotation data for the current level, usually from the level blueprint on BeginPlay. Pass nullptr to trace everything.
+    UFUNCTION(BlueprintCallable, Category = "Movement|Traversal")
+    void SetTraversalAnnotations(UTraversalAnnotationData* InAnnotations);
+
+    FORCEINLINE const UTraversalAnnotationData* GetTraversalAnnotations() const
+    {
+        return TraversalAnnotations;
+    }
+
+#pragma endregion
+
+#pragma region DetectionBudget
+
+private:
+    // Frame the counters below belong to
+    uint64 BudgetFrame = 0;
+
+    // Detection slots granted this frame to non-critical requests
+    int32 SlotsUsed = 0;
+
+    // Starts a new budget frame when the frame counter has moved on.
+    void RefreshBudgetFrame();
+
+public:
+    /**
+     * Asks for one detection slot this frame. Critical requests are always granted and not counted; the rest are granted while the slots
+     * used stay under the share of AdvanceMovement.DetectionBudget.SlotsPerFrame their priority may use, so
+     * low-priority requests that tick early cannot use up the slots of higher-priority ones that tick later.
+     */
+    bool RequestDetectionSlot(EMovementDetectionPriority Priority);
+
+    FORCEINLINE int32 GetDetectionSlotsUsed() const
+    {
+        return SlotsUsed;
+    }
+
+#pragma endregion
+
+#pragma region Anchor
+
+private:
+    // Zipline and grapple anchors of the world. The cell size matches the longest anchor query range.
+    FMovementAnchorHash Anchors;
+
+public:
+    // Adds an anchor and returns its handle for UnregisterAnchor and MoveAnchor.
+    int32 RegisterAnchor(const FVector& Location, EMovementAnchorType Types, const UObject* Owner);
+
+    void UnregisterAnchor(int32 Handle);
+
+    void MoveAnchor(int32 Handle, const FVector& NewLocation);
+
+    // Returns the nearest anchor matching the query, or nullptr. Valid until an anchor is next registered or removed.
+    FORCEINLINE const FMovementAnchor* FindNearestAnchor(const FMovementAnchorQuery& Query) const
+    {
+        return Anchors.FindNearest(Query);
+    }
+
+    FORCEINLINE const FMovementAnchorHash& GetAnchors() const
+    {
+        return Anchors;
+    }
+
+#pragma endregion
+
+#pragma region Benchmark
+
+private:
+    // Movement benchmark in progress, advanced from the subsystem tick; null when none runs
+    TUniquePtr<FMovementBenchmark> Benchmark;
+
+public:
+    // Starts a benchmark run on the next tick. Returns false while another one is still running.
+    bool StartBenchmark(const FMovementBenchmark::FSettings& Settings);
+
+    FORCEINLINE bool IsBenchmarkRunning() const
+    {
+        return Benchmark.IsValid();
+    }
+
+#pragma endregion
+
+};
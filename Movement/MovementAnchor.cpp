@@ -0,0 +1,279 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementAnchor.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+#pragma region Constructor
+
+FMovementAnchorHash::FMovementAnchorHash(float InCellSize)
+: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+#pragma endregion
+
+#pragma region Mutator
+
+FIntVector FMovementAnchorHash::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize),
+        FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+int32 FMovementAnchorHash::Add(const FVector& Location, EMovementAnchorType Type, const UObject* Owner)
+{
+    const int32 Handle = Anchors.Add(FMovementAnchor());
+
+    FMovementAnchor& Anchor = Anchors[Handle];
+    Anchor.Location = Location;
+    Anchor.Cell     = GetCell(Location);
+    Anchor.Owner    = Owner;
+    Anchor.Handle   = Handle;
+    Anchor.Type     = Type;
+
+    Cells.FindOrAdd(Anchor.Cell).Add(Handle);
+    return Handle;
+}
+
+void FMovementAnchorHash::Remove(int32 Handle)
+{
+    if (!Anchors.IsValidIndex(Handle))
+    {
+        return;
+    }
+
+    const FIntVector Cell = Anchors[Handle].Cell;
+
+    if (TArray<int32>* CellHandles = Cells.Find(Cell))
+    {
+        CellHandles->RemoveSingleSwap(Handle, EAllowShrinking::No);
+
+        if (CellHandles->IsEmpty())
+        {
+            Cells.Remove(Cell);
+        }
+    }
+
+    Anchors.RemoveAt(Handle);
+}
+
+void FMovementAnchorHash::Move(int32 Handle, const FVector& NewLocation)
+{
+    if (!Anchors.IsValidIndex(Handle))
+    {
+        return;
+    }
+
+    FMovementAnchor& Anchor = Anchors[Handle];
+    Anchor.Location = NewLocation;
+
+    const FIntVector NewCell = GetCell(NewLocation);
+    if (NewCell == Anchor.Cell)
+    {
+        return;
+    }
+
+    if (TArray<int32>* CellHandles = Cells.Find(Anchor.Cell))
+    {
+        CellHandles->RemoveSingleSwap(Handle, EAllowShrinking::No);
+
+        if (CellHandles->IsEmpty())
+        {
+            Cells.Remove(Anchor.Cell);
+        }
+    }
+
+    Anchor.Cell = NewCell;
+    Cells.FindOrAdd(NewCell).Add(Handle);
+}
+
+void FMovementAnchorHash::Reset(float InCellSize)
+{
+    Anchors.Reset();
+    Cells.Reset();
+
+    if (InCellSize > 0.0f)
+    {
+        CellSize = InCellSize;
+    }
+}
+
+#pragma endregion
+
+#pragma region Query
+
+bool FMovementAnchorHash::Matches(const FMovementAnchor& Anchor, const FMovementAnchorQuery& Query, float& OutDistanceSquared)
+{
+    if (!Anchor.HasAnyType(Query.Types))
+    {
+        return false;
+    }
+
+    const FVector ToAnchor = Anchor.Location - Query.Origin;
+    OutDistanceSquared = ToAnchor.SizeSquared();
+
+    if (OutDistanceSquared > FMath::Square(Query.Range))
+    {
+        return false;
+    }
+
+    // Compares against the cone without normalizing: dot >= cos * |ToAnchor|, squared with the sign kept.
+    const float Dot = FVector::DotProduct(ToAnchor, Query.Direction);
+    const float Threshold = Query.MinCosAngle * FMath::Abs(Query.MinCosAngle) * OutDistanceSquared;
+    return Dot * FMath::Abs(Dot) >= Threshold;
+}
+
+const FMovementAnchor* FMovementAnchorHash::FindNearest(const FMovementAnchorQuery& Query) const
+{
+    if (Cells.IsEmpty() || Query.Range <= 0.0f)
+    {
+        return nullptr;
+    }
+
+    const FIntVector MinCell = GetCell(Query.Origin - FVector(Query.Range));
+    const FIntVector MaxCell = GetCell(Query.Origin + FVector(Query.Range));
+
+    const FMovementAnchor* BestAnchor = nullptr;
+    float BestDistanceSquared = TNumericLimits<float>::Max();
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const TArray<int32>* CellHandles = Cells.Find(FIntVector(X, Y, Z));
+                if (!CellHandles)
+                {
+                    continue;
+                }
+
+                for (const int32 Handle : *CellHandles)
+                {
+                    const FMovementAnchor& Anchor = Anchors[Handle];
+
+                    float DistanceSquared = 0.0f;
+                    if (Matches(Anchor, Query, DistanceSquared) && DistanceSquared < BestDistanceSquared)
+                    {
+                        BestDistanceSquared = DistanceSquared;
+                        BestAnchor = &Anchor;
+                    }
+                }
+            }
+        }
+    }
+
+    return BestAnchor;
+}
+
+const FMovementAnchor* FMovementAnchorHash::FindNearestLinear(const FMovementAnchorQuery& Query) const
+{
+    const FMovementAnchor* BestAnchor = nullptr;
+    float BestDistanceSquared = TNumericLimits<float>::Max();
+
+    for (const FMovementAnchor& Anchor : Anchors)
+    {
+        float DistanceSquared = 0.0f;
+        if (Matches(Anchor, Query, DistanceSquared) && DistanceSquared < BestDistanceSquared)
+        {
+            BestDistanceSquared = DistanceSquared;
+            BestAnchor = &Anchor;
+        }
+    }
+
+    return BestAnchor;
+}
+
+#pragma endregion
+
+#pragma region Benchmark
+
+#if !UE_BUILD_SHIPPING
+
+namespace AdvanceMovementAnchorBenchmark
+{
+    /**
+     * Fills a standalone hash with random anchors and compares nearest-anchor queries against a linear scan.
+     * Also checks that both return the same anchor for every query.
+     * Usage: AdvanceMovement.BenchmarkAnchors [Anchors] [Queries]
+     */
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 AnchorCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+        const int32 QueryCount  = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10000;
+
+        // Roughly a 2 km square map with anchors up to 200 m high.
+        const FVector WorldExtent(100000.0f, 100000.0f, 10000.0f);
+        const float Range = 2500.0f;
+
+        FRandomStream Random(0x41AC);
+        FMovementAnchorHash Hash(Range);
+
+        for (int32 Index = 0; Index < AnchorCount; ++Index)
+        {
+            const FVector Location = Random.VRand() * WorldExtent * Random.FRand();
+            Hash.Add(Location, Random.RandRange(0, 1) ? EMovementAnchorType::Grapple : EMovementAnchorType::Zipline);
+        }
+
+        TArray<FMovementAnchorQuery> Queries;
+        Queries.SetNum(QueryCount);
+
+        for (FMovementAnchorQuery& Query : Queries)
+        {
+            Query.Origin      = Random.VRand() * WorldExtent * Random.FRand();
+            Query.Direction   = Random.VRand();
+            Query.Range       = Range;
+            Query.MinCosAngle = FMath::Cos(FMath::DegreesToRadians(45.0f));
+            Query.Types       = EMovementAnchorType::Grapple;
+        }
+
+        TArray<int32> HashResults;
+        HashResults.SetNumUninitialized(QueryCount);
+
+        const double HashStart = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < QueryCount; ++Index)
+        {
+            const FMovementAnchor* Anchor = Hash.FindNearest(Queries[Index]);
+            HashResults[Index] = Anchor ? Anchor->Handle : INDEX_NONE;
+        }
+        const double HashSeconds = FPlatformTime::Seconds() - HashStart;
+
+        int32 Mismatches = 0;
+        int32 Found = 0;
+
+        const double LinearStart = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < QueryCount; ++Index)
+        {
+            const FMovementAnchor* Anchor = Hash.FindNearestLinear(Queries[Index]);
+            const int32 Handle = Anchor ? Anchor->Handle : INDEX_NONE;
+
+            Found      += Handle != INDEX_NONE ? 1 : 0;
+            Mismatches += Handle != HashResults[Index] ? 1 : 0;
+        }
+        const double LinearSeconds = FPlatformTime::Seconds() - LinearStart;
+
+        UE_LOG(LogAdvanceMovement, Display, TEXT("AdvanceMovement anchors (%d anchors, %d cells, %d queries, %d found): hash %.2f us/query, linear %.2f us/query, %d mismatches"),
+            AnchorCount,
+            Hash.GetNumCells(),
+            QueryCount,
+            Found,
+            (HashSeconds * 1.0e6) / QueryCount,
+            (LinearSeconds * 1.0e6) / QueryCount,
+            Mismatches);
+    }
+
+    static FAutoConsoleCommand Command
+    (
+        TEXT("AdvanceMovement.BenchmarkAnchors"),
+        TEXT("Compares nearest zipline/grapple anchor queries on the spatial hash against a linear scan."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+    );
+}
+
+#endif
+
+#pragma endregion
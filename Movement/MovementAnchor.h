@@ -0,0 +1,147 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "MovementAnchor.generated.h"
+
+#pragma region MovementAnchor
+
+// Movements an anchor point can be used for.
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EMovementAnchorType : uint8
+{
+    None        = 0         UMETA(Hidden),
+    Zipline     = 1 << 0    UMETA(DisplayName = "Zipline"),
+    Grapple     = 1 << 1    UMETA(DisplayName = "Grapple")
+};
+
+ENUM_CLASS_FLAGS(EMovementAnchorType);
+
+// One registered zipline or grapple anchor.
+struct FMovementAnchor
+{
+    // World location the character attaches to
+    FVector Location = FVector::ZeroVector;
+
+    // Hash cell the anchor is stored in
+    FIntVector Cell = FIntVector::ZeroValue;
+
+    // Object that registered the anchor, usually a UMovementAnchorComponent
+    TWeakObjectPtr<const UObject> Owner;
+
+    // Handle returned by FMovementAnchorHash::Add
+    int32 Handle = INDEX_NONE;
+
+    EMovementAnchorType Type = EMovementAnchorType::None;
+
+    FORCEINLINE bool HasAnyType(EMovementAnchorType InTypes) const
+    {
+        return EnumHasAnyFlags(Type, InTypes);
+    }
+};
+
+// Parameters of a nearest-anchor search.
+struct FMovementAnchorQuery
+{
+    // Where the search starts, usually the character's eyes
+    FVector Origin = FVector::ZeroVector;
+
+    // Unit view direction; anchors outside the cone around it are ignored
+    FVector Direction = FVector::ForwardVector;
+
+    float Range = 0.0f;
+
+    // Cosine of the cone half angle; -1 accepts every direction
+    float MinCosAngle = -1.0f;
+
+    EMovementAnchorType Types = EMovementAnchorType::None;
+};
+
+/**
+ * Uniform spatial hash of anchor points, keyed by integer cell coordinates.
+ * A query only visits the cells overlapping its range, so with a cell size at least as large as the longest query range
+ * every search reads 27 cells regardless of how many anchors the world holds.
+ * Not thread-safe; owned and queried on the game thread.
+ */
+class AGEOFREVERSE_API FMovementAnchorHash
+{
+
+#pragma region DataEntry
+
+private:
+    float CellSize;
+
+    // Every anchor, indexed by handle
+    TSparseArray<FMovementAnchor> Anchors;
+
+    // Handles of the anchors in each non-empty cell
+    TMap<FIntVector, TArray<int32>> Cells;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    explicit FMovementAnchorHash(float InCellSize = 2500.0f);
+
+#pragma endregion
+
+#pragma region Mutator
+
+public:
+    // Adds an anchor and returns its handle.
+    int32 Add(const FVector& Location, EMovementAnchorType Type, const UObject* Owner = nullptr);
+
+    // Removes the anchor; ignores handles that are no longer registered.
+    void Remove(int32 Handle);
+
+    // Moves a registered anchor, rehashing it only when it changes cell.
+    void Move(int32 Handle, const FVector& NewLocation);
+
+    // Removes every anchor. Must be empty to change the cell size.
+    void Reset(float InCellSize = 0.0f);
+
+#pragma endregion
+
+#pragma region Query
+
+public:
+    // Returns the nearest anchor that matches the query, or nullptr. Valid until the hash is next modified.
+    const FMovementAnchor* FindNearest(const FMovementAnchorQuery& Query) const;
+
+    // Same result as FindNearest by scanning every anchor. Reference for validation and benchmarks.
+    const FMovementAnchor* FindNearestLinear(const FMovementAnchorQuery& Query) const;
+
+    FORCEINLINE const FMovementAnchor* Find(int32 Handle) const
+    {
+        return Anchors.IsValidIndex(Handle) ? &Anchors[Handle] : nullptr;
+    }
+
+    FORCEINLINE int32 Num() const
+    {
+        return Anchors.Num();
+    }
+
+    FORCEINLINE int32 GetNumCells() const
+    {
+        return Cells.Num();
+    }
+
+    FORCEINLINE float GetCellSize() const
+    {
+        return CellSize;
+    }
+
+private:
+    FIntVector GetCell(const FVector& Location) const;
+
+    // True when the anchor lies within range and the view cone of the query.
+    static bool Matches(const FMovementAnchor& Anchor, const FMovementAnchorQuery& Query, float& OutDistanceSquared);
+
+#pragma endregion
+
+};
+
+#pragma endregion
@@ -0,0 +1,72 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementAnchorComponent.h"
+#include "Character/Component/Movement/AdvanceMovementSubsystem.h"
+#include "Engine/World.h"
+
+#pragma region Constructor
+
+UMovementAnchorComponent::UMovementAnchorComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+#pragma endregion
+
+#pragma region ClassCycle
+
+void UMovementAnchorComponent::BeginPlay()
+{
+    Super::BeginPlay();
+    SetAnchorEnabled(true);
+}
+
+void UMovementAnchorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    SetAnchorEnabled(false);
+    Super::EndPlay(EndPlayReason);
+}
+
+void UMovementAnchorComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+    // Static anchors never get here after BeginPlay; moving ones keep their hash entry current.
+    if (IsAnchorRegistered())
+    {
+        if (UAdvanceMovementSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr)
+        {
+            Subsystem->MoveAnchor(AnchorHandle, GetComponentLocation());
+        }
+    }
+}
+
+#pragma endregion
+
+#pragma region Accessor
+
+void UMovementAnchorComponent::SetAnchorEnabled(bool bEnabled)
+{
+    if (bEnabled == IsAnchorRegistered())
+    {
+        return;
+    }
+
+    UAdvanceMovementSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr;
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    if (bEnabled)
+    {
+        AnchorHandle = Subsystem->RegisterAnchor(GetComponentLocation(), GetAnchorTypes(), this);
+    }
+    else
+    {
+        Subsystem->UnregisterAnchor(AnchorHandle);
+        AnchorHandle = INDEX_NONE;
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,65 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Character/Component/Movement/MovementAnchor.h"
+#include "MovementAnchorComponent.generated.h"
+
+/**
+ * Marks a zipline or grapple attach point. Registers its location with UAdvanceMovementSubsystem while in play,
+ * so DetectZipline and DetectGrappling can find it without scanning the level.
+ */
+UCLASS(ClassGroup = (Movement), meta = (BlueprintSpawnableComponent))
+class AGEOFREVERSE_API UMovementAnchorComponent : public USceneComponent
+{
+    GENERATED_BODY()
+
+#pragma region Settings
+
+private:
+    UPROPERTY(EditAnywhere, Category = "Anchor", meta = (Bitmask, BitmaskEnum = "/Script/AgeOfReverse.EMovementAnchorType"))
+    uint8 AnchorTypes = static_cast<uint8>(EMovementAnchorType::Grapple);
+
+    // Handle in the subsystem's anchor hash; INDEX_NONE while not registered
+    int32 AnchorHandle = INDEX_NONE;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    UMovementAnchorComponent();
+
+#pragma endregion
+
+#pragma region ClassCycle
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
+#pragma endregion
+
+#pragma region Accessor
+
+public:
+    FORCEINLINE EMovementAnchorType GetAnchorTypes() const
+    {
+        return static_cast<EMovementAnchorType>(AnchorTypes);
+    }
+
+    FORCEINLINE bool IsAnchorRegistered() const
+    {
+        return AnchorHandle != INDEX_NONE;
+    }
+
+    // Enables or disables the anchor at runtime, e.g. when a zipline is cut.
+    UFUNCTION(BlueprintCallable, Category = "Anchor")
+    void SetAnchorEnabled(bool bEnabled);
+
+#pragma endregion
+
+};
@@ -0,0 +1,528 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementBenchmark.h"
+#include "Character/Component/Movement/AdvanceMovementComponent.h"
+#include "Character/Component/Movement/AdvanceMovementSubsystem.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Algo/Sort.h"
+
+#pragma region Configuration
+
+static FString GAdvanceMovementBenchmarkCharacterClass;
+static FAutoConsoleVariableRef CVarAdvanceMovementBenchmarkCharacterClass
+(
+    TEXT("AdvanceMovement.Benchmark.CharacterClass"),
+    GAdvanceMovementBenchmarkCharacterClass,
+    TEXT("Class path of the character the benchmark spawns. Empty uses the game mode's default pawn class."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementBenchmarkOriginZ = 20000.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementBenchmarkOriginZ
+(
+    TEXT("AdvanceMovement.Benchmark.OriginZ"),
+    GAdvanceMovementBenchmarkOriginZ,
+    TEXT("Height the benchmark geometry is built at, clear of the loaded map."),
+    ECVF_Default
+);
+
+#pragma endregion
+
+#pragma region Layout
+
+namespace MovementBenchmarkLayout
+{
+    // Distance between characters in the grid; each row walks into a wall half a cell ahead
+    static constexpr float Spacing = 400.0f;
+
+    // Alternating wall heights: within vault range, then only reachable by hang or mantle
+    static constexpr float VaultWallHeight = 90.0f;
+    static constexpr float HangWallHeight  = 220.0f;
+    static constexpr float WallThickness   = 20.0f;
+
+    // Edge length of /Engine/BasicShapes/Cube
+    static constexpr float CubeSize = 100.0f;
+}
+
+#pragma endregion
+
+#pragma region Constructor
+
+FMovementBenchmark* FMovementBenchmark::Collecting = nullptr;
+
+FMovementBenchmark::FMovementBenchmark(const FSettings& InSettings)
+: Settings(InSettings)
+{
+    Settings.Counts.RemoveAll([](int32 Count) { return Count <= 0; });
+    Algo::Sort(Settings.Counts);
+
+    if (Settings.Counts.IsEmpty())
+    {
+        Settings.Counts = { 1, 100, 1000 };
+    }
+
+    Settings.Frames       = FMath::Max(1, Settings.Frames);
+    Settings.WarmupFrames = FMath::Max(1, Settings.WarmupFrames);
+
+    if (Settings.ReportName.IsEmpty())
+    {
+        Settings.ReportName = FString::Printf(TEXT("MovementBenchmark-%s"), *FDateTime::Now().ToString());
+    }
+}
+
+FMovementBenchmark::~FMovementBenchmark()
+{
+    if (Collecting == this)
+    {
+        Collecting = nullptr;
+    }
+}
+
+#pragma endregion
+
+#pragma region Run
+
+bool FMovementBenchmark::Tick(UWorld* World)
+{
+    if (!World)
+    {
+        return false;
+    }
+
+    if (!bInitialized)
+    {
+        bInitialized = true;
+
+        if (!Initialize(World) || !BeginPhase(World))
+        {
+            Finish(World);
+            return false;
+        }
+
+        DriveCharacters();
+        return true;
+    }
+
+    ++PhaseFrame;
+
+    if (PhaseFrame == Settings.WarmupFrames)
+    {
+        BeginMeasure();
+    }
+    else if (PhaseFrame == Settings.WarmupFrames + Settings.Frames)
+    {
+        EndPhase();
+
+        if (!NextPhase() || !BeginPhase(World))
+        {
+            Finish(World);
+            return false;
+        }
+    }
+
+    DriveCharacters();
+    return true;
+}
+
+bool FMovementBenchmark::Initialize(UWorld* World)
+{
+    using namespace MovementBenchmarkLayout;
+
+    UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+    if (!Cube)
+    {
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Movement benchmark: cannot load the engine cube mesh."));
+        return false;
+    }
+
+    const int32 Side     = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Settings.Counts.Last())));
+    const float Extent   = Side * Spacing;
+    const FVector Origin = FVector(0.0f, 0.0f, GAdvanceMovementBenchmarkOriginZ);
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    auto SpawnBox = [&](const FVector& Center, const FVector& Size)
+    {
+        AStaticMeshActor* Box = World->SpawnActor<AStaticMeshActor>(Center, FRotator::ZeroRotator, Params);
+        if (Box)
+        {
+            Box->SetMobility(EComponentMobility::Movable);
+            Box->GetStaticMeshComponent()->SetStaticMesh(Cube);
+            Box->SetActorScale3D(Size / CubeSize);
+            Geometry.Add(Box);
+        }
+    };
+
+    // Floor with its top at the origin, covering the grid and the walls of the last row.
+    const FVector Center = Origin + FVector((Extent - Spacing) * 0.5f, (Extent - Spacing) * 0.5f, -WallThickness * 0.5f);
+    SpawnBox(Center, FVector(Extent + Spacing, Extent + Spacing, WallThickness));
+
+    // One wall across the grid half a cell ahead of every row.
+    for (int32 Row = 0; Row < Side; ++Row)
+    {
+        const float Height = (Row % 2 == 0) ? VaultWallHeight : HangWallHeight;
+        const FVector WallCenter = Origin + FVector(Row * Spacing + Spacing * 0.5f, (Extent - Spacing) * 0.5f, Height * 0.5f);
+
+        SpawnBox(WallCenter, FVector(WallThickness, Extent, Height));
+    }
+
+    StartLocations.Reset(Side * Side);
+    for (int32 Index = 0; Index < Side * Side; ++Index)
+    {
+        StartLocations.Add(Origin + FVector((Index / Side) * Spacing, (Index % Side) * Spacing, 0.0f));
+    }
+
+    UE_LOG(LogAdvanceMovement, Display, TEXT("Movement benchmark: counts %s, %d frames per type after %d warmup frames."),
+        *FString::JoinBy(Settings.Counts, TEXT(","), [](int32 Count) { return FString::FromInt(Count); }), Settings.Frames, Settings.WarmupFrames);
+
+    return true;
+}
+
+bool FMovementBenchmark::BeginPhase(UWorld* World)
+{
+    Collecting = nullptr;
+    PhaseFrame = 0;
+
+    for (TArray<uint32>& TypeSamples : Samples)
+    {
+        TypeSamples.Reset();
+    }
+
+    // Spawn up to this run's count; earlier runs' characters stay.
+    const int32 Count = Settings.Counts[CountIndex];
+    if (Characters.Num() < Count)
+    {
+        UClass* CharacterClass = nullptr;
+
+        if (!GAdvanceMovementBenchmarkCharacterClass.IsEmpty())
+        {
+            CharacterClass = LoadClass<ACharacter>(nullptr, *GAdvanceMovementBenchmarkCharacterClass);
+        }
+        else if (const AGameModeBase* GameMode = World->GetAuthGameMode())
+        {
+            CharacterClass = GameMode->DefaultPawnClass;
+        }
+
+        if (!CharacterClass || !CharacterClass->IsChildOf(ACharacter::StaticClass()))
+        {
+            UE_LOG(LogAdvanceMovement, Error, TEXT("Movement benchmark: no character class; set AdvanceMovement.Benchmark.CharacterClass."));
+            return false;
+        }
+
+        FActorSpawnParameters Params;
+        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        UAdvanceMovementSubsystem* Subsystem = World->GetSubsystem<UAdvanceMovementSubsystem>();
+
+        while (Characters.Num() < Count)
+        {
+            ACharacter* Character = World->SpawnActor<ACharacter>(CharacterClass, StartLocations[Characters.Num()], FRotator::ZeroRotator, Params);
+            UAdvanceMovementComponent* Movement = Character ? Cast<UAdvanceMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+
+            if (!Movement)
+            {
+                UE_LOG(LogAdvanceMovement, Error, TEXT("Movement benchmark: %s has no UAdvanceMovementComponent."), *GetNameSafe(CharacterClass));
+
+                if (Character)
+                {
+                    Character->Destroy();
+                }
+
+                return false;
+            }
+
+            // No controller drives these characters, and ticks are only timed as a whole outside the batched path.
+            Movement->bRunPhysicsWithNoController = true;
+
+            if (Subsystem)
+            {
+                Subsystem->UnregisterComponent(Movement);
+            }
+
+            Characters.Add(Character);
+            Components.Add(Movement);
+        }
+    }
+
+    FAdvanceMovementPayload Payload;
+    Payload.Type = GetRequestedType();
+
+    for (int32 Index = 0; Index < Characters.Num(); ++Index)
+    {
+        ACharacter* Character = Characters[Index].Get();
+        UAdvanceMovementComponent* Movement = Character ? Cast<UAdvanceMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+
+        if (!Movement)
+        {
+            UE_LOG(LogAdvanceMovement, Error, TEXT("Movement benchmark: a benchmark character was destroyed."));
+            return false;
+        }
+
+        const FVector Start = StartLocations[Index] + FVector(0.0f, 0.0f, Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+
+        Character->SetActorLocationAndRotation(Start, FRotator::ZeroRotator, false, nullptr, ETeleportType::TeleportPhysics);
+        Movement->Velocity = FVector::ZeroVector;
+
+        Payload.DirectionYaw = 0;
+
+        // Switches the legacy movement state; TickMovement then runs its Tick*Movement function every tick.
+        Movement->ApplyMovementPayload(Payload, EMovementSwitchReason::Forced);
+    }
+
+    return true;
+}
+
+void FMovementBenchmark::BeginMeasure()
+{
+    PhaseProbeQueries = CountProbeQueries();
+    PhaseAllocations  = CountAllocations();
+    Collecting        = this;
+}
+
+void FMovementBenchmark::EndPhase()
+{
+    Collecting = nullptr;
+
+    const int32 Count       = Settings.Counts[CountIndex];
+    const double TotalTicks = FMath::Max(1.0, static_cast<double>(Count) * Settings.Frames);
+    const double Queries    = static_cast<double>(CountProbeQueries() - PhaseProbeQueries);
+    const double Allocs     = static_cast<double>(CountAllocations() - PhaseAllocations);
+
+    TArray<FString> States;
+
+    for (int32 Index = 0; Index < MovementTypeCount; ++Index)
+    {
+        TArray<uint32>& TypeSamples = Samples[Index];
+        if (TypeSamples.IsEmpty())
+        {
+            continue;
+        }
+
+        Algo::Sort(TypeSamples);
+
+        uint64 Sum = 0;
+        for (const uint32 Cycles : TypeSamples)
+        {
+            Sum += Cycles;
+        }
+
+        const int32 P99Index = FMath::Clamp(FMath::CeilToInt(TypeSamples.Num() * 0.99) - 1, 0, TypeSamples.Num() - 1);
+        const EMovementType Type = static_cast<EMovementType>(static_cast<int32>(EMovementType::Idle) + Index);
+
+        States.Add(FString::Printf(TEXT("{\"state\":\"%s\",\"ticks\":%d,\"mean_us\":%.3f,\"p99_us\":%.3f}"),
+            *StaticEnum<EMovementType>()->GetNameStringByValue(static_cast<int64>(Type)),
+            TypeSamples.Num(),
+            FPlatformTime::ToMilliseconds64(Sum) * 1000.0 / TypeSamples.Num(),
+            FPlatformTime::ToMilliseconds64(TypeSamples[P99Index]) * 1000.0));
+    }
+
+    Runs.Add(FString::Printf(TEXT("{\"characters\":%d,\"requested\":\"%s\",\"probe_queries_per_tick\":%.3f,\"allocations_per_tick\":%.3f,\"states\":[%s]}"),
+        Count,
+        *StaticEnum<EMovementType>()->GetNameStringByValue(static_cast<int64>(GetRequestedType())),
+        Queries / TotalTicks,
+        Allocs / TotalTicks,
+        *FString::Join(States, TEXT(","))));
+}
+
+bool FMovementBenchmark::NextPhase()
+{
+    // Types without a movement state (Zipline) have nothing but an empty Update function to time.
+    do
+    {
+        if (++TypeIndex >= MovementTypeCount)
+        {
+            TypeIndex = 0;
+
+            if (++CountIndex >= Settings.Counts.Num())
+            {
+                return false;
+            }
+        }
+    }
+    while (MovementStateFromType(GetRequestedType()) == EMovementState::Off);
+
+    return true;
+}
+
+void FMovementBenchmark::Finish(UWorld* World)
+{
+    Collecting = nullptr;
+
+    for (const TWeakObjectPtr<ACharacter>& Character : Characters)
+    {
+        if (Character.IsValid())
+        {
+            Character->Destroy();
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& Actor : Geometry)
+    {
+        if (Actor.IsValid())
+        {
+            Actor->Destroy();
+        }
+    }
+
+    Characters.Reset();
+    Geometry.Reset();
+    Components.Reset();
+
+    const FString Report = FString::Printf(TEXT("{\"version\":1,\"build\":\"%s\",\"map\":\"%s\",\"frames\":%d,\"warmup_frames\":%d,\"runs\":[\n%s\n]}\n"),
+        FApp::GetBuildVersion(),
+        World ? *World->GetMapName() : TEXT(""),
+        Settings.Frames,
+        Settings.WarmupFrames,
+        *FString::Join(Runs, TEXT(",\n")));
+
+    const FString Filename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MovementBenchmarks"), Settings.ReportName + TEXT(".json"));
+
+    if (FFileHelper::SaveStringToFile(Report, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogAdvanceMovement, Display, TEXT("Movement benchmark: %d runs written to %s"), Runs.Num(), *Filename);
+    }
+    else
+    {
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Movement benchmark: cannot write %s"), *Filename);
+    }
+
+    if (Settings.bQuitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false);
+    }
+}
+
+void FMovementBenchmark::DriveCharacters() const
+{
+    if (GetRequestedType() == EMovementType::Idle)
+    {
+        return;
+    }
+
+    for (const TWeakObjectPtr<ACharacter>& Character : Characters)
+    {
+        if (Character.IsValid())
+        {
+            Character->AddMovementInput(FVector::ForwardVector, 1.0f);
+        }
+    }
+}
+
+uint64 FMovementBenchmark::CountProbeQueries() const
+{
+    uint64 Queries = 0;
+
+    for (const TWeakObjectPtr<ACharacter>& Character : Characters)
+    {
+        if (const UAdvanceMovementComponent* Movement = Character.IsValid() ? Cast<UAdvanceMovementComponent>(Character->GetCharacterMovement()) : nullptr)
+        {
+            Queries += Movement->GetEnvironmentProbes().GetQueryCount();
+        }
+    }
+
+    return Queries;
+}
+
+uint64 FMovementBenchmark::CountAllocations()
+{
+    #if !UE_BUILD_SHIPPING
+    return FMalloc::TotalMallocCalls.load(std::memory_order_relaxed) + FMalloc::TotalReallocCalls.load(std::memory_order_relaxed);
+    #else
+    return 0;
+    #endif
+}
+
+EMovementType FMovementBenchmark::GetRequestedType() const
+{
+    return static_cast<EMovementType>(static_cast<int32>(EMovementType::Idle) + TypeIndex);
+}
+
+#pragma endregion
+
+#pragma region Command
+
+#if !UE_BUILD_SHIPPING
+
+namespace AdvanceMovementBenchmark
+{
+    /**
+     * Starts the movement benchmark in the world the command runs in.
+     * Usage: AdvanceMovement.Benchmark.Run [Counts=1,100,1000] [Frames=120] [ReportName] [quit]
+     */
+    static void Run(const TArray<FString>& Args, UWorld* World)
+    {
+        UAdvanceMovementSubsystem* Subsystem = World ? World->GetSubsystem<UAdvanceMovementSubsystem>() : nullptr;
+        if (!Subsystem)
+        {
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("Movement benchmark: needs a game world."));
+            return;
+        }
+
+        FMovementBenchmark::FSettings Settings;
+        TArray<FString> Positional;
+
+        for (const FString& Arg : Args)
+        {
+            if (Arg.Equals(TEXT("quit"), ESearchCase::IgnoreCase))
+            {
+                Settings.bQuitWhenDone = true;
+            }
+            else
+            {
+                Positional.Add(Arg);
+            }
+        }
+
+        if (Positional.IsValidIndex(0))
+        {
+            TArray<FString> Counts;
+            Positional[0].ParseIntoArray(Counts, TEXT(","));
+
+            for (const FString& Count : Counts)
+            {
+                Settings.Counts.Add(FCString::Atoi(*Count));
+            }
+        }
+
+        if (Positional.IsValidIndex(1))
+        {
+            Settings.Frames = FCString::Atoi(*Positional[1]);
+        }
+
+        if (Positional.IsValidIndex(2))
+        {
+            Settings.ReportName = Positional[2];
+        }
+
+        if (!Subsystem->StartBenchmark(Settings))
+        {
+            UE_LOG(LogAdvanceMovement, Warning, TEXT("Movement benchmark: already running."));
+        }
+    }
+
+    static FAutoConsoleCommandWithWorldAndArgs Command
+    (
+        TEXT("AdvanceMovement.Benchmark.Run"),
+        TEXT("Spawns characters in every movement type and writes per-state tick time, probe and allocation counts as JSON. ")
+        TEXT("Usage: AdvanceMovement.Benchmark.Run [Counts=1,100,1000] [Frames=120] [ReportName] [quit]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run)
+    );
+}
+
+#endif
+
+#pragma endregion
@@ -0,0 +1,156 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Character/Component/Movement/MovementData.h"
+
+#pragma region ForwardDecleration
+
+class ACharacter;
+class AActor;
+class UAdvanceMovementComponent;
+
+#pragma endregion
+
+#pragma region MovementBenchmark
+
+/**
+ * Headless benchmark of the movement state machine, run by UAdvanceMovementSubsystem.
+ *
+ * For every character count it spawns that many characters on generated geometry (a floor with alternating
+ * vault- and hang-height walls ahead of each row), puts them into the movement state of each EMovementType in turn
+ * (types without a state are skipped) so the legacy Tick*Movement functions run, and after a warmup samples the cost
+ * of every tick of the spawned characters for a fixed number of frames. Samples are booked against the state the
+ * character was actually in, so a forced state that exits at once shows up under the state it fell into.
+ *
+ * The report is JSON under Saved/MovementBenchmarks: per requested type and count, per-state tick count, mean and
+ * p99 tick time, probe queries per tick and, outside shipping builds, process-wide allocator calls per tick.
+ *
+ * Typical headless run on an empty map, with a fixed time step so runs are comparable:
+ *   <Project> <Map> -game -nullrhi -unattended -benchmark -fps=60
+ *       -ExecCmds="AdvanceMovement.Benchmark.Run 1,100,1000 120 <ReportName> quit"
+ */
+class AGEOFREVERSE_API FMovementBenchmark
+{
+
+#pragma region DataEntry
+
+public:
+    struct FSettings
+    {
+        // Characters per run, ascending; characters are added between runs, never removed
+        TArray<int32> Counts;
+
+        // Measured frames per requested type, after WarmupFrames unmeasured ones
+        int32 Frames       = 120;
+        int32 WarmupFrames = 10;
+
+        // Report file name without extension; a timestamped one when empty
+        FString ReportName;
+
+        // Exits the process once the report is written
+        bool bQuitWhenDone = false;
+    };
+
+private:
+    FSettings Settings;
+
+    // Spawned characters and geometry, destroyed when the benchmark ends
+    TArray<TWeakObjectPtr<ACharacter>> Characters;
+    TArray<TWeakObjectPtr<AActor>> Geometry;
+
+    // Movement components of Characters; only their ticks are sampled
+    TSet<const UAdvanceMovementComponent*> Components;
+
+    // Start location of each grid slot
+    TArray<FVector> StartLocations;
+
+    bool bInitialized = false;
+    int32 CountIndex  = 0;
+    int32 TypeIndex   = 0;
+    int32 PhaseFrame  = 0;
+
+    // Tick cycles of the current phase, per movement type the character was in
+    TArray<uint32> Samples[MovementTypeCount];
+
+    // Counters at the start of the measured frames
+    uint64 PhaseProbeQueries = 0;
+    uint64 PhaseAllocations  = 0;
+
+    // JSON objects of the finished phases
+    TArray<FString> Runs;
+
+    // Benchmark currently sampling component ticks
+    static FMovementBenchmark* Collecting;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    explicit FMovementBenchmark(const FSettings& InSettings);
+    ~FMovementBenchmark();
+
+    FMovementBenchmark(const FMovementBenchmark&) = delete;
+    FMovementBenchmark& operator=(const FMovementBenchmark&) = delete;
+
+#pragma endregion
+
+#pragma region Run
+
+public:
+    // Advances the benchmark by one frame. Returns false once it has finished and written its report.
+    bool Tick(UWorld* World);
+
+    // True while a benchmark samples component ticks; a single pointer test otherwise.
+    static FORCEINLINE bool IsCollecting()
+    {
+        return Collecting != nullptr;
+    }
+
+    // Books one tick of a benchmark character against the movement type it started in; ticks of other components are ignored.
+    static FORCEINLINE void AddSample(const UAdvanceMovementComponent* Component, EMovementType Type, uint64 Cycles)
+    {
+        const int32 Index = MovementTypeIndex(Type);
+
+        if (Collecting && IsValidMovementTypeIndex(Index) && Collecting->Components.Contains(Component))
+        {
+            Collecting->Samples[Index].Add(static_cast<uint32>(FMath::Min<uint64>(Cycles, MAX_uint32)));
+        }
+    }
+
+private:
+    // Spawns the floor and walls for the largest count.
+    bool Initialize(UWorld* World);
+
+    // Spawns characters up to the current count and puts every one back at its start in the requested type.
+    bool BeginPhase(UWorld* World);
+
+    // Starts sampling after the warmup frames.
+    void BeginMeasure();
+
+    // Turns the phase's samples into a report entry.
+    void EndPhase();
+
+    // Moves on to the next type, then the next count. Returns false when every phase has run.
+    bool NextPhase();
+
+    // Writes the report, removes everything spawned and optionally exits.
+    void Finish(UWorld* World);
+
+    // Feeds forward input so moving types keep moving.
+    void DriveCharacters() const;
+
+    // Sum of probe queries issued by the spawned characters.
+    uint64 CountProbeQueries() const;
+
+    static uint64 CountAllocations();
+
+    EMovementType GetRequestedType() const;
+
+#pragma endregion
+
+};
+
+#pragma endregion
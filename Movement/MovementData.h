@@ -14,6 +14,299 @@ class UParticleSystem;
 
 #pragma endregion
 
+#pragma region MovementType
+
+// Number of movement types laid out densely from EMovementType::Idle to EMovementType::Zipline.
+constexpr int32 MovementTypeCount = static_cast<int32>(EMovementType::Zipline) - static_cast<int32>(EMovementType::Idle) + 1;
+
+// Converts a movement type into its dense index (Idle maps to 0).
+FORCEINLINE constexpr int32 MovementTypeIndex(EMovementType Type)
+{
+    return static_cast<int32>(Type) - static_cast<int32>(EMovementType::Idle);
+}
+
+// Returns true if the index addresses a type inside the dense Idle..Zipline range.
+FORCEINLINE constexpr bool IsValidMovementTypeIndex(int32 Index)
+{
+    return Index >= 0 && Index < MovementTypeCount;
+}
+
+// Returns the movement type that mirrors a movement state, or EMovementType::Null for Off, Locked and other non-movement states.
+FORCEINLINE constexpr EMovementType MovementTypeFromState(EMovementState State)
+{
+    switch (State)
+    {
+    case EMovementState::Idle:            return EMovementType::Idle;
+    case EMovementState::Walk:            return EMovementType::Walk;
+    case EMovementState::Run:             return EMovementType::Run;
+    case EMovementState::Sprint:          return EMovementType::Sprint;
+    case EMovementState::Crouch:          return EMovementType::Crouch;
+    case EMovementState::Prone:           return EMovementType::Prone;
+    case EMovementState::Crawl:           return EMovementType::Crawl;
+    case EMovementState::Fall:            return EMovementType::Fall;
+    case EMovementState::Jump:            return EMovementType::Jump;
+    case EMovementState::Slide:           return EMovementType::Slide;
+    case EMovementState::Roll:            return EMovementType::Roll;
+    case EMovementState::WallRun:         return EMovementType::WallRun;
+    case EMovementState::VerticalWallRun: return EMovementType::VerticalWallRun;
+    case EMovementState::Hang:            return EMovementType::Hang;
+    case EMovementState::Dash:            return EMovementType::Dash;
+    case EMovementState::Teleport:        return EMovementType::Teleport;
+    case EMovementState::Vault:           return EMovementType::Vault;
+    case EMovementState::Mantle:          return EMovementType::Mantle;
+    case EMovementState::Glide:           return EMovementType::Glide;
+    case EMovementState::Swim:            return EMovementType::Swim;
+    case EMovementState::Dive:            return EMovementType::Dive;
+    case EMovementState::Hover:           return EMovementType::Hover;
+    case EMovementState::Fly:             return EMovementType::Fly;
+    case EMovementState::Grappling:       return EMovementType::Grappling;
+    default:                              return EMovementType::Null;
+    }
+}
+
+// Returns the movement state a movement type is driven by, or EMovementState::Off for types without one (Zipline).
+FORCEINLINE constexpr EMovementState MovementStateFromType(EMovementType Type)
+{
+    switch (Type)
+    {
+    case EMovementType::Idle:            return EMovementState::Idle;
+    case EMovementType::Walk:            return EMovementState::Walk;
+    case EMovementType::Run:             return EMovementState::Run;
+    case EMovementType::Sprint:          return EMovementState::Sprint;
+    case EMovementType::Crouch:          return EMovementState::Crouch;
+    case EMovementType::Prone:           return EMovementState::Prone;
+    case EMovementType::Crawl:           return EMovementState::Crawl;
+    case EMovementType::Fall:            return EMovementState::Fall;
+    case EMovementType::Jump:            return EMovementState::Jump;
+    case EMovementType::Slide:           return EMovementState::Slide;
+    case EMovementType::Roll:            return EMovementState::Roll;
+    case EMovementType::WallRun:         return EMovementState::WallRun;
+    case EMovementType::VerticalWallRun: return EMovementState::VerticalWallRun;
+    case EMovementType::Hang:            return EMovementState::Hang;
+    case EMovementType::Dash:            return EMovementState::Dash;
+    case EMovementType::Teleport:        return EMovementState::Teleport;
+    case EMovementType::Vault:           return EMovementState::Vault;
+    case EMovementType::Mantle:          return EMovementState::Mantle;
+    case EMovementType::Glide:           return EMovementState::Glide;
+    case EMovementType::Swim:            return EMovementState::Swim;
+    case EMovementType::Dive:            return EMovementState::Dive;
+    case EMovementType::Hover:           return EMovementState::Hover;
+    case EMovementType::Fly:             return EMovementState::Fly;
+    case EMovementType::Grappling:       return EMovementState::Grappling;
+    default:                              return EMovementState::Off;
+    }
+}
+
+#pragma endregion
+
+#pragma region MovementSignal
+
+/**
+ * Inputs a movement transition guard can depend on.
+ * A transition is only re-evaluated on ticks where at least one of the signals it declares has changed.
+ */
+enum class EMovementSignal : uint16
+{
+    None        = 0,
+    Input       = 1 << 0,   // Any player input flag changed
+    Stamina     = 1 << 1,   // Stamina value changed
+    Health      = 1 << 2,   // Health value changed
+    Ground      = 1 << 3,   // Grounded/airborne status changed
+    Water       = 1 << 4,   // Entered or left water
+    Ability     = 1 << 5,   // An ability was locked or unlocked (raised through NotifyMovementSignal)
+    Environment = 1 << 6,   // Character moved, so walls, ledges and floor distance may differ
+    State       = 1 << 7,   // Movement state changed this tick; every outgoing transition is checked once
+    Progress    = 1 << 8,   // Source state advances its own timer or phase every tick
+
+    All         = 0x01FF
+};
+
+ENUM_CLASS_FLAGS(EMovementSignal);
+
+// Signal sets shared by transitions into the same group of target states.
+namespace TransitionSignal
+{
+    // Idle, Walk, Run
+    constexpr EMovementSignal Locomotion = EMovementSignal::Input | EMovementSignal::Ground;
+
+    // Sprint, Crouch, Prone, Jump, Slide, Roll, Dash
+    constexpr EMovementSignal Stance     = EMovementSignal::Input | EMovementSignal::Stamina | EMovementSignal::Ability;
+
+    // Crawl
+    constexpr EMovementSignal Injury     = EMovementSignal::Health;
+
+    // Fall
+    constexpr EMovementSignal Airborne   = EMovementSignal::Ground | EMovementSignal::Environment;
+
+    // Vault, Mantle, Hang, WallRun, VerticalWallRun, Glide
+    constexpr EMovementSignal Traversal  = EMovementSignal::Input | EMovementSignal::Stamina | EMovementSignal::Ability | EMovementSignal::Environment;
+
+    // Swim, Dive
+    constexpr EMovementSignal Aquatic    = EMovementSignal::Water;
+}
+
+// Player input flags the transition guards read, one bit each in FMovementInputBits.
+enum class EMovementInput : uint8
+{
+    AnyMovementInputActive,
+    MovementInputsInActive,
+    WalkPressed,
+    WalkHeld,
+    WalkInActive,
+    SprintPressed,
+    SprintHeld,
+    SprintReleased,
+    SprintInActive,
+    CrouchPressed,
+    CrouchHeld,
+    CrouchReleased,
+    CrouchInActive,
+    PronePressed,
+    ProneHeld,
+    ProneReleased,
+    ProneInActive,
+    JumpPressed,
+    JumpHeld,
+    JumpReleased,
+    JumpInActive,
+    SlidePressed,
+    SlideHeld,
+    RollPressed,
+    RollHeld,
+    RollInActive,
+    DashPressed,
+    DashHeld,
+    VaultPressed,
+    VaultHeld,
+    MantlePressed,
+    MantleHeld,
+    HangPressed,
+    HangHeld,
+    HangReleased,
+    GlidePressed,
+    GlideHeld,
+    DivePressed,
+    DiveHeld,
+    MoveForwardPressed,
+    MoveForwardHeld,
+    MoveForwardReleased,
+    MoveForwardInActive,
+    MoveBackwardPressed,
+    MoveBackwardHeld,
+    MoveLeftPressed,
+    MoveLeftHeld,
+    MoveRightPressed,
+    MoveRightHeld,
+
+    Count
+};
+
+static_assert(static_cast<int32>(EMovementInput::Count) <= 64, "EMovementInput must fit in FMovementInputBits::Bits");
+
+/**
+ * Player input flags packed into one word. The component captures them from UPlayerInputCache once per movement tick,
+ * or takes them from a client move on the server or from a replay frame, and the guards read only this copy.
+ * The queries are named like UPlayerInputCache's.
+ */
+struct FMovementInputBits
+{
+    uint64 Bits = 0;
+
+    FORCEINLINE bool Get(EMovementInput Input) const
+    {
+        return ((Bits >> static_cast<uint8>(Input)) & 1) != 0;
+    }
+
+    FORCEINLINE void Set(EMovementInput Input, bool bValue)
+    {
+        const uint64 Mask = uint64(1) << static_cast<uint8>(Input);
+        Bits = bValue ? (Bits | Mask) : (Bits & ~Mask);
+    }
+
+    FORCEINLINE bool AnyMovementInputActive() const   { return Get(EMovementInput::AnyMovementInputActive); }
+    FORCEINLINE bool MovementInputsInActive() const   { return Get(EMovementInput::MovementInputsInActive); }
+    FORCEINLINE bool InputWalkPressed() const         { return Get(EMovementInput::WalkPressed); }
+    FORCEINLINE bool InputWalkHeld() const            { return Get(EMovementInput::WalkHeld); }
+    FORCEINLINE bool InputWalkInActive() const        { return Get(EMovementInput::WalkInActive); }
+    FORCEINLINE bool InputSprintPressed() const       { return Get(EMovementInput::SprintPressed); }
+    FORCEINLINE bool InputSprintHeld() const          { return Get(EMovementInput::SprintHeld); }
+    FORCEINLINE bool InputSprintReleased() const      { return Get(EMovementInput::SprintReleased); }
+    FORCEINLINE bool InputSprintInActive() const      { return Get(EMovementInput::SprintInActive); }
+    FORCEINLINE bool InputCrouchPressed() const       { return Get(EMovementInput::CrouchPressed); }
+    FORCEINLINE bool InputCrouchHeld() const          { return Get(EMovementInput::CrouchHeld); }
+    FORCEINLINE bool InputCrouchReleased() const      { return Get(EMovementInput::CrouchReleased); }
+    FORCEINLINE bool InputCrouchInActive() const      { return Get(EMovementInput::CrouchInActive); }
+    FORCEINLINE bool InputPronePressed() const        { return Get(EMovementInput::PronePressed); }
+    FORCEINLINE bool InputProneHeld() const           { return Get(EMovementInput::ProneHeld); }
+    FORCEINLINE bool InputProneReleased() const       { return Get(EMovementInput::ProneReleased); }
+    FORCEINLINE bool InputProneInActive() const       { return Get(EMovementInput::ProneInActive); }
+    FORCEINLINE bool InputJumpPressed() const         { return Get(EMovementInput::JumpPressed); }
+    FORCEINLINE bool InputJumpHeld() const            { return Get(EMovementInput::JumpHeld); }
+    FORCEINLINE bool InputJumpReleased() const        { return Get(EMovementInput::JumpReleased); }
+    FORCEINLINE bool InputJumpInActive() const        { return Get(EMovementInput::JumpInActive); }
+    FORCEINLINE bool InputSlidePressed() const        { return Get(EMovementInput::SlidePressed); }
+    FORCEINLINE bool InputSlideHeld() const           { return Get(EMovementInput::SlideHeld); }
+    FORCEINLINE bool InputRollPressed() const         { return Get(EMovementInput::RollPressed); }
+    FORCEINLINE bool InputRollHeld() const            { return Get(EMovementInput::RollHeld); }
+    FORCEINLINE bool InputRollInActive() const        { return Get(EMovementInput::RollInActive); }
+    FORCEINLINE bool InputDashPressed() const         { return Get(EMovementInput::DashPressed); }
+    FORCEINLINE bool InputDashHeld() const            { return Get(EMovementInput::DashHeld); }
+    FORCEINLINE bool InputVaultPressed() const        { return Get(EMovementInput::VaultPressed); }
+    FORCEINLINE bool InputVaultHeld() const           { return Get(EMovementInput::VaultHeld); }
+    FORCEINLINE bool InputMantlePressed() const       { return Get(EMovementInput::MantlePressed); }
+    FORCEINLINE bool InputMantleHeld() const          { return Get(EMovementInput::MantleHeld); }
+    FORCEINLINE bool InputHangPressed() const         { return Get(EMovementInput::HangPressed); }
+    FORCEINLINE bool InputHangHeld() const            { return Get(EMovementInput::HangHeld); }
+    FORCEINLINE bool InputHangReleased() const        { return Get(EMovementInput::HangReleased); }
+    FORCEINLINE bool InputGlidePressed() const        { return Get(EMovementInput::GlidePressed); }
+    FORCEINLINE bool InputGlideHeld() const           { return Get(EMovementInput::GlideHeld); }
+    FORCEINLINE bool InputDivePressed() const         { return Get(EMovementInput::DivePressed); }
+    FORCEINLINE bool InputDiveHeld() const            { return Get(EMovementInput::DiveHeld); }
+    FORCEINLINE bool InputMoveForwardPressed() const  { return Get(EMovementInput::MoveForwardPressed); }
+    FORCEINLINE bool InputMoveForwardHeld() const     { return Get(EMovementInput::MoveForwardHeld); }
+    FORCEINLINE bool InputMoveForwardReleased() const { return Get(EMovementInput::MoveForwardReleased); }
+    FORCEINLINE bool InputMoveForwardInActive() const { return Get(EMovementInput::MoveForwardInActive); }
+    FORCEINLINE bool InputMoveBackwardPressed() const { return Get(EMovementInput::MoveBackwardPressed); }
+    FORCEINLINE bool InputMoveBackwardHeld() const    { return Get(EMovementInput::MoveBackwardHeld); }
+    FORCEINLINE bool InputMoveLeftPressed() const     { return Get(EMovementInput::MoveLeftPressed); }
+    FORCEINLINE bool InputMoveLeftHeld() const        { return Get(EMovementInput::MoveLeftHeld); }
+    FORCEINLINE bool InputMoveRightPressed() const    { return Get(EMovementInput::MoveRightPressed); }
+    FORCEINLINE bool InputMoveRightHeld() const       { return Get(EMovementInput::MoveRightHeld); }
+};
+
+/**
+ * Conditions a transition edge can require or exclude.
+ * Grounded/Airborne are filled in by the graph; the rest are computed by the source state's tick.
+ */
+enum class EMovementTransitionContext : uint16
+{
+    None        = 0,
+    Grounded    = 1 << 0,   // CharacterMovement reports walking on a floor
+    Airborne    = 1 << 1,   // Not on a floor
+    Landed      = 1 << 2,   // Touched down after being airborne
+    Descending  = 1 << 3,   // Vertical velocity dropped below the fall threshold
+    Exhausted   = 1 << 4,   // Stamina is depleted
+    Completed   = 1 << 5,   // Source state finished its action (slide ended, teleport arrived)
+    Recovered   = 1 << 6,   // Health is above zero again
+    Drop        = 1 << 7,   // Floor is far enough below to start falling
+};
+
+ENUM_CLASS_FLAGS(EMovementTransitionContext);
+
+// Why a movement switch happened, recorded in the per-character switch history.
+enum class EMovementSwitchReason : uint8
+{
+    Unspecified,
+    Input,          // Player or AI input requested the switch
+    Attribute,      // Stamina or health crossed a threshold
+    Environment,    // Ground, water, walls or ledges changed
+    Completed,      // The previous movement finished on its own
+    Network,        // Applied from a server correction or replicated state
+    Forced          // Gameplay code forced the switch
+};
+
+#pragma endregion
+
 #pragma region MovementAttribute
 
 #pragma region Delegate
@@ -1337,6 +1630,114 @@ public:
 
 #pragma endregion
 
+#pragma region MovementUpdateBudget
+
+// How often a character's movement logic runs, chosen from its relevance to players.
+UENUM(BlueprintType)
+enum class EMovementTickLOD : uint8
+{
+    Full        UMETA(DisplayName = "Full"),       // Every frame, including detection traces
+    Reduced     UMETA(DisplayName = "Reduced"),    // At the module's reduced interval, no detection traces
+    Minimal     UMETA(DisplayName = "Minimal")     // At the module's minimal interval, no detection traces
+};
+
+// Per movement type limits on how far its update rate may drop for distant or unseen characters.
+USTRUCT(BlueprintType)
+struct FMovementUpdateBudget
+{
+    GENERATED_BODY()
+
+#pragma region DataEntry
+
+private:
+    // If false the movement always updates every frame, whatever the character's LOD
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
+    bool bAllowReducedRate;
+
+    // Seconds between updates at EMovementTickLOD::Reduced
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+    float ReducedInterval;
+
+    // Seconds between updates at EMovementTickLOD::Minimal
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+    float MinimalInterval;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    FMovementUpdateBudget()
+    : bAllowReducedRate(true)
+    , ReducedInterval(0.1f)
+    , MinimalInterval(0.25f)
+    {
+    }
+
+    FMovementUpdateBudget(bool bInAllowReducedRate, float InReducedInterval, float InMinimalInterval)
+    : bAllowReducedRate(bInAllowReducedRate)
+    , ReducedInterval(InReducedInterval)
+    , MinimalInterval(InMinimalInterval)
+    {
+    }
+
+#pragma endregion
+
+#pragma region Operator
+
+    bool operator==(const FMovementUpdateBudget& Other) const
+    {
+        return
+            bAllowReducedRate == Other.bAllowReducedRate &&
+            ReducedInterval == Other.ReducedInterval &&
+            MinimalInterval == Other.MinimalInterval;
+    }
+
+#pragma endregion
+
+#pragma region Accessor
+
+public:
+    FORCEINLINE bool AllowsReducedRate() const { return bAllowReducedRate; }
+    FORCEINLINE float GetReducedInterval() const { return ReducedInterval; }
+    FORCEINLINE float GetMinimalInterval() const { return MinimalInterval; }
+
+    // Returns the seconds between updates for the LOD, or 0 for every frame.
+    FORCEINLINE float GetInterval(EMovementTickLOD LOD) const
+    {
+        if (!bAllowReducedRate)
+        {
+            return 0.0f;
+        }
+
+        switch (LOD)
+        {
+        case EMovementTickLOD::Reduced: return ReducedInterval;
+        case EMovementTickLOD::Minimal: return MinimalInterval;
+        default:                        return 0.0f;
+        }
+    }
+
+#pragma endregion
+
+};
+
+#pragma endregion
+
+#pragma region DetectionBudget
+
+// Order in which detections are served when the world's per-frame detection budget runs short.
+UENUM(BlueprintType)
+enum class EMovementDetectionPriority : uint8
+{
+    Low         UMETA(DisplayName = "Low"),        // Grounded, unseen or distant AI; first to be deferred
+    Normal      UMETA(DisplayName = "Normal"),     // Visible AI close to a player
+    High        UMETA(DisplayName = "High"),       // Airborne AI, where a missed ledge is visible
+    Critical    UMETA(DisplayName = "Critical")    // Player-controlled characters; never deferred
+};
+
+#pragma endregion
+
 #pragma region MovementModule
 
 #pragma region Delegate
@@ -1369,19 +1770,19 @@ struct FMovementModule
 
 private:
     // Current phase of movement logic (e.g., Locked, InProgress, Complete)
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
     EMovementPhase Phase;
 
     // Current movement state (e.g., Walk, Run, Crouch)
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
     EMovementState State;
 
     // Should this movement module update during tick?
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
     EMovementUpdate Update;
 
     // Controls the Physicsal parameters of movement such as speed, forces, damping, and gravity behavior.
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
     FMovementAttribute MovementAttributes;
 
     // Tracks the current progress and runtime state of the movement
@@ -1396,6 +1797,10 @@ private:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
     FMovementCost MovementCost;
 
+    // Limits how far this movement's update rate may drop for distant or unseen characters
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
+    FMovementUpdateBudget UpdateBudget;
+
 #pragma endregion
 
 #pragma region Delegate
@@ -1444,6 +1849,7 @@ public:
     , MovementProgress()
     , MovementFX()
     , MovementCost()
+    , UpdateBudget()
     {
         // Optional: Additional logic if needed
     }
@@ -1477,7 +1883,6 @@ public:
     FORCEINLINE EMovementUpdate GetUpdate() const { return Update; }
 
     FORCEINLINE const FMovementAttribute& GetMovementAttributes() const { return MovementAttributes; }
-    FORCEINLINE FMovementAttribute& GetMovementAttributes() { return MovementAttributes; }
 
     FORCEINLINE const FMovementProgress& GetMovementProgress() const { return MovementProgress; }
     FORCEINLINE FMovementProgress& GetMovementProgress() { return MovementProgress; }
@@ -1488,12 +1893,39 @@ public:
     FORCEINLINE const FMovementCost& GetMovementCost() const { return MovementCost; }
     FORCEINLINE FMovementCost& GetMovementCost() { return MovementCost; }
 
+    FORCEINLINE const FMovementUpdateBudget& GetUpdateBudget() const { return UpdateBudget; }
+
 #pragma endregion
 
 #pragma region Mutator
 
     /* ------------ MUTATORS: PHASE & STATE ------------ */
 
+    /**
+     * Phase, state, update flag, attributes and update budget are mirrored in FMovementModuleState.
+     * Only FCharacterMovement may write them, through SetModulePhase, SetModuleState, SetModuleUpdate,
+     * SetModuleAttributes and SetModuleUpdateBudget, so the hot copy can never drift from the module.
+     */
+    friend struct FCharacterMovement;
+
+private:
+    void SetMovementAttributes(const FMovementAttribute& InAttributes)
+    {
+        MovementAttributes = InAttributes;
+        OnMovementAttributesChanged.Broadcast(MovementAttributes);
+    }
+
+    // Former name of SetMovementAttributes
+    void SetMovementPhysic(const FMovementAttribute& InPhysic)
+    {
+        SetMovementAttributes(InPhysic);
+    }
+
+    void SetUpdateBudget(const FMovementUpdateBudget& InBudget)
+    {
+        UpdateBudget = InBudget;
+    }
+
     void SetMovementPhase(EMovementPhase InPhase)
     {
         if (Phase != InPhase)
@@ -1521,18 +1953,9 @@ public:
         }
     }
 
-
+public:
     /* ------------ MUTATORS: STRUCTS ------------ */
 
-    void SetMovementPhysic(const FMovementAttribute& InPhysic)
-    {
-        if (!(MovementPhysic == InPhysic))
-        {
-            MovementPhysic = InPhysic;
-            OnMovementPhysicsChanged.Broadcast(MovementPhysic);
-        }
-    }
-
     void SetMovementProgress(const FMovementProgress& InProgress)
     {
         if (!(MovementProgress == InProgress))
@@ -1605,6 +2028,142 @@ public:
 
 #pragma endregion
 
+#pragma region MovementModuleState
+
+/**
+ * Per-tick runtime state of one movement module, kept apart from the FX, cost, delegate and configuration
+ * data of FMovementModule so the update loop only touches a few contiguous bytes per type.
+ * FCharacterMovement owns one entry per movement type, parallel to its module array.
+ */
+USTRUCT(BlueprintType)
+struct FMovementModuleState
+{
+    GENERATED_BODY()
+
+#pragma region DataEntry
+
+private:
+    // Runtime copy of the module phase
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    EMovementPhase Phase;
+
+    // Runtime copy of the module state
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    EMovementState State;
+
+    // Runtime copy of the module update flag
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    EMovementUpdate Update;
+
+    // Time accumulated since the last commit, added to FMovementProgress on deactivation
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    float Duration;
+
+    // Cached from FMovementAttribute
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    float DesiredSpeed;
+
+    // Cached from FMovementAttribute
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    float MaximumSpeed;
+
+    // Cached from FMovementAttribute
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    float InterpolationSpeed;
+
+    // Cached from FMovementUpdateBudget: seconds between updates at Reduced LOD, 0 for every frame
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    float ReducedInterval;
+
+    // Cached from FMovementUpdateBudget: seconds between updates at Minimal LOD, 0 for every frame
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    float MinimalInterval;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    FMovementModuleState()
+    : Phase(EMovementPhase::ReadyToAttempt)
+    , State(EMovementState::Locked)
+    , Update(EMovementUpdate::Disabled)
+    , Duration(0.0f)
+    , DesiredSpeed(0.0f)
+    , MaximumSpeed(0.0f)
+    , InterpolationSpeed(0.0f)
+    , ReducedInterval(0.0f)
+    , MinimalInterval(0.0f)
+    {
+    }
+
+    // Builds the hot state from the authored module data.
+    explicit FMovementModuleState(const FMovementModule& Module)
+    : Phase(Module.GetPhase())
+    , State(Module.GetState())
+    , Update(Module.GetUpdate())
+    , Duration(0.0f)
+    , DesiredSpeed(Module.GetMovementAttributes().GetDesiredSpeed())
+    , MaximumSpeed(Module.GetMovementAttributes().GetMaximumSpeed())
+    , InterpolationSpeed(Module.GetMovementAttributes().GetInterpolationSpeed())
+    , ReducedInterval(Module.GetUpdateBudget().GetInterval(EMovementTickLOD::Reduced))
+    , MinimalInterval(Module.GetUpdateBudget().GetInterval(EMovementTickLOD::Minimal))
+    {
+    }
+
+#pragma endregion
+
+#pragma region Accessor
+
+public:
+    FORCEINLINE EMovementPhase GetPhase() const { return Phase; }
+    FORCEINLINE EMovementState GetState() const { return State; }
+    FORCEINLINE EMovementUpdate GetUpdate() const { return Update; }
+
+    FORCEINLINE float GetDuration() const { return Duration; }
+    FORCEINLINE float GetDesiredSpeed() const { return DesiredSpeed; }
+    FORCEINLINE float GetMaximumSpeed() const { return MaximumSpeed; }
+    FORCEINLINE float GetInterpolationSpeed() const { return InterpolationSpeed; }
+
+    // Returns the seconds between updates for the LOD, or 0 for every frame.
+    FORCEINLINE float GetUpdateInterval(EMovementTickLOD LOD) const
+    {
+        return LOD == EMovementTickLOD::Reduced ? ReducedInterval : LOD == EMovementTickLOD::Minimal ? MinimalInterval : 0.0f;
+    }
+
+#pragma endregion
+
+#pragma region Mutator
+
+private:
+    // Written only by FCharacterMovement, together with the module, so both copies stay equal
+    friend struct FCharacterMovement;
+
+    FORCEINLINE void SetPhase(EMovementPhase InPhase) { Phase = InPhase; }
+    FORCEINLINE void SetState(EMovementState InState) { State = InState; }
+    FORCEINLINE void SetUpdate(EMovementUpdate InUpdate) { Update = InUpdate; }
+
+public:
+
+    FORCEINLINE void UpdateDuration(float DeltaTime) { Duration += DeltaTime; }
+    FORCEINLINE void ResetDuration() { Duration = 0.0f; }
+
+#pragma endregion
+
+#pragma region Validate
+
+public:
+    FORCEINLINE bool IsInProgress() const { return Phase == EMovementPhase::InProgress; }
+    FORCEINLINE bool UpdateEnabled() const { return Update == EMovementUpdate::Enabled; }
+    FORCEINLINE bool UpdateDisabled() const { return Update == EMovementUpdate::Disabled; }
+    FORCEINLINE bool Locked() const { return State == EMovementState::Locked; }
+
+#pragma endregion
+
+};
+
+#pragma endregion
+
 #pragma region MovementData
 
 #pragma region Delegate
@@ -1625,9 +2184,25 @@ struct FCharacterMovement
 #pragma region Data-Entry
 
 private:
-    // A mapping of movement types to their respective movement module configurations
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess = "true"))
-    TMap<EMovementType, FMovementModule> MovementModules;
+    /**
+     * Movement module configurations stored densely, one slot per movement type.
+     * Slot N belongs to the type whose MovementTypeIndex() is N, so lookups never hash.
+     * Blueprints may read but not assign the array, so its length always matches MovementTypeCount.
+     */
+    UPROPERTY(EditAnywhere, EditFixedSize, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    TArray<FMovementModule> Modules;
+
+    // Module map saved before the dense array existed; moved into Modules by PostSerialize() and emptied.
+    UPROPERTY()
+    TMap<EMovementType, FMovementModule> MovementModules_DEPRECATED;
+
+    /**
+     * Hot per-tick state of each module, parallel to Modules.
+     * Update handlers read and write this block; FX, cost, delegates and configuration stay in the cold modules.
+     * Never saved; PostSerialize() rebuilds it from the loaded modules.
+     */
+    UPROPERTY(Transient, VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+    TArray<FMovementModuleState> ModuleStates;
 
     /**
      * The previous movement type the character was using before the last change.
@@ -1659,10 +2234,12 @@ public:
 
 public:
     FCharacterMovement()
-    : MovementModules()
+    : Modules()
     , PreviousMovementType(EMovementType::Null)
     , CurrentMovementType(EMovementType::Idle)
     {
+        Modules.SetNum(MovementTypeCount);
+        ModuleStates.SetNum(MovementTypeCount);
         InitializeMovementTypes();
     }
 
@@ -1671,6 +2248,24 @@ public:
 #pragma region ModuleUtility
 
 private:
+    // Stores the module in the slot reserved for its movement type.
+    void AddModule(EMovementType Type, const FMovementModule& Module)
+    {
+        const int32 Index = MovementTypeIndex(Type);
+
+        if (!IsValidMovementTypeIndex(Index))
+        {
+            #if DEV_DEBUG_MODE
+            LOG_ERROR("Attempted to add MovementModule for invalid MovementType.");
+            #endif
+
+            return;
+        }
+
+        Modules[Index] = Module;
+        ModuleStates[Index]    = FMovementModuleState(Module);
+    }
+
     FMovementModule CreateModule
     (
         EMovementPhase Phase = EMovementPhase::Locked,
@@ -1683,10 +2278,10 @@ private:
     )
     {
         FMovementModule Module;
-        Module.SetPhase(Phase);
-        Module.SetState(State);
-        Module.SetUpdate(Update);
-        Module.SetMovementPhysic(Physic);
+        Module.SetMovementPhase(Phase);
+        Module.SetMovementState(State);
+        Module.SetMovementUpdate(Update);
+        Module.SetMovementAttributes(Physic);
         Module.SetMovementProgress(Progress);
         Module.SetMovementFX(FX);
         Module.SetMovementCost(Cost);
@@ -1837,6 +2432,28 @@ private:
         FlyModule();
         GrapplingModule();
         ZiplineModule();
+
+        InitializeUpdateBudgets();
+    }
+
+    // Keeps movements whose physics or ledge/wall detection cannot tolerate a lower update rate at full rate.
+    void InitializeUpdateBudgets()
+    {
+        const FMovementUpdateBudget FullRateBudget(false, 0.0f, 0.0f);
+
+        const EMovementType FullRateTypes[] =
+        {
+            EMovementType::Fall,        EMovementType::Jump,            EMovementType::Slide,
+            EMovementType::Roll,        EMovementType::WallRun,         EMovementType::VerticalWallRun,
+            EMovementType::Hang,        EMovementType::Dash,            EMovementType::Teleport,
+            EMovementType::Vault,       EMovementType::Mantle,          EMovementType::Grappling,
+            EMovementType::Zipline
+        };
+
+        for (const EMovementType Type : FullRateTypes)
+        {
+            SetModuleUpdateBudget(Type, FullRateBudget);
+        }
     }
 
 
@@ -1867,7 +2484,7 @@ private:
 
 
         //-------------  FINAL ADDITION -------------//
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Idle,
             CreateModule
@@ -1925,7 +2542,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Walk,
             CreateModule
@@ -1981,7 +2598,7 @@ private:
 
         //------------- FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Run,
             CreateModule
@@ -2037,7 +2654,7 @@ private:
 
         //------------- FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Sprint,
             CreateModule
@@ -2093,7 +2710,7 @@ private:
         FX.SetExitVFX(nullptr);                         // TODO: small effect when standing up
 
         //------------- FINAL ADDITION -------------//
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Crouch,
             CreateModule
@@ -2149,7 +2766,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Prone,
             CreateModule
@@ -2205,7 +2822,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Crawl,
             CreateModule
@@ -2245,7 +2862,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Fall,
             CreateModule
@@ -2288,7 +2905,7 @@ private:
         FX.SetExitVFX(nullptr);                          // TODO: landing dust or splash
 
         //-------------  FINAL ADDITION -------------//
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Jump,
             CreateModule
@@ -2342,7 +2959,7 @@ private:
         FX.SetExitVFX(nullptr);                          // TODO: slide end puff
 
         //-------------  FINAL ADDITION -------------//
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Slide,
             CreateModule
@@ -2398,7 +3015,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Roll,
             CreateModule
@@ -2454,7 +3071,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::WallRun,
             CreateModule
@@ -2510,7 +3127,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::VerticalWallRun,
             CreateModule
@@ -2557,7 +3174,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Hang,
             CreateModule
@@ -2613,7 +3230,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Dash,
             CreateModule
@@ -2668,7 +3285,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Teleport,
             CreateModule
@@ -2724,7 +3341,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Vault,
             CreateModule
@@ -2780,7 +3397,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Mantle,
             CreateModule
@@ -2837,7 +3454,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Glide,
             CreateModule
@@ -2894,7 +3511,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Swim,
             CreateModule
@@ -2950,7 +3567,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Dive,
             CreateModule
@@ -3006,7 +3623,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Hover,
             CreateModule
@@ -3062,7 +3679,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Fly,
             CreateModule
@@ -3118,7 +3735,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Grappling,
             CreateModule
@@ -3175,7 +3792,7 @@ private:
 
         //-------------  FINAL ADDITION -------------//
 
-        MovementModules.Add
+        AddModule
         (
             EMovementType::Zipline,
             CreateModule
@@ -3196,16 +3813,63 @@ private:
 #pragma region Accessor
 
 public:
-    // Returns modifiable map of movement modules for non-const objects
-    FORCEINLINE TMap<EMovementType, FMovementModule>& GetMovementModules()
+    // Returns a read-only view of the movement modules, indexed by MovementTypeIndex().
+    // Modules are edited through the mutators below, which keep the hot states in step.
+    FORCEINLINE TConstArrayView<FMovementModule> GetMovementModules() const
+    {
+        return Modules;
+    }
+
+    // Returns the module of a movement type, or nullptr if the type is outside Idle..Zipline.
+    FORCEINLINE FMovementModule* FindMovementModule(EMovementType Type)
+    {
+        const int32 Index = MovementTypeIndex(Type);
+        return Modules.IsValidIndex(Index) ? &Modules[Index] : nullptr;
+    }
+
+    // Returns the read-only module of a movement type, or nullptr if the type is outside Idle..Zipline.
+    FORCEINLINE const FMovementModule* FindMovementModule(EMovementType Type) const
+    {
+        const int32 Index = MovementTypeIndex(Type);
+        return Modules.IsValidIndex(Index) ? &Modules[Index] : nullptr;
+    }
+
+    // Returns the hot state of a movement type. The type must be inside Idle..Zipline.
+    FORCEINLINE FMovementModuleState& GetModuleState(EMovementType Type)
+    {
+        const int32 Index = MovementTypeIndex(Type);
+        checkf(ModuleStates.IsValidIndex(Index), TEXT("GetModuleState: movement type %d has no module slot"), static_cast<int32>(Type));
+        return ModuleStates[Index];
+    }
+
+    // Returns the read-only hot state of a movement type. The type must be inside Idle..Zipline.
+    FORCEINLINE const FMovementModuleState& GetModuleState(EMovementType Type) const
+    {
+        const int32 Index = MovementTypeIndex(Type);
+        checkf(ModuleStates.IsValidIndex(Index), TEXT("GetModuleState: movement type %d has no module slot"), static_cast<int32>(Type));
+        return ModuleStates[Index];
+    }
+
+    // Returns the read-only array of hot module states, indexed by MovementTypeIndex().
+    FORCEINLINE const TArray<FMovementModuleState>& GetModuleStates() const
+    {
+        return ModuleStates;
+    }
+
+    // Returns the module of a movement type. The type must be inside Idle..Zipline.
+    FORCEINLINE FMovementModule& GetMovementModule(EMovementType Type)
     {
-        return MovementModules;
+        const int32 Index = MovementTypeIndex(Type);
+        checkf(Modules.IsValidIndex(Index), TEXT("GetMovementModule: movement type %d has no module slot"), static_cast<int32>(Type));
+        return Modules[Index];
     }
 
-    // Returns read-only map of movement modules for const objects
-    FORCEINLINE const TMap<EMovementType, FMovementModule>& GetMovementModules() const
+    // Returns the read-only module of a movement type. The type must be inside Idle..Zipline.
+    FORCEINLINE const FMovementModule& GetMovementModule(EMovementType Type) const
     {
-        return MovementModules;
+        const int32 Index = MovementTypeIndex(Type);
+        checkf(Modules.IsValidIndex(Index), TEXT("GetMovementModule: movement type %d has no module slot"), static_cast<int32>(Type));
+        return Modules[Index];
     }
 
     // Gets the previous movement type of the character.
@@ -3230,7 +3894,9 @@ public:
     // Updates the movement module for a given type if it exists, otherwise logs an error.
     void SetMovementModuleByType(EMovementType MovementType, const FMovementModule& InModule)
     {
-        if (!MovementModules.Contains(MovementType))
+        FMovementModule* Module = FindMovementModule(MovementType);
+
+        if (!Module)
         {
             #if DEV_DEBUG_MODE
             LOG_ERROR("Attempted to set MovementModule for invalid MovementType.");
@@ -3239,10 +3905,65 @@ public:
             return;
         }
 
-        MovementModules[MovementType] = InModule;
+        *Module = InModule;
+        GetModuleState(MovementType) = FMovementModuleState(InModule);
         OnMovementModuleUpdated.Broadcast(MovementType, InModule);
     }
 
+    // Sets the phase on both the hot state and the module, broadcasting the module delegate on change.
+    void SetModulePhase(EMovementType Type, EMovementPhase InPhase)
+    {
+        GetModuleState(Type).SetPhase(InPhase);
+        GetMovementModule(Type).SetMovementPhase(InPhase);
+    }
+
+    // Sets the state on both the hot state and the module, broadcasting the module delegate on change.
+    void SetModuleState(EMovementType Type, EMovementState InState)
+    {
+        GetModuleState(Type).SetState(InState);
+        GetMovementModule(Type).SetMovementState(InState);
+    }
+
+    // Sets the update flag on both the hot state and the module, broadcasting the module delegate on change.
+    void SetModuleUpdate(EMovementType Type, EMovementUpdate InUpdate)
+    {
+        GetModuleState(Type).SetUpdate(InUpdate);
+        GetMovementModule(Type).SetMovementUpdate(InUpdate);
+    }
+
+    // Sets the attributes of a module and refreshes the values the hot state caches from them.
+    void SetModuleAttributes(EMovementType Type, const FMovementAttribute& InAttributes)
+    {
+        GetMovementModule(Type).SetMovementAttributes(InAttributes);
+        RefreshModuleState(Type);
+    }
+
+    // Sets the update budget of a module and refreshes the intervals the hot state caches from it.
+    void SetModuleUpdateBudget(EMovementType Type, const FMovementUpdateBudget& InBudget)
+    {
+        GetMovementModule(Type).SetUpdateBudget(InBudget);
+        RefreshModuleState(Type);
+    }
+
+    // Refreshes the cached attribute values of the hot state after the module attributes were edited.
+    void RefreshModuleState(EMovementType Type)
+    {
+        FMovementModuleState& ModuleState = GetModuleState(Type);
+        const float Duration              = ModuleState.GetDuration();
+
+        ModuleState = FMovementModuleState(GetMovementModule(Type));
+        ModuleState.UpdateDuration(Duration);
+    }
+
+    // Adds the time accumulated in the hot state to the module progress and clears it.
+    void CommitModuleState(EMovementType Type)
+    {
+        FMovementModuleState& ModuleState = GetModuleState(Type);
+
+        GetMovementModule(Type).GetMovementProgress().UpdateDuration(ModuleState.GetDuration());
+        ModuleState.ResetDuration();
+    }
+
     // Sets a new movement type and broadcasts the change event.
     void SetMovementType(EMovementType NewType)
     {
@@ -3276,7 +3997,9 @@ public:
 
     bool UpdateByType(EMovementType Type)
     {
-        if (!MovementModules.Contains(Type))
+        const int32 Index = MovementTypeIndex(Type);
+
+        if (!ModuleStates.IsValidIndex(Index))
         {
             #if DEV_DEBUG_MODE
             LOG_ERROR("");
@@ -3284,7 +4007,7 @@ public:
             return;
         }
 
-        if (!MovementModules[Type].IsInProgress())
+        if (!ModuleStates[Index].IsInProgress())
         {
             return false;
         }
@@ -3306,6 +4029,66 @@ public:
 
 #pragma endregion
 
+#pragma region Serialization
+
+public:
+    /**
+     * Restores the one-slot-per-type layout after loading.
+     * Data saved as the old TMap is moved into its slots, and a saved array whose length no longer matches
+     * MovementTypeCount (types added or removed since) is resized, with new slots taking the default modules.
+     * The hot states are rebuilt from the loaded modules either way.
+     */
+    void PostSerialize(const FArchive& Ar)
+    {
+        if (!Ar.IsLoading())
+        {
+            return;
+        }
+
+        if (Modules.Num() != MovementTypeCount)
+        {
+            const int32 LoadedCount = Modules.Num();
+            const FCharacterMovement Defaults;
+
+            Modules.SetNum(MovementTypeCount);
+
+            for (int32 Index = LoadedCount; Index < MovementTypeCount; ++Index)
+            {
+                Modules[Index] = Defaults.Modules[Index];
+            }
+        }
+
+        for (const TPair<EMovementType, FMovementModule>& Pair : MovementModules_DEPRECATED)
+        {
+            const int32 Index = MovementTypeIndex(Pair.Key);
+
+            if (Modules.IsValidIndex(Index))
+            {
+                Modules[Index] = Pair.Value;
+            }
+        }
+
+        MovementModules_DEPRECATED.Empty();
+
+        ModuleStates.SetNum(MovementTypeCount);
+
+        for (int32 Index = 0; Index < MovementTypeCount; ++Index)
+        {
+            ModuleStates[Index] = FMovementModuleState(Modules[Index]);
+        }
+    }
+
+#pragma endregion
+
+};
+
+template<>
+struct TStructOpsTypeTraits<FCharacterMovement> : public TStructOpsTypeTraitsBase2<FCharacterMovement>
+{
+    enum
+    {
+        WithPostSerialize = true
+    };
 };
 
 #pragma endregion
@@ -0,0 +1,64 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementLog.h"
+#include "Character/Component/Movement/MovementRingBuffer.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region LogCategory
+
+DEFINE_LOG_CATEGORY(LogAdvanceMovement);
+
+#pragma endregion
+
+#pragma region TransitionTrace
+
+int32 GAdvanceMovementTrace = 0;
+
+static FAutoConsoleVariableRef CVarAdvanceMovementTrace
+(
+    TEXT("AdvanceMovement.Trace"),
+    GAdvanceMovementTrace,
+    TEXT("Records every movement state change into a fixed-size ring buffer. Dump it with AdvanceMovement.DumpTrace.\n")
+    TEXT("0: off (default), 1: on"),
+    ECVF_Default
+);
+
+namespace AdvanceMovementTrace
+{
+    // Most recent state changes across all characters
+    static TMovementRingBuffer<FMovementTraceEntry, 1024> Buffer;
+
+    void Record(const UObject* Owner, EMovementState From, EMovementState To)
+    {
+        FMovementTraceEntry Entry;
+        Entry.Frame = GFrameCounter;
+        Entry.Owner = Owner ? Owner->GetFName() : NAME_None;
+        Entry.From  = From;
+        Entry.To    = To;
+
+        Buffer.Push(Entry);
+    }
+
+    void Dump()
+    {
+        UE_LOG(LogAdvanceMovement, Display, TEXT("Movement transition trace: %u entries (%u recorded)"), Buffer.Num(), Buffer.GetTotalPushed());
+
+        Buffer.ForEach([](const FMovementTraceEntry& Entry)
+        {
+            UE_LOG(LogAdvanceMovement, Display, TEXT("  [%llu] %s: %s -> %s"),
+                Entry.Frame,
+                *Entry.Owner.ToString(),
+                *UEnum::GetValueAsString(Entry.From),
+                *UEnum::GetValueAsString(Entry.To));
+        });
+    }
+
+    static FAutoConsoleCommand DumpCommand
+    (
+        TEXT("AdvanceMovement.DumpTrace"),
+        TEXT("Logs the movement transition trace recorded while AdvanceMovement.Trace is enabled."),
+        FConsoleCommandDelegate::CreateStatic(&Dump)
+    );
+}
+
+#pragma endregion
@@ -0,0 +1,69 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementState.h"
+
+#pragma region LogCategory
+
+/**
+ * Highest verbosity compiled into LogAdvanceMovement.
+ * Shipping and dedicated server builds strip everything below Warning, so per-transition logging costs nothing there.
+ */
+#if UE_BUILD_SHIPPING || UE_SERVER
+#define ADVANCE_MOVEMENT_LOG_COMPILE_VERBOSITY Warning
+#else
+#define ADVANCE_MOVEMENT_LOG_COMPILE_VERBOSITY All
+#endif
+
+AGEOFREVERSE_API DECLARE_LOG_CATEGORY_EXTERN(LogAdvanceMovement, Log, ADVANCE_MOVEMENT_LOG_COMPILE_VERBOSITY);
+
+#pragma endregion
+
+#pragma region Stats
+
+// Shared by every advance movement translation unit so the component and its subsystems report under one "stat AdvanceMovement".
+DECLARE_STATS_GROUP(TEXT("AdvanceMovement"), STATGROUP_AdvanceMovement, STATCAT_Advanced);
+
+#pragma endregion
+
+#pragma region TransitionTrace
+
+// One movement state change captured by the global transition trace.
+struct FMovementTraceEntry
+{
+    // Frame the change happened on
+    uint64 Frame = 0;
+
+    // Name of the character that changed state
+    FName Owner;
+
+    // State before and after the change
+    EMovementState From = EMovementState::Idle;
+    EMovementState To   = EMovementState::Idle;
+};
+
+// Non-zero when the transition trace records (AdvanceMovement.Trace).
+extern AGEOFREVERSE_API int32 GAdvanceMovementTrace;
+
+namespace AdvanceMovementTrace
+{
+    // Appends a state change to the global trace. Prefer ADVANCE_MOVEMENT_TRACE, which skips the call when tracing is off.
+    AGEOFREVERSE_API void Record(const UObject* Owner, EMovementState From, EMovementState To);
+
+    // Logs every entry currently held by the trace, oldest first.
+    AGEOFREVERSE_API void Dump();
+}
+
+// Records a state change when AdvanceMovement.Trace is enabled; a single integer test otherwise.
+#define ADVANCE_MOVEMENT_TRACE(Owner, From, To) \
+    do \
+    { \
+        if (GAdvanceMovementTrace) \
+        { \
+            AdvanceMovementTrace::Record(Owner, From, To); \
+        } \
+    } while (0)
+
+#pragma endregion
@@ -0,0 +1,540 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementProbe.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "Character/Component/Movement/MovementReplay.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region Stats
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Probe Async Answers"), STAT_AdvanceMovement_ProbeAsyncAnswers, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Probe Sync Fallbacks"), STAT_AdvanceMovement_ProbeSyncFallbacks, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Probe Async Issued"), STAT_AdvanceMovement_ProbeAsyncIssued, STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Probe Cache Hits"),   STAT_AdvanceMovement_ProbeCacheHits,   STATGROUP_AdvanceMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Probe Cache Misses"), STAT_AdvanceMovement_ProbeCacheMisses, STATGROUP_AdvanceMovement);
+
+#pragma endregion
+
+#pragma region Configuration
+
+static int32 GAdvanceMovementProbeAsync = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementProbeAsync
+(
+    TEXT("AdvanceMovement.Probe.Async"),
+    GAdvanceMovementProbeAsync,
+    TEXT("Issues the per-frame detection traces (ledge, hang, mantle, vault, teleport) asynchronously one frame ahead and answers from the previous frame's results.\n")
+    TEXT("0: synchronous, 1: async with synchronous fallback (default)"),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementProbeForceSync = 0;
+static FAutoConsoleVariableRef CVarAdvanceMovementProbeForceSync
+(
+    TEXT("AdvanceMovement.Probe.ForceSync"),
+    GAdvanceMovementProbeForceSync,
+    TEXT("Forces every detection trace to run synchronously regardless of AdvanceMovement.Probe.Async. Use for tests that need frame-exact results."),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementProbeMaxAge = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementProbeMaxAge
+(
+    TEXT("AdvanceMovement.Probe.MaxAge"),
+    GAdvanceMovementProbeMaxAge,
+    TEXT("Oldest async result, in frames, that may still answer a detection trace."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementProbeTolerance = 4.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementProbeTolerance
+(
+    TEXT("AdvanceMovement.Probe.Tolerance"),
+    GAdvanceMovementProbeTolerance,
+    TEXT("Largest difference in shape between a requested trace and the async one that may answer it, on top of which the\n")
+    TEXT("request may be shifted by as far as the character moves in the result's age (see FMovementProbes::SetMotionTolerance)."),
+    ECVF_Default
+);
+
+static int32 GAdvanceMovementProbeCacheEnabled = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementProbeCacheEnabled
+(
+    TEXT("AdvanceMovement.ProbeCache.Enable"),
+    GAdvanceMovementProbeCacheEnabled,
+    TEXT("Shares detection trace answers between detectors for the rest of the frame.\n")
+    TEXT("0: off, 1: on (default)"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementProbeCacheMinRayLength = 200.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementProbeCacheMinRayLength
+(
+    TEXT("AdvanceMovement.ProbeCache.MinRayLength"),
+    GAdvanceMovementProbeCacheMinRayLength,
+    TEXT("Shortest length a line trace is issued with once another trace site has queried along the same ray, so both can reuse it."),
+    ECVF_Default
+);
+
+#pragma endregion
+
+#pragma region Query
+
+bool FMovementProbes::IsAsyncEnabled()
+{
+    return GAdvanceMovementProbeAsync && !GAdvanceMovementProbeForceSync;
+}
+
+bool FMovementProbes::IsCacheEnabled()
+{
+    return GAdvanceMovementProbeCacheEnabled != 0;
+}
+
+bool FMovementProbes::LineTrace(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End,
+    ECollisionChannel Channel, const FCollisionQueryParams& Params)
+{
+    if (!World)
+    {
+        return false;
+    }
+
+    ++QueryCount;
+
+    bool bHit = false;
+    if (Replay && Replay->PlayProbe(Key, Start, End, bHit, OutHit))
+    {
+        return bHit;
+    }
+
+    bHit = QueryLine(World, Key, OutHit, Start, End, Channel, Params);
+
+    if (Replay && Replay->IsRecording())
+    {
+        Replay->RecordProbe(Key, bHit, OutHit);
+    }
+
+    return bHit;
+}
+
+bool FMovementProbes::QueryLine(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End,
+    ECollisionChannel Channel, const FCollisionQueryParams& Params)
+{
+    const FVector Delta = End - Start;
+    const float Length  = Delta.Size();
+
+    if (!IsCacheEnabled() || Length <= KINDA_SMALL_NUMBER)
+    {
+        return TraceLine(World, Key, OutHit, Start, End, Channel, Params);
+    }
+
+    const FVector Direction = Delta / Length;
+    const uint32 ParamsHash = HashQueryParams(Params);
+
+    RefreshCacheFrame();
+
+    bool bHit = false;
+    if (FindCachedRay(Key, Start, Direction, Length, Channel, ParamsHash, End, bHit, OutHit))
+    {
+        ++CacheHits;
+        INC_DWORD_STAT(STAT_AdvanceMovement_ProbeCacheHits);
+        return bHit;
+    }
+
+    ++CacheMisses;
+    INC_DWORD_STAT(STAT_AdvanceMovement_ProbeCacheMisses);
+
+    // Only a ray another site has queried along is traced further than asked, so both can be answered from one trace.
+    const float TraceLength = SharedRayKeys.Contains(Key) ? FMath::Max(Length, GAdvanceMovementProbeCacheMinRayLength) : Length;
+
+    FCachedRay& Ray = CachedRays.AddDefaulted_GetRef();
+    Ray.Key        = Key;
+    Ray.Start      = Start;
+    Ray.Direction  = Direction;
+    Ray.Length     = TraceLength;
+    Ray.Channel    = Channel;
+    Ray.ParamsHash = ParamsHash;
+    Ray.bHit       = TraceLine(World, Key, Ray.Hit, Start, Start + (Direction * TraceLength), Channel, Params);
+
+    return ClipToSegment(Ray.bHit, Ray.Hit, Start, End, Length, OutHit);
+}
+
+bool FMovementProbes::TraceLine(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End,
+    ECollisionChannel Channel, const FCollisionQueryParams& Params)
+{
+    if (!IsAsyncEnabled() || !IsAsyncProbe(Key))
+    {
+        return World->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+    }
+
+    FSlot& Slot = Slots.FindOrAdd(Key);
+
+    bool bHit = false;
+    if (!TryConsume(World, Slot, Start, End, FVector::ZeroVector, FQuat::Identity, bHit, OutHit))
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_ProbeSyncFallbacks);
+        bHit = World->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+    }
+
+    if (ShouldIssue(Slot))
+    {
+        MarkIssued(Slot, World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, Channel, Params), Start, End, FVector::ZeroVector, FQuat::Identity);
+    }
+
+    return bHit;
+}
+
+bool FMovementProbes::Sweep(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+    ECollisionChannel Channel, const FCollisionShape& Shape, const FCollisionQueryParams& Params)
+{
+    if (!World)
+    {
+        return false;
+    }
+
+    ++QueryCount;
+
+    bool bHit = false;
+    if (Replay && Replay->PlayProbe(Key, Start, End, bHit, OutHit))
+    {
+        return bHit;
+    }
+
+    bHit = QuerySweep(World, Key, OutHit, Start, End, Rotation, Channel, Shape, Params);
+
+    if (Replay && Replay->IsRecording())
+    {
+        Replay->RecordProbe(Key, bHit, OutHit);
+    }
+
+    return bHit;
+}
+
+bool FMovementProbes::SweepByObjectType(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+    const FCollisionObjectQueryParams& ObjectParams, const FCollisionShape& Shape, const FCollisionQueryParams& Params)
+{
+    if (!World)
+    {
+        return false;
+    }
+
+    ++QueryCount;
+
+    bool bHit = false;
+    if (Replay && Replay->PlayProbe(Key, Start, End, bHit, OutHit))
+    {
+        return bHit;
+    }
+
+    bHit = World->SweepSingleByObjectType(OutHit, Start, End, Rotation, ObjectParams, Shape, Params);
+
+    if (Replay && Replay->IsRecording())
+    {
+        Replay->RecordProbe(Key, bHit, OutHit);
+    }
+
+    return bHit;
+}
+
+bool FMovementProbes::QuerySweep(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+    ECollisionChannel Channel, const FCollisionShape& Shape, const FCollisionQueryParams& Params)
+{
+    if (!IsCacheEnabled())
+    {
+        return TraceSweep(World, Key, OutHit, Start, End, Rotation, Channel, Shape, Params);
+    }
+
+    RefreshCacheFrame();
+
+    const FVector ShapeExtent = Shape.GetExtent();
+    const uint32 ParamsHash   = HashQueryParams(Params);
+
+    // Sweeps are only shared when they are the same query.
+    for (const FCachedSweep& Cached : CachedSweeps)
+    {
+        if (Cached.Channel == Channel
+            && Cached.ParamsHash == ParamsHash
+            && Cached.Start.Equals(Start, 0.1f)
+            && Cached.End.Equals(End, 0.1f)
+            && Cached.ShapeExtent.Equals(ShapeExtent, KINDA_SMALL_NUMBER)
+            && Cached.Rotation.Equals(Rotation))
+        {
+            ++CacheHits;
+            INC_DWORD_STAT(STAT_AdvanceMovement_ProbeCacheHits);
+
+            OutHit = Cached.Hit;
+            return Cached.bHit;
+        }
+    }
+
+    ++CacheMisses;
+    INC_DWORD_STAT(STAT_AdvanceMovement_ProbeCacheMisses);
+
+    FCachedSweep& Cached = CachedSweeps.AddDefaulted_GetRef();
+    Cached.Start       = Start;
+    Cached.End         = End;
+    Cached.ShapeExtent = ShapeExtent;
+    Cached.Rotation    = Rotation;
+    Cached.Channel     = Channel;
+    Cached.ParamsHash  = ParamsHash;
+    Cached.bHit        = TraceSweep(World, Key, Cached.Hit, Start, End, Rotation, Channel, Shape, Params);
+
+    OutHit = Cached.Hit;
+    return Cached.bHit;
+}
+
+bool FMovementProbes::TraceSweep(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+    ECollisionChannel Channel, const FCollisionShape& Shape, const FCollisionQueryParams& Params)
+{
+    if (!IsAsyncEnabled() || !IsAsyncProbe(Key))
+    {
+        return World->SweepSingleByChannel(OutHit, Start, End, Rotation, Channel, Shape, Params);
+    }
+
+    FSlot& Slot = Slots.FindOrAdd(Key);
+    const FVector ShapeExtent = Shape.GetExtent();
+
+    bool bHit = false;
+    if (!TryConsume(World, Slot, Start, End, ShapeExtent, Rotation, bHit, OutHit))
+    {
+        INC_DWORD_STAT(STAT_AdvanceMovement_ProbeSyncFallbacks);
+        bHit = World->SweepSingleByChannel(OutHit, Start, End, Rotation, Channel, Shape, Params);
+    }
+
+    if (ShouldIssue(Slot))
+    {
+        MarkIssued(Slot, World->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, Rotation, Channel, Shape, Params), Start, End, ShapeExtent, Rotation);
+    }
+
+    return bHit;
+}
+
+void FMovementProbes::Reset()
+{
+    Slots.Reset();
+    CachedRays.Reset();
+    CachedSweeps.Reset();
+    SharedRayKeys.Reset();
+}
+
+uint32 FMovementProbes::HashQueryParams(const FCollisionQueryParams& Params)
+{
+    uint32 Hash = GetTypeHash(Params.bTraceComplex);
+    Hash = HashCombine(Hash, GetTypeHash(Params.bIgnoreTouches));
+    Hash = HashCombine(Hash, GetTypeHash(Params.bIgnoreBlocks));
+    Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Params.MobilityType)));
+
+    for (const uint32 ActorId : Params.GetIgnoredActors())
+    {
+        Hash = HashCombine(Hash, ActorId);
+    }
+
+    for (const uint32 ComponentId : Params.GetIgnoredComponents())
+    {
+        Hash = HashCombine(Hash, ComponentId);
+    }
+
+    return Hash;
+}
+
+void FMovementProbes::RefreshCacheFrame()
+{
+    if (CacheFrame != GFrameCounter)
+    {
+        CacheFrame = GFrameCounter;
+        CachedRays.Reset();
+        CachedSweeps.Reset();
+    }
+}
+
+bool FMovementProbes::FindCachedRay(uint32 Key, const FVector& Start, const FVector& Direction, float Length, ECollisionChannel Channel, uint32 ParamsHash,
+    const FVector& End, bool& bOutHit, FHitResult& OutHit)
+{
+    for (const FCachedRay& Ray : CachedRays)
+    {
+        if (Ray.Channel != Channel || Ray.ParamsHash != ParamsHash || !Ray.Start.Equals(Start, 0.1f) || FVector::DotProduct(Ray.Direction, Direction) < 0.99999f)
+        {
+            continue;
+        }
+
+        // Another site asks along this ray: from now on both trace it to MinRayLength so either can answer the other.
+        if (Ray.Key != Key)
+        {
+            SharedRayKeys.Add(Ray.Key);
+            SharedRayKeys.Add(Key);
+        }
+
+        // The first blocking hit along a ray does not depend on how far past it the ray goes.
+        if ((Ray.bHit && Ray.Hit.Distance <= Length) || Ray.Length >= Length)
+        {
+            bOutHit = ClipToSegment(Ray.bHit, Ray.Hit, Start, End, Length, OutHit);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FMovementProbes::ClipToSegment(bool bHit, const FHitResult& Hit, const FVector& Start, const FVector& End, float Length, FHitResult& OutHit)
+{
+    if (bHit && Hit.Distance <= Length)
+    {
+        OutHit          = Hit;
+        OutHit.TraceEnd = End;
+        OutHit.Time     = Length > 0.0f ? Hit.Distance / Length : 0.0f;
+        return true;
+    }
+
+    OutHit = FHitResult(Start, End);
+    return false;
+}
+
+bool FMovementProbes::IsAsyncProbe(uint32 Key)
+{
+    switch (static_cast<EMovementProbe>(Key >> 16))
+    {
+    case EMovementProbe::LedgeWall:
+    case EMovementProbe::LedgeTop:
+    case EMovementProbe::LedgeClearance:
+    case EMovementProbe::HangFeet:
+    case EMovementProbe::HangJumpFoot:
+    case EMovementProbe::HangWallRun:
+    case EMovementProbe::MantleVerticalSweep:
+    case EMovementProbe::MantleVerticalCenter:
+    case EMovementProbe::MantleVerticalHead:
+    case EMovementProbe::MantleJumpForward:
+    case EMovementProbe::MantleJumpHead:
+    case EMovementProbe::MantleWallRunSweep:
+    case EMovementProbe::MantleWallRunTop:
+    case EMovementProbe::VaultLedge:
+    case EMovementProbe::TeleportSweep:
+        return true;
+
+    // Width and clearance searches rarely revisit an index, and the ground and wall probes have to be exact.
+    default:
+        return false;
+    }
+}
+
+bool FMovementProbes::ShouldIssue(FSlot& Slot)
+{
+    const bool bQueriedLastFrame = Slot.QueriedFrame + 1 == GFrameCounter;
+    Slot.QueriedFrame = GFrameCounter;
+
+    // A second query on the slot this frame keeps the first one in flight rather than overwriting its handle.
+    if (Slot.Handle.IsValid() && Slot.IssuedFrame == GFrameCounter)
+    {
+        return false;
+    }
+
+    return bQueriedLastFrame;
+}
+
+bool FMovementProbes::TryConsume(UWorld* World, FSlot& Slot, const FVector& Start, const FVector& End, const FVector& ShapeExtent, const FQuat& Rotation,
+    bool& bOutHit, FHitResult& OutHit) const
+{
+    // Read back the query issued on an earlier frame once the async trace has completed.
+    if (Slot.Handle.IsValid() && Slot.IssuedFrame < GFrameCounter)
+    {
+        FTraceDatum Datum;
+        if (World->QueryTraceData(Slot.Handle, Datum))
+        {
+            const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+
+            Slot.bHasResult        = true;
+            Slot.bResultHit        = BlockingHit != nullptr;
+            Slot.ResultHit         = BlockingHit ? *BlockingHit : FHitResult();
+            Slot.ResultStart       = Slot.Start;
+            Slot.ResultEnd         = Slot.End;
+            Slot.ResultShapeExtent = Slot.ShapeExtent;
+            Slot.ResultRotation    = Slot.Rotation;
+            Slot.ResultFrame       = Slot.IssuedFrame;
+        }
+
+        Slot.Handle = FTraceHandle();
+    }
+
+    const uint64 Age = GFrameCounter - Slot.ResultFrame;
+
+    if (!Slot.bHasResult || Age > static_cast<uint64>(FMath::Max(GAdvanceMovementProbeMaxAge, 1)))
+    {
+        return false;
+    }
+
+    // The request must have the same shape and rotation as the stored query; it may be shifted by as far as the character moved since.
+    const FVector Shift        = Start - Slot.ResultStart;
+    const FVector ResultDelta  = Slot.ResultEnd - Slot.ResultStart;
+    const FVector RequestDelta = End - Start;
+    const float MaxShift       = GAdvanceMovementProbeTolerance + (MotionTolerance * Age);
+
+    if (Shift.SizeSquared() > FMath::Square(MaxShift)
+        || !RequestDelta.Equals(ResultDelta, GAdvanceMovementProbeTolerance)
+        || !ShapeExtent.Equals(Slot.ResultShapeExtent, KINDA_SMALL_NUMBER)
+        || !Rotation.Equals(Slot.ResultRotation))
+    {
+        return false;
+    }
+
+    const float RequestLength = RequestDelta.Size();
+    const float ResultLength  = ResultDelta.Size();
+    const FVector Direction   = ResultLength > KINDA_SMALL_NUMBER ? ResultDelta / ResultLength : FVector::ZeroVector;
+
+    // Moves the stored answer along with the request: across the ray the hit slides with it, along the ray it gets
+    // nearer or further. Exact for a surface facing the ray, which is what the detectors probe for.
+    const float Along     = FVector::DotProduct(Shift, Direction);
+    const FVector Across  = Shift - (Direction * Along);
+
+    if (Slot.bResultHit)
+    {
+        const float Distance = Slot.ResultHit.Distance - Along;
+
+        // The request starts at or past the stored hit: the old answer says nothing about it.
+        if (Distance < 0.0f)
+        {
+            return false;
+        }
+
+        if (Distance > RequestLength)
+        {
+            bOutHit = false;
+            OutHit  = FHitResult(Start, End);
+        }
+        else
+        {
+            bOutHit = true;
+            OutHit  = Slot.ResultHit;
+            OutHit.Location    += Across;
+            OutHit.ImpactPoint += Across;
+            OutHit.TraceStart   = Start;
+            OutHit.TraceEnd     = End;
+            OutHit.Distance     = Distance;
+            OutHit.Time         = RequestLength > 0.0f ? Distance / RequestLength : 0.0f;
+        }
+    }
+    else
+    {
+        // A miss only covers the part of the request the stored query reached.
+        if (RequestLength - (ResultLength - Along) > GAdvanceMovementProbeTolerance)
+        {
+            return false;
+        }
+
+        bOutHit = false;
+        OutHit  = FHitResult(Start, End);
+    }
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_ProbeAsyncAnswers);
+    return true;
+}
+
+void FMovementProbes::MarkIssued(FSlot& Slot, const FTraceHandle& Handle, const FVector& Start, const FVector& End, const FVector& ShapeExtent, const FQuat& Rotation)
+{
+    INC_DWORD_STAT(STAT_AdvanceMovement_ProbeAsyncIssued);
+
+    Slot.Handle      = Handle;
+    Slot.Start       = Start;
+    Slot.End         = End;
+    Slot.ShapeExtent = ShapeExtent;
+    Slot.Rotation    = Rotation;
+    Slot.IssuedFrame = GFrameCounter;
+}
+
+#pragma endregion
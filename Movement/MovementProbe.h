@@ -0,0 +1,309 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "CollisionShape.h"
+
+class FMovementReplay;
+
+#pragma region MovementProbe
+
+/**
+ * Trace sites used by the environment detectors. Each site owns one probe slot per index,
+ * so a detector that issues several traces from the same site (scans, bisections) passes a sequence index.
+ */
+enum class EMovementProbe : uint8
+{
+    LedgeWall,
+    LedgeTop,
+    LedgeClearance,
+    LedgeWidth,
+
+    HangFeet,
+    HangJumpFoot,
+    HangWallRun,
+
+    MantleVerticalSweep,
+    MantleVerticalCenter,
+    MantleVerticalHead,
+    MantleJumpForward,
+    MantleJumpHead,
+    MantleWallRunSweep,
+    MantleWallRunTop,
+
+    VaultLedge,
+    VaultWidth,
+    VaultClearance,
+
+    TeleportSweep,
+
+    GrappleSight,
+
+    FrontWallMid,
+    FrontWallTop,
+    FrontWallBottom,
+    WallBase,
+    WallHeight,
+    GroundDistance,
+
+    // Added after the sites above so recorded replay keys keep their values
+    LedgeDynamic,
+};
+
+/**
+ * A climbable edge in front of the character, shared by the hang, mantle and vault detectors.
+ * Heights are measured from the capsule bottom, distances from the capsule center along the wall normal.
+ */
+struct FLedgeInfo
+{
+    // Frame the ledge was detected on
+    uint64 Frame = 0;
+
+    // True when a wall with a standable top was found within reach
+    bool bValid = false;
+
+    // Point on the wall face at the height of the top surface
+    FVector EdgePoint = FVector::ZeroVector;
+
+    // Nearest point on the wall face and its horizontal normal, pointing back at the character
+    FVector WallPoint  = FVector::ZeroVector;
+    FVector WallNormal = FVector::ZeroVector;
+
+    // Horizontal distance from the capsule center to the wall face
+    float WallDistance = 0.0f;
+
+    // Height of the edge above the capsule bottom
+    float Height = 0.0f;
+
+    // Free height above the top surface, capped at the full capsule height
+    float Clearance = 0.0f;
+
+    // Depth of the top surface behind the edge and the last point on it; bHasFarEdge is false when it runs past the probed depth
+    float Width = 0.0f;
+    FVector FarEdgePoint = FVector::ZeroVector;
+    bool bHasFarEdge = false;
+
+    FORCEINLINE bool IsValid() const
+    {
+        return bValid;
+    }
+};
+
+// Builds the slot key of a trace site and its sequence index.
+FORCEINLINE uint32 MakeMovementProbeKey(EMovementProbe Probe, int32 Index = 0)
+{
+    return (static_cast<uint32>(Probe) << 16) | static_cast<uint32>(Index & 0xFFFF);
+}
+
+/**
+ * Environment probes issued through the engine's async trace API one frame ahead.
+ *
+ * Only the per-frame detector sites (ledge, hang, mantle, vault ledge and teleport) go async; the ground and wall
+ * probes and the width and clearance searches are always synchronous. A query on an async site answers from the
+ * query issued last frame for the same slot, provided it is no older than AdvanceMovement.Probe.MaxAge frames,
+ * its shape is within AdvanceMovement.Probe.Tolerance of the request, its rotation matches and it is shifted by no
+ * more than the character can have moved since. The stored hit is moved along with the request. Otherwise the query
+ * runs synchronously, so a detector always gets an answer and behaves exactly as before on the first frame or after a
+ * teleport. The query is issued asynchronously for the next frame only when the slot was also queried on the previous
+ * one, so a key asked once does not pay for a synchronous trace and an async one nobody reads.
+ *
+ * AdvanceMovement.Probe.ForceSync makes every query synchronous, for tests and for comparing behavior.
+ *
+ * While a FMovementReplay is attached, every answer is recorded into it, or during playback taken from it.
+ *
+ * On top of that, every answer is kept for the rest of the frame and shared between detectors. A line trace
+ * along the same ray (same start, direction, channel and query params) is answered from a cached one whenever
+ * the cached ray either hit within the requested length or reached at least as far. Once two trace sites have
+ * queried along the same ray, both trace it to at least AdvanceMovement.ProbeCache.MinRayLength so shorter and
+ * longer queries along it share one trace; every other ray is traced at the requested length.
+ */
+class AGEOFREVERSE_API FMovementProbes
+{
+
+#pragma region DataEntry
+
+private:
+    // One trace site: the async query in flight and the last result read back from it.
+    struct FSlot
+    {
+        // Async query issued for the next frame
+        FTraceHandle Handle;
+
+        // Geometry of the query in flight
+        FVector Start       = FVector::ZeroVector;
+        FVector End         = FVector::ZeroVector;
+        FVector ShapeExtent = FVector::ZeroVector;
+        FQuat Rotation      = FQuat::Identity;
+        uint64 IssuedFrame  = 0;
+
+        // Last frame the slot was queried on, however it was answered
+        uint64 QueriedFrame = 0;
+
+        // Geometry and result of the last completed query
+        FVector ResultStart       = FVector::ZeroVector;
+        FVector ResultEnd         = FVector::ZeroVector;
+        FVector ResultShapeExtent = FVector::ZeroVector;
+        FQuat ResultRotation      = FQuat::Identity;
+        uint64 ResultFrame        = 0;
+        bool bHasResult           = false;
+        bool bResultHit           = false;
+        FHitResult ResultHit;
+    };
+
+    TMap<uint32, FSlot> Slots;
+
+    // A line trace answered this frame.
+    struct FCachedRay
+    {
+        // Slot that traced the ray
+        uint32 Key          = 0;
+        FVector Start       = FVector::ZeroVector;
+        FVector Direction   = FVector::ForwardVector;
+        float Length        = 0.0f;
+        ECollisionChannel Channel = ECC_Visibility;
+        uint32 ParamsHash   = 0;
+        bool bHit           = false;
+        FHitResult Hit;
+    };
+
+    // A sweep answered this frame.
+    struct FCachedSweep
+    {
+        FVector Start       = FVector::ZeroVector;
+        FVector End         = FVector::ZeroVector;
+        FVector ShapeExtent = FVector::ZeroVector;
+        FQuat Rotation      = FQuat::Identity;
+        ECollisionChannel Channel = ECC_Visibility;
+        uint32 ParamsHash   = 0;
+        bool bHit           = false;
+        FHitResult Hit;
+    };
+
+    // Answers given during CacheFrame; cleared when the frame counter moves on
+    TArray<FCachedRay, TInlineAllocator<16>> CachedRays;
+    TArray<FCachedSweep, TInlineAllocator<4>> CachedSweeps;
+    uint64 CacheFrame = 0;
+
+    // Slots whose rays another slot has queried along; only these are traced to AdvanceMovement.ProbeCache.MinRayLength
+    TSet<uint32> SharedRayKeys;
+
+    // Queries answered from, and missing in, the frame cache since creation
+    uint32 CacheHits   = 0;
+    uint32 CacheMisses = 0;
+
+    // Queries asked of this object since creation, however they were answered
+    uint32 QueryCount = 0;
+
+    // Replay recording every answer, or answering queries from a recording; null when no replay runs
+    FMovementReplay* Replay = nullptr;
+
+    // Distance the owner moves per frame; an async result may answer a request shifted by this much per frame of age
+    float MotionTolerance = 0.0f;
+
+#pragma endregion
+
+#pragma region Query
+
+public:
+    // Line trace answered from last frame's async query when still valid, synchronously otherwise.
+    bool LineTrace(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End,
+        ECollisionChannel Channel, const FCollisionQueryParams& Params);
+
+    // Shape sweep answered from last frame's async query when still valid, synchronously otherwise.
+    bool Sweep(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+        ECollisionChannel Channel, const FCollisionShape& Shape, const FCollisionQueryParams& Params);
+
+    // Synchronous sweep against the given object types only, e.g. dynamic objects missing from static annotations.
+    // Goes through the replay but neither the async slots nor the frame cache.
+    bool SweepByObjectType(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+        const FCollisionObjectQueryParams& ObjectParams, const FCollisionShape& Shape, const FCollisionQueryParams& Params);
+
+    // Drops every slot and any query in flight, e.g. after a teleport.
+    void Reset();
+
+    // Routes every answer through the replay, which records it or supplies it from the file. Pass null to detach.
+    FORCEINLINE void SetReplay(FMovementReplay* InReplay)
+    {
+        Replay = InReplay;
+    }
+
+    // Sets how far the owner moves per frame (speed times delta time), so fast movers can still use last frame's results.
+    FORCEINLINE void SetMotionTolerance(float InMotionTolerance)
+    {
+        MotionTolerance = FMath::Max(InMotionTolerance, 0.0f);
+    }
+
+    // Returns true when queries are answered from async results (AdvanceMovement.Probe.Async and not ForceSync).
+    static bool IsAsyncEnabled();
+
+    // Returns true when answers are shared for the rest of the frame (AdvanceMovement.ProbeCache.Enable).
+    static bool IsCacheEnabled();
+
+    FORCEINLINE uint32 GetCacheHits() const
+    {
+        return CacheHits;
+    }
+
+    FORCEINLINE uint32 GetCacheMisses() const
+    {
+        return CacheMisses;
+    }
+
+    FORCEINLINE uint32 GetQueryCount() const
+    {
+        return QueryCount;
+    }
+
+private:
+    // Line trace through the frame cache, without the replay.
+    bool QueryLine(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End,
+        ECollisionChannel Channel, const FCollisionQueryParams& Params);
+
+    // Sweep through the frame cache, without the replay.
+    bool QuerySweep(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+        ECollisionChannel Channel, const FCollisionShape& Shape, const FCollisionQueryParams& Params);
+
+    // Async or synchronous line trace for the slot, without the frame cache.
+    bool TraceLine(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End,
+        ECollisionChannel Channel, const FCollisionQueryParams& Params);
+
+    // Async or synchronous sweep for the slot, without the frame cache.
+    bool TraceSweep(UWorld* World, uint32 Key, FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rotation,
+        ECollisionChannel Channel, const FCollisionShape& Shape, const FCollisionQueryParams& Params);
+
+    // Clears the frame cache when a new frame has started.
+    void RefreshCacheFrame();
+
+    // Answers a line trace from a cached ray along the same line when one covers the requested length.
+    // Marks both slots as sharing the ray when it was traced by a different one.
+    bool FindCachedRay(uint32 Key, const FVector& Start, const FVector& Direction, float Length, ECollisionChannel Channel, uint32 ParamsHash,
+        const FVector& End, bool& bOutHit, FHitResult& OutHit);
+
+    // Hash of everything in the query params that changes what a trace hits: ignored actors and components, complex and touch flags.
+    static uint32 HashQueryParams(const FCollisionQueryParams& Params);
+
+    // Trims a hit along a longer ray to the requested segment; a hit past the segment end becomes a miss.
+    static bool ClipToSegment(bool bHit, const FHitResult& Hit, const FVector& Start, const FVector& End, float Length, FHitResult& OutHit);
+
+    // Reads back the slot's async query if it completed, then tries to answer the request from the stored result,
+    // moved by the offset between the request and the stored query.
+    bool TryConsume(UWorld* World, FSlot& Slot, const FVector& Start, const FVector& End, const FVector& ShapeExtent, const FQuat& Rotation,
+        bool& bOutHit, FHitResult& OutHit) const;
+
+    // True for the trace sites the detectors query every frame; every other site always traces synchronously.
+    static bool IsAsyncProbe(uint32 Key);
+
+    // Marks the slot as queried this frame. Returns true when it should issue an async query for the next one:
+    // it was queried on the previous frame as well and has no query in flight from this frame yet.
+    static bool ShouldIssue(FSlot& Slot);
+
+    // Copies the query geometry into the slot after issuing its async trace.
+    static void MarkIssued(FSlot& Slot, const FTraceHandle& Handle, const FVector& Start, const FVector& End, const FVector& ShapeExtent, const FQuat& Rotation);
+
+#pragma endregion
+
+};
+
+#pragma endregion
@@ -0,0 +1,435 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementReplay.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+#pragma region Configuration
+
+static float GAdvanceMovementReplayDivergenceTolerance = 5.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementReplayDivergenceTolerance
+(
+    TEXT("AdvanceMovement.Replay.DivergenceTolerance"),
+    GAdvanceMovementReplayDivergenceTolerance,
+    TEXT("Distance between the played back and the recorded character location at which a playback frame counts as diverged."),
+    ECVF_Default
+);
+
+#pragma endregion
+
+#pragma region FileFormat
+
+namespace MovementReplayFormat
+{
+    // "AMRP"
+    static constexpr uint32 Magic   = 0x504D5241;
+    static constexpr uint16 Version = 3;
+
+    // Guards against loading a truncated or foreign file into huge arrays
+    static constexpr int32 MaxFrames = 1 << 22;
+    static constexpr int32 MaxProbes = 1 << 24;
+}
+
+FArchive& operator<<(FArchive& Ar, FMovementReplayProbe& Probe)
+{
+    uint8 bHit = Probe.bHit ? 1 : 0;
+
+    Ar << Probe.Key;
+    Ar << bHit;
+
+    Probe.bHit = bHit != 0;
+
+    // Misses carry nothing but the key.
+    if (Probe.bHit)
+    {
+        Ar << Probe.Location;
+        Ar << Probe.ImpactPoint;
+        Ar << Probe.ImpactNormal;
+        Ar << Probe.Time;
+        Ar << Probe.Distance;
+    }
+
+    return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FMovementReplayFrame& Frame)
+{
+    uint8 Type  = static_cast<uint8>(Frame.MovementType);
+    uint8 Flags = static_cast<uint8>(Frame.Flags);
+
+    Ar << Frame.DeltaTime;
+    Ar << Frame.Input[0];
+    Ar << Frame.Input[1];
+    Ar << Frame.Input[2];
+    Ar << Frame.Location;
+    Ar << Frame.Velocity;
+    Ar << Type;
+    Ar << Flags;
+    Ar.SerializeIntPacked64(Frame.InputBits);
+    Ar << Frame.NumProbes;
+
+    Frame.MovementType = static_cast<EMovementType>(Type);
+    Frame.Flags        = static_cast<EMovementReplayFlags>(Flags);
+
+    return Ar;
+}
+
+FVector FMovementReplayFrame::GetInput() const
+{
+    return FVector(Input[0], Input[1], Input[2]) / 127.0;
+}
+
+void FMovementReplayFrame::SetInput(const FVector& InInput)
+{
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Input[Axis] = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(InInput[Axis] * 127.0), -127, 127));
+    }
+}
+
+#pragma endregion
+
+#pragma region Control
+
+void FMovementReplay::StartRecording()
+{
+    Frames.Reset();
+    Probes.Reset();
+
+    FrameIndex           = INDEX_NONE;
+    StartRotation        = FRotator3f::ZeroRotator;
+    StartControlRotation = FRotator3f::ZeroRotator;
+    Mode                 = EMode::Recording;
+}
+
+bool FMovementReplay::StartPlayback()
+{
+    if (Frames.IsEmpty())
+    {
+        return false;
+    }
+
+    FrameIndex       = INDEX_NONE;
+    ProbeCursor      = 0;
+    DivergedFrames   = 0;
+    TypeMismatches   = 0;
+    ProbeMisses      = 0;
+    MaxLocationError = 0.0f;
+
+    ConsumedProbes.Init(false, Probes.Num());
+
+    for (FStateTiming& Timing : StateTimings)
+    {
+        Timing = FStateTiming();
+    }
+
+    Mode = EMode::Playing;
+    return true;
+}
+
+void FMovementReplay::Stop()
+{
+    Mode = EMode::Idle;
+}
+
+FString FMovementReplay::ResolveFilename(const FString& Name)
+{
+    FString Filename = FPaths::IsRelative(Name) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MovementReplays"), Name) : Name;
+
+    if (FPaths::GetExtension(Filename).IsEmpty())
+    {
+        Filename += TEXT(".amr");
+    }
+
+    return Filename;
+}
+
+bool FMovementReplay::Save(const FString& Filename) const
+{
+    TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Filename));
+    if (!Ar)
+    {
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Movement replay: cannot write %s"), *Filename);
+        return false;
+    }
+
+    uint32 Magic   = MovementReplayFormat::Magic;
+    uint16 Version = MovementReplayFormat::Version;
+    int32 FrameCount = Frames.Num();
+    int32 ProbeCount = Probes.Num();
+
+    FRotator3f Rotation        = StartRotation;
+    FRotator3f ControlRotation = StartControlRotation;
+
+    *Ar << Magic;
+    *Ar << Version;
+    *Ar << FrameCount;
+    *Ar << ProbeCount;
+    *Ar << Rotation;
+    *Ar << ControlRotation;
+
+    for (const FMovementReplayFrame& Frame : Frames)
+    {
+        *Ar << const_cast<FMovementReplayFrame&>(Frame);
+    }
+
+    for (const FMovementReplayProbe& Probe : Probes)
+    {
+        *Ar << const_cast<FMovementReplayProbe&>(Probe);
+    }
+
+    return Ar->Close();
+}
+
+bool FMovementReplay::Load(const FString& Filename)
+{
+    TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Filename));
+    if (!Ar)
+    {
+        return false;
+    }
+
+    uint32 Magic   = 0;
+    uint16 Version = 0;
+    int32 FrameCount = 0;
+    int32 ProbeCount = 0;
+
+    *Ar << Magic;
+    *Ar << Version;
+    *Ar << FrameCount;
+    *Ar << ProbeCount;
+
+    if (Magic != MovementReplayFormat::Magic || Version != MovementReplayFormat::Version
+        || FrameCount < 0 || FrameCount > MovementReplayFormat::MaxFrames
+        || ProbeCount < 0 || ProbeCount > MovementReplayFormat::MaxProbes)
+    {
+        UE_LOG(LogAdvanceMovement, Error, TEXT("Movement replay: %s is not a movement replay file"), *Filename);
+        return false;
+    }
+
+    *Ar << StartRotation;
+    *Ar << StartControlRotation;
+
+    Frames.SetNum(FrameCount);
+    Probes.SetNum(ProbeCount);
+
+    // Probe ranges are not stored; they follow from the per-frame counts.
+    int32 FirstProbe = 0;
+    for (FMovementReplayFrame& Frame : Frames)
+    {
+        *Ar << Frame;
+        Frame.FirstProbe = FirstProbe;
+        FirstProbe += Frame.NumProbes;
+    }
+
+    for (FMovementReplayProbe& Probe : Probes)
+    {
+        *Ar << Probe;
+    }
+
+    if (Ar->IsError() || FirstProbe != ProbeCount)
+    {
+        Frames.Reset();
+        Probes.Reset();
+        return false;
+    }
+
+    Mode = EMode::Idle;
+    return true;
+}
+
+#pragma endregion
+
+#pragma region Recording
+
+void FMovementReplay::RecordFrame(float DeltaTime, const FVector& Location, const FVector& Velocity, EMovementType Type, EMovementReplayFlags Flags, uint64 InputBits)
+{
+    FMovementReplayFrame& Frame = Frames.AddDefaulted_GetRef();
+    Frame.DeltaTime    = DeltaTime;
+    Frame.Location     = FVector3f(Location);
+    Frame.Velocity     = FVector3f(Velocity);
+    Frame.MovementType = Type;
+    Frame.Flags        = Flags;
+    Frame.InputBits    = InputBits;
+    Frame.FirstProbe   = Probes.Num();
+
+    FrameIndex = Frames.Num() - 1;
+}
+
+void FMovementReplay::RecordProbe(uint32 Key, bool bHit, const FHitResult& Hit)
+{
+    if (!Frames.IsValidIndex(FrameIndex) || Frames[FrameIndex].NumProbes == MAX_uint16)
+    {
+        return;
+    }
+
+    FMovementReplayProbe& Probe = Probes.AddDefaulted_GetRef();
+    Probe.Key  = Key;
+    Probe.bHit = bHit;
+
+    if (bHit)
+    {
+        Probe.Location     = FVector3f(Hit.Location);
+        Probe.ImpactPoint  = FVector3f(Hit.ImpactPoint);
+        Probe.ImpactNormal = FVector3f(Hit.ImpactNormal);
+        Probe.Time         = Hit.Time;
+        Probe.Distance     = Hit.Distance;
+    }
+
+    ++Frames[FrameIndex].NumProbes;
+}
+
+void FMovementReplay::RecordStartRotation(const FRotator& Rotation, const FRotator& ControlRotation)
+{
+    StartRotation        = FRotator3f(Rotation);
+    StartControlRotation = FRotator3f(ControlRotation);
+}
+
+#pragma endregion
+
+#pragma region Playback
+
+const FMovementReplayFrame* FMovementReplay::AdvanceFrame()
+{
+    if (!IsPlaying() || !Frames.IsValidIndex(FrameIndex + 1))
+    {
+        return nullptr;
+    }
+
+    ++FrameIndex;
+    ProbeCursor = Frames[FrameIndex].FirstProbe;
+
+    return &Frames[FrameIndex];
+}
+
+bool FMovementReplay::PlayProbe(uint32 Key, const FVector& Start, const FVector& End, bool& bOutHit, FHitResult& OutHit)
+{
+    if (!IsPlaying() || !Frames.IsValidIndex(FrameIndex))
+    {
+        return false;
+    }
+
+    const FMovementReplayFrame& Frame = Frames[FrameIndex];
+    const int32 EndProbe = Frame.FirstProbe + Frame.NumProbes;
+
+    for (int32 Index = ProbeCursor; Index < EndProbe; ++Index)
+    {
+        const FMovementReplayProbe& Probe = Probes[Index];
+        if (Probe.Key != Key || ConsumedProbes[Index])
+        {
+            continue;
+        }
+
+        // Consume the answer wherever it was found, then move the cursor past every answer already handed out,
+        // so a stray query neither skips the rest of the frame nor gets an out-of-order answer a second time.
+        ConsumedProbes[Index] = true;
+
+        while (ProbeCursor < EndProbe && ConsumedProbes[ProbeCursor])
+        {
+            ++ProbeCursor;
+        }
+
+        OutHit = FHitResult(Start, End);
+        bOutHit = Probe.bHit;
+
+        if (Probe.bHit)
+        {
+            OutHit.bBlockingHit = true;
+            OutHit.Location     = FVector(Probe.Location);
+            OutHit.ImpactPoint  = FVector(Probe.ImpactPoint);
+            OutHit.ImpactNormal = FVector(Probe.ImpactNormal);
+            OutHit.Normal       = OutHit.ImpactNormal;
+            OutHit.Time         = Probe.Time;
+            OutHit.Distance     = Probe.Distance;
+        }
+
+        return true;
+    }
+
+    ++ProbeMisses;
+    return false;
+}
+
+void FMovementReplay::CompareFrame(const FVector& Location, EMovementType Type)
+{
+    if (!Frames.IsValidIndex(FrameIndex))
+    {
+        return;
+    }
+
+    const FMovementReplayFrame& Frame = Frames[FrameIndex];
+    const float LocationError = FVector::Dist(Location, FVector(Frame.Location));
+
+    MaxLocationError = FMath::Max(MaxLocationError, LocationError);
+
+    if (Type != Frame.MovementType)
+    {
+        ++TypeMismatches;
+    }
+
+    if (Type != Frame.MovementType || LocationError > GAdvanceMovementReplayDivergenceTolerance)
+    {
+        ++DivergedFrames;
+    }
+}
+
+void FMovementReplay::AddTiming(EMovementType Type, uint64 Cycles)
+{
+    const int32 Index = MovementTypeIndex(Type);
+    if (IsValidMovementTypeIndex(Index))
+    {
+        ++StateTimings[Index].Frames;
+        StateTimings[Index].Cycles += Cycles;
+    }
+}
+
+void FMovementReplay::LogReport(const FString& OwnerName) const
+{
+    UE_LOG(LogAdvanceMovement, Display, TEXT("Movement replay %s: %d frames, %d probes, %u diverged frames, %u type mismatches, %u probe misses, max location error %.2f"),
+        *OwnerName, Frames.Num(), Probes.Num(), DivergedFrames, TypeMismatches, ProbeMisses, MaxLocationError);
+
+    for (int32 Index = 0; Index < MovementTypeCount; ++Index)
+    {
+        const FStateTiming& Timing = StateTimings[Index];
+        if (Timing.Frames == 0)
+        {
+            continue;
+        }
+
+        const EMovementType Type = static_cast<EMovementType>(static_cast<int32>(EMovementType::Idle) + Index);
+        const double TotalMs     = FPlatformTime::ToMilliseconds64(Timing.Cycles);
+
+        UE_LOG(LogAdvanceMovement, Display, TEXT("  %-32s %6u ticks, %8.3f us/tick"),
+            *UEnum::GetValueAsString(Type), Timing.Frames, (TotalMs * 1000.0) / Timing.Frames);
+    }
+}
+
+#pragma endregion
+
+#pragma region Input
+
+FVector FMovementReplay::ResolveInput(const FVector& LiveInput)
+{
+    if (!Frames.IsValidIndex(FrameIndex))
+    {
+        return LiveInput;
+    }
+
+    if (IsRecording())
+    {
+        Frames[FrameIndex].SetInput(LiveInput);
+        return Frames[FrameIndex].GetInput();
+    }
+
+    if (IsPlaying())
+    {
+        return Frames[FrameIndex].GetInput();
+    }
+
+    return LiveInput;
+}
+
+#pragma endregion
@@ -0,0 +1,229 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Character/Component/Movement/MovementData.h"
+
+#pragma region MovementReplay
+
+// Per-frame character flags captured alongside the input vector.
+enum class EMovementReplayFlags : uint8
+{
+    None        = 0,
+    PressedJump = 1 << 0,
+    WantsCrouch = 1 << 1,
+};
+ENUM_CLASS_FLAGS(EMovementReplayFlags);
+
+// One environment probe answer captured while recording, replayed in place of the trace during playback.
+struct FMovementReplayProbe
+{
+    // Slot key from MakeMovementProbeKey()
+    uint32 Key = 0;
+
+    bool bHit = false;
+
+    // Only serialized for hits
+    FVector3f Location     = FVector3f::ZeroVector;
+    FVector3f ImpactPoint  = FVector3f::ZeroVector;
+    FVector3f ImpactNormal = FVector3f::ZeroVector;
+    float Time     = 1.0f;
+    float Distance = 0.0f;
+
+    friend FArchive& operator<<(FArchive& Ar, FMovementReplayProbe& Probe);
+};
+
+// One recorded movement tick.
+struct FMovementReplayFrame
+{
+    float DeltaTime = 0.0f;
+
+    // Consumed input vector, quantized to 8 bits per axis on record so playback sees the exact same value
+    int8 Input[3] = { 0, 0, 0 };
+
+    // Character state at the start of the tick, used to place the character and to detect divergence.
+    // MovementType is the type of the movement state the character was in.
+    FVector3f Location = FVector3f::ZeroVector;
+    FVector3f Velocity = FVector3f::ZeroVector;
+    EMovementType MovementType = EMovementType::Idle;
+    EMovementReplayFlags Flags = EMovementReplayFlags::None;
+
+    // FMovementInputBits the transition guards read during the tick
+    uint64 InputBits = 0;
+
+    // Range of this tick's probe answers in the replay's probe array
+    int32 FirstProbe = 0;
+    uint16 NumProbes = 0;
+
+    FVector GetInput() const;
+    void SetInput(const FVector& InInput);
+
+    friend FArchive& operator<<(FArchive& Ar, FMovementReplayFrame& Frame);
+};
+
+/**
+ * Records the inputs, delta times and environment probe answers driving one UAdvanceMovementComponent into a
+ * compact binary file, and plays them back so a movement bug or a tick cost measurement repeats frame for frame.
+ *
+ * Playback answers FMovementProbes queries from the file, compares the character against the recorded state each
+ * tick and accumulates tick cycles per movement type. Engine movement (floor checks, capsule sweeps) still runs
+ * against the loaded world, so play a replay back on the map it was recorded on.
+ */
+class AGEOFREVERSE_API FMovementReplay
+{
+
+#pragma region DataEntry
+
+public:
+    enum class EMode : uint8
+    {
+        Idle,
+        Recording,
+        Playing,
+    };
+
+    // Tick count and cycles spent while in one movement state during playback
+    struct FStateTiming
+    {
+        uint32 Frames = 0;
+        uint64 Cycles = 0;
+    };
+
+private:
+    EMode Mode = EMode::Idle;
+
+    TArray<FMovementReplayFrame> Frames;
+    TArray<FMovementReplayProbe> Probes;
+
+    // Frame being recorded or played; INDEX_NONE before the first one
+    int32 FrameIndex = INDEX_NONE;
+
+    // Actor and control rotation when recording started, restored with the first frame
+    FRotator3f StartRotation        = FRotator3f::ZeroRotator;
+    FRotator3f StartControlRotation = FRotator3f::ZeroRotator;
+
+    // Next probe answer to hand out within the current playback frame
+    int32 ProbeCursor = 0;
+
+    // Probe answers already handed out during playback, in or out of order
+    TBitArray<> ConsumedProbes;
+
+    // Playback comparison against the recording
+    uint32 DivergedFrames = 0;
+    uint32 TypeMismatches = 0;
+    uint32 ProbeMisses    = 0;
+    float MaxLocationError = 0.0f;
+
+    FStateTiming StateTimings[MovementTypeCount];
+
+#pragma endregion
+
+#pragma region Control
+
+public:
+    // Drops any previous recording and starts capturing frames.
+    void StartRecording();
+
+    // Rewinds the loaded frames and starts handing them out.
+    bool StartPlayback();
+
+    void Stop();
+
+    bool Save(const FString& Filename) const;
+    bool Load(const FString& Filename);
+
+    // Resolves a console argument into a file under Saved/MovementReplays unless it is already a full path.
+    static FString ResolveFilename(const FString& Name);
+
+    FORCEINLINE bool IsRecording() const
+    {
+        return Mode == EMode::Recording;
+    }
+
+    FORCEINLINE bool IsPlaying() const
+    {
+        return Mode == EMode::Playing;
+    }
+
+    // Frame being recorded or played; INDEX_NONE before the first one
+    FORCEINLINE int32 GetFrameIndex() const
+    {
+        return FrameIndex;
+    }
+
+    FORCEINLINE int32 GetFrameCount() const
+    {
+        return Frames.Num();
+    }
+
+    FORCEINLINE int32 GetProbeCount() const
+    {
+        return Probes.Num();
+    }
+
+    FORCEINLINE const FStateTiming& GetStateTiming(EMovementType Type) const
+    {
+        return StateTimings[MovementTypeIndex(Type)];
+    }
+
+    FORCEINLINE FRotator GetStartRotation() const
+    {
+        return FRotator(StartRotation);
+    }
+
+    FORCEINLINE FRotator GetStartControlRotation() const
+    {
+        return FRotator(StartControlRotation);
+    }
+
+#pragma endregion
+
+#pragma region Recording
+
+public:
+    // Opens a new frame with the character state at the start of the tick and the input flags its guards will read.
+    void RecordFrame(float DeltaTime, const FVector& Location, const FVector& Velocity, EMovementType Type, EMovementReplayFlags Flags, uint64 InputBits);
+
+    // Appends a probe answer to the frame being recorded.
+    void RecordProbe(uint32 Key, bool bHit, const FHitResult& Hit);
+
+    // Stores the actor and control rotation the recording starts from.
+    void RecordStartRotation(const FRotator& Rotation, const FRotator& ControlRotation);
+
+#pragma endregion
+
+#pragma region Playback
+
+public:
+    // Moves to the next recorded frame. Returns nullptr once the recording is exhausted.
+    const FMovementReplayFrame* AdvanceFrame();
+
+    /**
+     * Answers a probe from the current frame's recording. Answers are taken in recorded order; if the detectors asked
+     * in a different order (the run diverged), the rest of the frame is searched by key before falling back to a live trace.
+     * Every answer is handed out once, so a repeated key gets the next recording of it rather than the same one again.
+     */
+    bool PlayProbe(uint32 Key, const FVector& Start, const FVector& End, bool& bOutHit, FHitResult& OutHit);
+
+    // Compares the character against the state recorded at the start of the current frame.
+    void CompareFrame(const FVector& Location, EMovementType Type);
+
+    void AddTiming(EMovementType Type, uint64 Cycles);
+
+    // Logs divergence and per-state tick timings of the finished playback.
+    void LogReport(const FString& OwnerName) const;
+
+#pragma endregion
+
+#pragma region Input
+
+public:
+    // Passes the live input vector through while recording (quantized) or idle, and substitutes the recorded one while playing.
+    FVector ResolveInput(const FVector& LiveInput);
+
+#pragma endregion
+
+};
+
+#pragma endregion
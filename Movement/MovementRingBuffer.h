@@ -0,0 +1,103 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+#pragma region MovementRingBuffer
+
+/**
+ * Fixed-capacity, allocation-free ring buffer that keeps the most recent Capacity entries.
+ * Writers claim a slot with a single relaxed atomic increment, so Push() never locks and never allocates.
+ * Readers are meant for diagnostics (console dumps, crash handlers); an entry being overwritten while read may be torn.
+ */
+template <typename ElementType, uint32 Capacity>
+class TMovementRingBuffer
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "TMovementRingBuffer capacity must be a power of two.");
+
+#pragma region DataEntry
+
+private:
+    static constexpr uint32 IndexMask = Capacity - 1;
+
+    // Storage for the most recent entries, indexed by (Head & IndexMask)
+    ElementType Slots[Capacity];
+
+    // Total number of entries ever pushed; the next write goes to Head & IndexMask
+    std::atomic<uint32> Head;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    TMovementRingBuffer()
+    : Slots()
+    , Head(0)
+    {
+    }
+
+    TMovementRingBuffer(const TMovementRingBuffer&) = delete;
+    TMovementRingBuffer& operator=(const TMovementRingBuffer&) = delete;
+
+#pragma endregion
+
+#pragma region Mutator
+
+public:
+    // Stores the entry, overwriting the oldest one once the buffer is full.
+    FORCEINLINE void Push(const ElementType& Element)
+    {
+        const uint32 Index = Head.fetch_add(1, std::memory_order_relaxed);
+        Slots[Index & IndexMask] = Element;
+    }
+
+    // Forgets every stored entry.
+    void Reset()
+    {
+        Head.store(0, std::memory_order_relaxed);
+    }
+
+#pragma endregion
+
+#pragma region Accessor
+
+public:
+    // Returns the fixed capacity of the buffer.
+    static constexpr uint32 GetCapacity()
+    {
+        return Capacity;
+    }
+
+    // Returns the number of entries currently stored (at most Capacity).
+    FORCEINLINE uint32 Num() const
+    {
+        return FMath::Min(Head.load(std::memory_order_relaxed), Capacity);
+    }
+
+    // Returns the total number of entries pushed since the last reset, including overwritten ones.
+    FORCEINLINE uint32 GetTotalPushed() const
+    {
+        return Head.load(std::memory_order_relaxed);
+    }
+
+    // Visits the stored entries from oldest to newest.
+    template <typename FunctorType>
+    void ForEach(FunctorType&& Functor) const
+    {
+        const uint32 End   = Head.load(std::memory_order_acquire);
+        const uint32 Count = FMath::Min(End, Capacity);
+
+        for (uint32 Index = End - Count; Index != End; ++Index)
+        {
+            Functor(Slots[Index & IndexMask]);
+        }
+    }
+
+#pragma endregion
+
+};
+
+#pragma endregion
@@ -0,0 +1,190 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/MovementValidator.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region Stats
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Movement Anomalies"), STAT_AdvanceMovement_MovementAnomalies, STATGROUP_AdvanceMovement);
+
+#pragma endregion
+
+#pragma region Configuration
+
+static int32 GAdvanceMovementValidationEnabled = 1;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationEnabled
+(
+    TEXT("AdvanceMovement.Validation.Enable"),
+    GAdvanceMovementValidationEnabled,
+    TEXT("Checks client movement switches and velocities against movement attribute and cost limits on the server. 0: off, 1: on (default)"),
+    ECVF_Default
+);
+
+static float GAdvanceMovementValidationTolerance = 1.2f;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationTolerance
+(
+    TEXT("AdvanceMovement.Validation.Tolerance"),
+    GAdvanceMovementValidationTolerance,
+    TEXT("Factor a value may exceed its limit by before it counts as an anomaly."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementValidationThreshold = 3.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationThreshold
+(
+    TEXT("AdvanceMovement.Validation.Threshold"),
+    GAdvanceMovementValidationThreshold,
+    TEXT("Anomaly score at which every move of the client is corrected."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementValidationKickThreshold = 12.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationKickThreshold
+(
+    TEXT("AdvanceMovement.Validation.KickThreshold"),
+    GAdvanceMovementValidationKickThreshold,
+    TEXT("Anomaly score at which the client is kicked. 0 disables kicking."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementValidationDecay = 0.5f;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationDecay
+(
+    TEXT("AdvanceMovement.Validation.DecayPerSecond"),
+    GAdvanceMovementValidationDecay,
+    TEXT("Anomaly score removed per second."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementValidationCostCapacity = 100.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationCostCapacity
+(
+    TEXT("AdvanceMovement.Validation.CostCapacity"),
+    GAdvanceMovementValidationCostCapacity,
+    TEXT("Movement cost (stamina plus energy) a client may spend in a burst."),
+    ECVF_Default
+);
+
+static float GAdvanceMovementValidationCostRefill = 25.0f;
+static FAutoConsoleVariableRef CVarAdvanceMovementValidationCostRefill
+(
+    TEXT("AdvanceMovement.Validation.CostRefillPerSecond"),
+    GAdvanceMovementValidationCostRefill,
+    TEXT("Movement cost budget regained per second."),
+    ECVF_Default
+);
+
+#pragma endregion
+
+#pragma region Validation
+
+bool FMovementValidator::IsEnabled()
+{
+    return GAdvanceMovementValidationEnabled != 0;
+}
+
+bool FMovementValidator::IsAboveThreshold() const
+{
+    return AnomalyScore >= GAdvanceMovementValidationThreshold;
+}
+
+bool FMovementValidator::IsAboveKickThreshold() const
+{
+    return GAdvanceMovementValidationKickThreshold > 0.0f && AnomalyScore >= GAdvanceMovementValidationKickThreshold;
+}
+
+void FMovementValidator::Reset()
+{
+    AnomalyScore   = 0.0f;
+    CostBudget     = -1.0f;
+    LastUpdateTime = 0.0;
+    AnomalyCount   = 0;
+}
+
+void FMovementValidator::Advance(double ServerTime)
+{
+    if (CostBudget < 0.0f)
+    {
+        CostBudget     = GAdvanceMovementValidationCostCapacity;
+        LastUpdateTime = ServerTime;
+        return;
+    }
+
+    const float Elapsed = static_cast<float>(FMath::Max(ServerTime - LastUpdateTime, 0.0));
+    LastUpdateTime = ServerTime;
+
+    AnomalyScore = FMath::Max(AnomalyScore - (GAdvanceMovementValidationDecay * Elapsed), 0.0f);
+    CostBudget   = FMath::Min(CostBudget + (GAdvanceMovementValidationCostRefill * Elapsed), GAdvanceMovementValidationCostCapacity);
+}
+
+void FMovementValidator::AddAnomaly(float Severity)
+{
+    AnomalyScore += Severity;
+    ++AnomalyCount;
+
+    INC_DWORD_STAT(STAT_AdvanceMovement_MovementAnomalies);
+}
+
+bool FMovementValidator::ScoreExcess(float Actual, float Allowed, float Scale)
+{
+    if (Allowed <= 0.0f || Actual <= Allowed * GAdvanceMovementValidationTolerance)
+    {
+        return false;
+    }
+
+    // A 2x overshoot scores 2, anything beyond 4x scores 4, so one wild value cannot lock a player out for long.
+    AddAnomaly(FMath::Min(Actual / Allowed, 4.0f) * Scale);
+    return true;
+}
+
+bool FMovementValidator::ValidateSwitch(const FMovementValidationLimits& Limits, float TargetDistance, bool bTargetAnchored, double ServerTime)
+{
+    Advance(ServerTime);
+
+    bool bValid = true;
+
+    if (TargetDistance >= 0.0f && ScoreExcess(TargetDistance, Limits.MaximumTargetDistance))
+    {
+        bValid = false;
+    }
+
+    if (!bTargetAnchored)
+    {
+        AddAnomaly(1.0f);
+        bValid = false;
+    }
+
+    if (Limits.Cost > 0.0f)
+    {
+        if (CostBudget < Limits.Cost)
+        {
+            AddAnomaly(1.0f);
+            bValid = false;
+        }
+
+        // Only a switch that passed everything is paid for, so rejected spam cannot starve the honest switches after it.
+        if (bValid)
+        {
+            CostBudget -= Limits.Cost;
+        }
+    }
+
+    return bValid;
+}
+
+bool FMovementValidator::ValidateVelocity(const FMovementValidationLimits& Limits, const FVector& Velocity, float DeltaTime, double ServerTime)
+{
+    Advance(ServerTime);
+
+    bool bValid = !ScoreExcess(Velocity.Size2D(), Limits.MaximumSpeed, DeltaTime);
+
+    if (Velocity.Z > 0.0f && ScoreExcess(Velocity.Z, Limits.JumpImpulseMaxZ, DeltaTime))
+    {
+        bValid = false;
+    }
+
+    return bValid;
+}
+
+#pragma endregion
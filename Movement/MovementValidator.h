@@ -0,0 +1,99 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#pragma region MovementValidator
+
+// Limits a client move is checked against, gathered from the movement module of the type involved.
+struct FMovementValidationLimits
+{
+    // FMovementAttribute::MaximumSpeed; 0 disables the horizontal speed check
+    float MaximumSpeed = 0.0f;
+
+    // FMovementAttribute::JumpImpulseMaxZ; 0 disables the vertical speed check
+    float JumpImpulseMaxZ = 0.0f;
+
+    // Farthest a reported target may be from the character (teleport MaxDistance, anchor ranges); 0 disables the check
+    float MaximumTargetDistance = 0.0f;
+
+    // FMovementCost stamina and energy charged when the movement starts
+    float Cost = 0.0f;
+};
+
+/**
+ * Server-side plausibility check of one client's moves.
+ * Every check is a handful of comparisons. A switch that fails any of them is rejected on the spot; every violation
+ * also adds to an anomaly score that decays over time, which only decides how hard to respond: above the threshold
+ * every move is corrected, above the kick threshold the player is removed. Velocity overshoots score per second of
+ * move time, so the score does not depend on the client's move rate.
+ * Movement costs drain a refilling budget, which catches clients that chain dashes or teleports faster than they can pay for.
+ */
+class AGEOFREVERSE_API FMovementValidator
+{
+
+#pragma region DataEntry
+
+private:
+    float AnomalyScore = 0.0f;
+
+    // Cost budget left; starts full
+    float CostBudget = -1.0f;
+
+    // Server time of the last decay or refill
+    double LastUpdateTime = 0.0;
+
+    // Anomalies recorded since the last reset
+    uint32 AnomalyCount = 0;
+
+#pragma endregion
+
+#pragma region Validation
+
+public:
+    /**
+     * Checks a movement switch requested by the client. TargetDistance is the distance from the character to the requested
+     * target, or a negative value when the type has none; bTargetAnchored is false when a zipline or grapple target has no anchor.
+     * Returns false when any check failed and the switch must be rejected.
+     */
+    bool ValidateSwitch(const FMovementValidationLimits& Limits, float TargetDistance, bool bTargetAnchored, double ServerTime);
+
+    // Checks the velocity the server simulated for a move of DeltaTime seconds. Returns false when it exceeded the limits.
+    bool ValidateVelocity(const FMovementValidationLimits& Limits, const FVector& Velocity, float DeltaTime, double ServerTime);
+
+    FORCEINLINE float GetAnomalyScore() const
+    {
+        return AnomalyScore;
+    }
+
+    FORCEINLINE uint32 GetAnomalyCount() const
+    {
+        return AnomalyCount;
+    }
+
+    // True while the score is at or above AdvanceMovement.Validation.Threshold; every move gets corrected.
+    bool IsAboveThreshold() const;
+
+    // True while the score is at or above AdvanceMovement.Validation.KickThreshold; the player gets removed.
+    bool IsAboveKickThreshold() const;
+
+    // Returns true when validation runs at all (AdvanceMovement.Validation.Enable).
+    static bool IsEnabled();
+
+    void Reset();
+
+private:
+    // Decays the score and refills the cost budget for the time passed since the last call.
+    void Advance(double ServerTime);
+
+    // Adds the severity of a limit overshoot, Actual / Allowed capped and times Scale, when beyond the tolerance. Returns true on overshoot.
+    bool ScoreExcess(float Actual, float Allowed, float Scale = 1.0f);
+
+    void AddAnomaly(float Severity);
+
+#pragma endregion
+
+};
+
+#pragma endregion
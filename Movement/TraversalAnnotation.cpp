@@ -0,0 +1,385 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#include "Character/Component/Movement/TraversalAnnotation.h"
+#include "Character/Component/Movement/MovementLog.h"
+#include "Algo/BinarySearch.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+#pragma region TraversalAnnotation
+
+FTraversalAnnotation::FTraversalAnnotation(const FVector& InEdgePoint, const FVector& InWallNormal, float InHeight, float InWidth, bool bInUnboundedWidth, float InClearance, ETraversalAnnotationFlags InFlags)
+: EdgePoint(InEdgePoint)
+, NormalYaw(static_cast<uint16>(FMath::RoundToInt(FRotator::ClampAxis(InWallNormal.Rotation().Yaw) * (65536.0f / 360.0f)) & 0xFFFF))
+, Height(static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InHeight), 0, 0xFFFF)))
+, Width(bInUnboundedWidth ? UnboundedWidth : static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InWidth), 0, UnboundedWidth - 1)))
+, Clearance(static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InClearance), 0, 0xFFFF)))
+, Flags(static_cast<uint8>(InFlags))
+{
+}
+
+FVector FTraversalAnnotation::GetWallNormal() const
+{
+    const float Yaw = FMath::DegreesToRadians(NormalYaw * (360.0f / 65536.0f));
+    return FVector(FMath::Cos(Yaw), FMath::Sin(Yaw), 0.0f);
+}
+
+#pragma endregion
+
+#pragma region Query
+
+uint64 UTraversalAnnotationData::MakeCellKey(int32 X, int32 Y)
+{
+    return (static_cast<uint64>(static_cast<uint32>(X)) << 32) | static_cast<uint32>(Y);
+}
+
+uint64 UTraversalAnnotationData::GetCellKey(const FVector& Location) const
+{
+    return MakeCellKey(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+bool UTraversalAnnotationData::IsCovered(const FVector& Location) const
+{
+    return CoveredBounds.IsValid && CoveredBounds.IsInsideXY(Location);
+}
+
+TConstArrayView<FTraversalAnnotation> UTraversalAnnotationData::FindCell(const FVector& Location) const
+{
+    const int32 CellIndex = Algo::BinarySearch(CellKeys, GetCellKey(Location));
+    if (CellIndex == INDEX_NONE)
+    {
+        return TConstArrayView<FTraversalAnnotation>();
+    }
+
+    const int32 Start = CellStarts[CellIndex];
+    return TConstArrayView<FTraversalAnnotation>(Annotations.GetData() + Start, CellStarts[CellIndex + 1] - Start);
+}
+
+const FTraversalAnnotation* UTraversalAnnotationData::FindEdge(const FVector& Location, const FVector& Forward, float Reach, float MinZ, float MaxZ, ETraversalAnnotationFlags RequiredFlags) const
+{
+    if (CellKeys.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    // Edges must face the character within roughly 45 degrees.
+    const float MinFacing = 0.70f;
+
+    const int32 CellX = FMath::FloorToInt32(Location.X / CellSize);
+    const int32 CellY = FMath::FloorToInt32(Location.Y / CellSize);
+    const int32 CellRange = FMath::CeilToInt32(Reach / CellSize);
+
+    const FTraversalAnnotation* BestAnnotation = nullptr;
+    float BestDistance = Reach;
+
+    for (int32 OffsetX = -CellRange; OffsetX <= CellRange; ++OffsetX)
+    {
+        for (int32 OffsetY = -CellRange; OffsetY <= CellRange; ++OffsetY)
+        {
+            const int32 CellIndex = Algo::BinarySearch(CellKeys, MakeCellKey(CellX + OffsetX, CellY + OffsetY));
+            if (CellIndex == INDEX_NONE)
+            {
+                continue;
+            }
+
+            for (int32 Index = CellStarts[CellIndex]; Index < CellStarts[CellIndex + 1]; ++Index)
+            {
+                const FTraversalAnnotation& Annotation = Annotations[Index];
+                const FVector Edge = Annotation.GetEdgePoint();
+
+                if (Edge.Z < MinZ || Edge.Z > MaxZ || !Annotation.HasFlags(RequiredFlags))
+                {
+                    continue;
+                }
+
+                if (FVector::DotProduct(-Annotation.GetWallNormal(), Forward) < MinFacing)
+                {
+                    continue;
+                }
+
+                // Distance to the wall along the facing direction, and how far the edge sits off that line.
+                const FVector ToEdge = (Edge - Location).GetSafeNormal2D() * FVector::DistXY(Edge, Location);
+                const float Along   = FVector::DotProduct(ToEdge, Forward);
+                const float Lateral = FMath::Abs(FVector::CrossProduct(Forward, ToEdge).Z);
+
+                if (Along <= 0.0f || Along >= BestDistance || Lateral > SampleSpacing)
+                {
+                    continue;
+                }
+
+                BestDistance   = Along;
+                BestAnnotation = &Annotation;
+            }
+        }
+    }
+
+    return BestAnnotation;
+}
+
+#pragma endregion
+
+#pragma region Build
+
+#if WITH_EDITOR
+
+void UTraversalAnnotationData::Build()
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogAdvanceMovement, Warning, TEXT("Traversal annotation build needs a level open in the editor."));
+        return;
+    }
+
+    BuildFromWorld(World);
+}
+
+void UTraversalAnnotationData::BuildFromWorld(UWorld* World)
+{
+    TArray<FTraversalAnnotation> Built;
+    FBox Covered(ForceInit);
+
+    for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+    {
+        TInlineComponentArray<UPrimitiveComponent*> Primitives(*ActorIterator);
+
+        for (UPrimitiveComponent* Primitive : Primitives)
+        {
+            // Only geometry that can never move is safe to answer for without a trace.
+            if (!Primitive
+                || Primitive->Mobility != EComponentMobility::Static
+                || !Primitive->IsCollisionEnabled()
+                || Primitive->GetCollisionResponseToChannel(ECC_Visibility) != ECR_Block)
+            {
+                continue;
+            }
+
+            const FBox Bounds = Primitive->Bounds.GetBox();
+            if (BuildBounds.IsValid && !BuildBounds.Intersect(Bounds))
+            {
+                continue;
+            }
+
+            Covered += Bounds;
+            AnnotatePrimitive(World, Primitive, Built);
+        }
+    }
+
+    if (BuildBounds.IsValid && Covered.IsValid)
+    {
+        Covered = Covered.Overlap(BuildBounds);
+    }
+
+    // Group by cell so each cell's annotations are contiguous.
+    Built.Sort([this](const FTraversalAnnotation& A, const FTraversalAnnotation& B)
+    {
+        return GetCellKey(A.GetEdgePoint()) < GetCellKey(B.GetEdgePoint());
+    });
+
+    CellKeys.Reset();
+    CellStarts.Reset();
+
+    for (int32 Index = 0; Index < Built.Num(); ++Index)
+    {
+        const uint64 Key = GetCellKey(Built[Index].GetEdgePoint());
+        if (CellKeys.IsEmpty() || CellKeys.Last() != Key)
+        {
+            CellKeys.Add(Key);
+            CellStarts.Add(Index);
+        }
+    }
+
+    CellStarts.Add(Built.Num());
+
+    Annotations   = MoveTemp(Built);
+    CoveredBounds = Covered;
+
+    MarkPackageDirty();
+
+    UE_LOG(LogAdvanceMovement, Display, TEXT("Traversal annotations built: %d edges in %d cells (%.1f KB)."),
+        Annotations.Num(), CellKeys.Num(),
+        (Annotations.Num() * sizeof(FTraversalAnnotation) + CellKeys.Num() * (sizeof(uint64) + sizeof(int32))) / 1024.0f);
+}
+
+void UTraversalAnnotationData::AnnotatePrimitive(UWorld* World, UPrimitiveComponent* Primitive, TArray<FTraversalAnnotation>& OutAnnotations) const
+{
+    const FBox Bounds = Primitive->Bounds.GetBox();
+    const FVector Center = Bounds.GetCenter();
+    const FVector Extent = Bounds.GetExtent();
+
+    // Deepest top surface measured behind an edge before it counts as open ground.
+    const float MaximumWidth = 200.0f;
+    const float MaximumClearance = 200.0f;
+
+    // Width search matching the runtime one: steps of AdvanceMovement.Vault.CoarseStep's default to the first miss, then bisection.
+    const float WidthCoarseStep = 16.0f;
+
+    FCollisionQueryParams ComponentParams(SCENE_QUERY_STAT(TraversalAnnotation), true);
+
+    // Only static geometry goes into the annotations; whatever can move is traced at runtime.
+    FCollisionQueryParams WorldParams(SCENE_QUERY_STAT(TraversalAnnotation));
+    WorldParams.bIgnoreTouches = true;
+    WorldParams.MobilityType   = EQueryMobilityType::Static;
+
+    auto TraceComponent = [&](const FVector& Start, const FVector& End, FHitResult& OutHit) -> bool
+    {
+        return Primitive->LineTraceComponent(OutHit, Start, End, ComponentParams);
+    };
+
+    // Columns along the four vertical faces of the bounds, each traced inward at every SampleSpacing of height so the
+    // primitive's actual collision is hit wherever it sits inside the bounds, including steps and rotated or inset faces.
+    const FVector FaceNormals[] = { FVector::ForwardVector, FVector::BackwardVector, FVector::RightVector, FVector::LeftVector };
+    const int32 HeightCount = FMath::Max(1, FMath::CeilToInt32((Extent.Z * 2.0f) / SampleSpacing));
+
+    for (const FVector& FaceNormal : FaceNormals)
+    {
+        const FVector Tangent(-FaceNormal.Y, FaceNormal.X, 0.0f);
+        const float FaceDepth  = FMath::Abs(FVector::DotProduct(Extent, FaceNormal));
+        const float FaceLength = FMath::Abs(FVector::DotProduct(Extent, Tangent));
+        const int32 SampleCount = FMath::Max(1, FMath::FloorToInt32((FaceLength * 2.0f) / SampleSpacing));
+
+        for (int32 Sample = 0; Sample <= SampleCount; ++Sample)
+        {
+            const float Offset = -FaceLength + (Sample * (FaceLength * 2.0f) / SampleCount);
+
+            // Edges already recorded for this column; several heights usually find the same one.
+            TArray<FVector, TInlineAllocator<4>> ColumnEdges;
+
+            for (int32 HeightIndex = 0; HeightIndex < HeightCount; ++HeightIndex)
+            {
+                const float SampleZ = Bounds.Min.Z + FMath::Min((HeightIndex + 0.5f) * SampleSpacing, Extent.Z * 2.0f - 1.0f);
+                const FVector FaceColumn = FVector(Center.X, Center.Y, SampleZ) + (FaceNormal * FaceDepth) + (Tangent * Offset);
+
+                // Find the face itself: trace inward at this height.
+                FHitResult WallHit;
+                if (!TraceComponent(FaceColumn + (FaceNormal * 10.0f), FaceColumn - (FaceNormal * FaceDepth * 2.0f), WallHit))
+                {
+                    continue;
+                }
+
+                const FVector WallNormal = WallHit.ImpactNormal.GetSafeNormal2D();
+                if (WallNormal.IsNearlyZero() || FMath::Abs(WallHit.ImpactNormal.Z) > 0.30f)
+                {
+                    continue;
+                }
+
+                // Top surface just behind the face.
+                const FVector Inward = -WallNormal;
+                const FVector TopStart(WallHit.ImpactPoint.X + Inward.X * 6.0f, WallHit.ImpactPoint.Y + Inward.Y * 6.0f, Bounds.Max.Z + 10.0f);
+
+                FHitResult TopHit;
+                if (!TraceComponent(TopStart, FVector(TopStart.X, TopStart.Y, Bounds.Min.Z - 10.0f), TopHit) || TopHit.ImpactNormal.Z < 0.70f)
+                {
+                    continue;
+                }
+
+                const FVector EdgePoint(WallHit.ImpactPoint.X, WallHit.ImpactPoint.Y, TopHit.ImpactPoint.Z);
+
+                if (ColumnEdges.ContainsByPredicate([&EdgePoint](const FVector& Edge) { return Edge.Equals(EdgePoint, 2.0f); }))
+                {
+                    continue;
+                }
+
+                ColumnEdges.Add(EdgePoint);
+
+                // Floor in front of the face, which may belong to another primitive.
+                const FVector FloorStart = EdgePoint + (WallNormal * 30.0f);
+                FHitResult FloorHit;
+                if (!World->LineTraceSingleByChannel(FloorHit, FloorStart, FloorStart - FVector(0.0f, 0.0f, 10000.0f), ECC_Visibility, WorldParams))
+                {
+                    continue;
+                }
+
+                const float Height = EdgePoint.Z - FloorHit.ImpactPoint.Z;
+                if (Height < MinimumHeight)
+                {
+                    continue;
+                }
+
+                // Free height above the top surface.
+                const FVector ClearanceStart = EdgePoint + (Inward * 20.0f) + FVector(0.0f, 0.0f, 1.0f);
+                FHitResult ClearanceHit;
+                const float Clearance = World->LineTraceSingleByChannel(ClearanceHit, ClearanceStart, ClearanceStart + FVector(0.0f, 0.0f, MaximumClearance), ECC_Visibility, WorldParams)
+                    ? ClearanceHit.Distance
+                    : MaximumClearance;
+
+                // Depth of the top surface, searched the same way the runtime detection does it.
+                auto TopAt = [&](float Depth) -> bool
+                {
+                    const FVector Start = EdgePoint + (Inward * Depth) + FVector(0.0f, 0.0f, 5.0f);
+                    FHitResult Hit;
+                    return World->LineTraceSingleByChannel(Hit, Start, Start - FVector(0.0f, 0.0f, 15.0f), ECC_Visibility, WorldParams);
+                };
+
+                float NearDepth = 0.0f;
+                float FarDepth  = -1.0f;
+
+                for (float Depth = WidthCoarseStep; ; Depth = FMath::Min(Depth + WidthCoarseStep, MaximumWidth))
+                {
+                    if (!TopAt(Depth))
+                    {
+                        FarDepth = Depth;
+                        break;
+                    }
+
+                    NearDepth = Depth;
+
+                    if (Depth >= MaximumWidth)
+                    {
+                        break;
+                    }
+                }
+
+                const bool bUnbounded = FarDepth < 0.0f;
+
+                while (!bUnbounded && FarDepth - NearDepth > 1.0f)
+                {
+                    const float MidDepth = FMath::FloorToFloat((NearDepth + FarDepth) * 0.5f);
+                    if (MidDepth <= NearDepth)
+                    {
+                        break;
+                    }
+
+                    if (TopAt(MidDepth))
+                    {
+                        NearDepth = MidDepth;
+                    }
+                    else
+                    {
+                        FarDepth = MidDepth;
+                    }
+                }
+
+                const float Width = bUnbounded ? MaximumWidth : NearDepth;
+
+                ETraversalAnnotationFlags Flags = ETraversalAnnotationFlags::Ledge;
+
+                if (Height <= MaximumVaultHeight)
+                {
+                    Flags |= ETraversalAnnotationFlags::Vault;
+                }
+
+                if (Height >= MinimumWallRunHeight)
+                {
+                    Flags |= ETraversalAnnotationFlags::WallRun;
+                }
+
+                if (BuildBounds.IsValid && !BuildBounds.IsInside(EdgePoint))
+                {
+                    continue;
+                }
+
+                OutAnnotations.Emplace(EdgePoint, WallNormal, Height, Width, bUnbounded, Clearance, Flags);
+            }
+        }
+    }
+}
+
+#endif
+
+#pragma endregion
@@ -0,0 +1,217 @@
+// Copyright © 2025 Reverse-A. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "TraversalAnnotation.generated.h"
+
+#pragma region TraversalAnnotation
+
+// What a precomputed edge can be used for.
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ETraversalAnnotationFlags : uint8
+{
+    None        = 0         UMETA(Hidden),
+    Ledge       = 1 << 0    UMETA(DisplayName = "Ledge"),      // Hang and mantle
+    Vault       = 1 << 1    UMETA(DisplayName = "Vault"),      // Low enough to vault over
+    WallRun     = 1 << 2    UMETA(DisplayName = "Wall Run")    // Face tall enough to run along or up
+};
+
+ENUM_CLASS_FLAGS(ETraversalAnnotationFlags);
+
+/**
+ * One sampled edge of static geometry: a point on the wall face at the height of its top surface.
+ * Quantized to keep large levels compact; heights and widths are in whole units.
+ */
+USTRUCT()
+struct FTraversalAnnotation
+{
+    GENERATED_BODY()
+
+#pragma region DataEntry
+
+private:
+    UPROPERTY()
+    FVector3f EdgePoint = FVector3f::ZeroVector;
+
+    // Yaw of the horizontal wall normal, mapped from [0, 360) degrees onto [0, 65536)
+    UPROPERTY()
+    uint16 NormalYaw = 0;
+
+    // Edge height above the floor at the wall base
+    UPROPERTY()
+    uint16 Height = 0;
+
+    // Depth of the top surface behind the edge; UnboundedWidth when it runs past the sampled depth
+    UPROPERTY()
+    uint16 Width = 0;
+
+    // Free height above the top surface
+    UPROPERTY()
+    uint16 Clearance = 0;
+
+    UPROPERTY()
+    uint8 Flags = 0;
+
+#pragma endregion
+
+#pragma region Constructor
+
+public:
+    static constexpr uint16 UnboundedWidth = TNumericLimits<uint16>::Max();
+
+    FTraversalAnnotation() = default;
+
+    FTraversalAnnotation(const FVector& InEdgePoint, const FVector& InWallNormal, float InHeight, float InWidth, bool bInUnboundedWidth, float InClearance, ETraversalAnnotationFlags InFlags);
+
+#pragma endregion
+
+#pragma region Accessor
+
+public:
+    FORCEINLINE FVector GetEdgePoint() const
+    {
+        return FVector(EdgePoint);
+    }
+
+    FVector GetWallNormal() const;
+
+    FORCEINLINE float GetHeight() const
+    {
+        return Height;
+    }
+
+    FORCEINLINE bool HasFarEdge() const
+    {
+        return Width != UnboundedWidth;
+    }
+
+    FORCEINLINE float GetWidth() const
+    {
+        return Width;
+    }
+
+    FORCEINLINE float GetClearance() const
+    {
+        return Clearance;
+    }
+
+    FORCEINLINE bool HasFlags(ETraversalAnnotationFlags InFlags) const
+    {
+        return (static_cast<ETraversalAnnotationFlags>(Flags) & InFlags) == InFlags;
+    }
+
+#pragma endregion
+
+};
+
+/**
+ * Edges of the static collision in a level, built in the editor and looked up at runtime by 2D grid cell.
+ *
+ * Build() scans every static primitive that blocks visibility, samples the faces of its bounds every SampleSpacing
+ * units and records the edges it finds. Movable geometry is never annotated, so callers keep tracing for it.
+ * Annotations are stored sorted by cell, with a sorted cell key array and start offsets for binary search.
+ */
+UCLASS(BlueprintType)
+class AGEOFREVERSE_API UTraversalAnnotationData : public UDataAsset
+{
+    GENERATED_BODY()
+
+#pragma region Settings
+
+private:
+    // Edge length of a lookup cell
+    UPROPERTY(EditAnywhere, Category = "Build", meta = (ClampMin = "50.0"))
+    float CellSize = 200.0f;
+
+    // Distance between samples along a face
+    UPROPERTY(EditAnywhere, Category = "Build", meta = (ClampMin = "5.0"))
+    float SampleSpacing = 25.0f;
+
+    // Highest edge flagged as vaultable
+    UPROPERTY(EditAnywhere, Category = "Build")
+    float MaximumVaultHeight = 220.0f;
+
+    // Lowest face flagged as wall-runnable
+    UPROPERTY(EditAnywhere, Category = "Build")
+    float MinimumWallRunHeight = 200.0f;
+
+    // Lowest edge recorded; anything lower is a step
+    UPROPERTY(EditAnywhere, Category = "Build")
+    float MinimumHeight = 20.0f;
+
+    // Area to annotate; everything when left empty
+    UPROPERTY(EditAnywhere, Category = "Build")
+    FBox BuildBounds = FBox(ForceInit);
+
+#pragma endregion
+
+#pragma region DataEntry
+
+private:
+    // Area the last build covered; lookups outside it have no answer
+    UPROPERTY(VisibleAnywhere, Category = "Data")
+    FBox CoveredBounds = FBox(ForceInit);
+
+    // Sorted cell keys and, per key, the offset of its first annotation; CellStarts has one extra entry at the end
+    UPROPERTY()
+    TArray<uint64> CellKeys;
+
+    UPROPERTY()
+    TArray<int32> CellStarts;
+
+    // Every annotation, grouped by cell in CellKeys order
+    UPROPERTY(VisibleAnywhere, Category = "Data")
+    TArray<FTraversalAnnotation> Annotations;
+
+#pragma endregion
+
+#pragma region Query
+
+public:
+    // Returns true when the location lies inside the area the data was built for.
+    bool IsCovered(const FVector& Location) const;
+
+    // Returns the annotations stored in the cell containing the location.
+    TConstArrayView<FTraversalAnnotation> FindCell(const FVector& Location) const;
+
+    /**
+     * Finds the nearest edge in front of Location, facing back at it, within Reach and with its top between MinZ and MaxZ.
+     * Searches the cells around Location. Returns nullptr if there is none.
+     */
+    const FTraversalAnnotation* FindEdge(const FVector& Location, const FVector& Forward, float Reach, float MinZ, float MaxZ, ETraversalAnnotationFlags RequiredFlags) const;
+
+    FORCEINLINE int32 GetNumAnnotations() const
+    {
+        return Annotations.Num();
+    }
+
+private:
+    uint64 GetCellKey(const FVector& Location) const;
+
+    static uint64 MakeCellKey(int32 X, int32 Y);
+
+#pragma endregion
+
+#pragma region Build
+
+#if WITH_EDITOR
+public:
+    // Rebuilds the annotations from the static collision of the level open in the editor. Save the asset afterwards.
+    UFUNCTION(CallInEditor, Category = "Build")
+    void Build();
+
+    // Rebuilds the annotations from the static collision of the given world.
+    void BuildFromWorld(UWorld* World);
+
+private:
+    // Samples the collision of one static primitive at every SampleSpacing of height and appends the edges found.
+    void AnnotatePrimitive(UWorld* World, UPrimitiveComponent* Primitive, TArray<FTraversalAnnotation>& OutAnnotations) const;
+#endif
+
+#pragma endregion
+
+};
+
+#pragma endregion